@@ -39,11 +39,17 @@
 
 #include "../Drivers/Inc/I2C_Interface.h"
 #include "../Drivers/Inc/UART_Interface.h"
-#include "../Drivers/Inc/SYSTICK_Interface.h"
 
 #include "../HAL/Inc/DS1307_Interface.h"
+#include "../HAL/Inc/RTC_Interface.h"
 
 #include "../Service/Inc/Service.h"
+#include "../Service/Inc/SoftClock.h"
+#include "../Service/Inc/RtcHealth.h"
+#include "../Service/Inc/Deferred.h"
+#include "../Service/Inc/TimeBase.h"
+#include "../Service/Inc/Timers.h"
+#include "../Service/Inc/Scheduler.h"
 
 /* ========================================================================= *
  *                        GLOBAL VARIABLES SECTION                           *
@@ -57,26 +63,31 @@ extern DS1307_Config_t Date_Time_RTC;
 /* Variable to Store the Configuration of I2C1 that will be Used in the Application ( In Setting Date & Time ) */
 extern I2C_Configs_t *I2C_CONFIG;
 
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/* Console Command Handler , Runs One Menu Option Each Call */
+static void Console_Menu(void);
+
+/* Display the Menu of Options & the Stale RTC Notice */
+static void Show_Menu(void);
+
 /* ========================================================================= *
  *                        MAIN APPLICATION SECTION                           *
  * ========================================================================= */
 
 int main(void)
 {
-	/* Error State Variable to Check if the Receiving Process of Date & Time From User
-	 * is Done Successfully or Not
-	 */
-	Error_State_t Receiving_State = OK;
-
-	/* Choosen Option By the User From the Provided Options */
-	OPTIONS_t ChoosenOption = NO_OPTION;
-
 	/* Variable to Store the ID Sent From User */
 	uint8_t *ID_Ptr = NULL;
 
 	/* Variable to Store Password Sent From User */
 	uint8_t *Pass_Ptr = NULL;
 
+	/* Health Flags of the RTC */
+	uint8_t RTC_Status = RTCHEALTH_OK;
+
 	/* Enable Clock on Used Peripherals Only */
 	Clock_Init();
 
@@ -86,7 +97,19 @@ int main(void)
 	/* NVIC Interrupts Configuration */
 	Interrupts_Init();
 
-	/* Initialize USART2 */
+	/* Interrupts Post Their Slow Work to PendSV at the Lowest Priority */
+	Deferred_Init();
+
+	/* Millisecond SysTick & 64 Bit Time Base For Delays & Timeouts */
+	TimeBase_Init();
+
+	/* Countdowns , the Stopwatch & the Alarm Bell Run on the Time Base Tick */
+	Timers_Init();
+
+	/* Interrupts Post Events , Their Tasks Run One at a Time in Thread Mode */
+	Scheduler_Init();
+
+	/* Initialize USART2 , Received Bytes Are Buffered From its Interrupt */
 	USART2_Init();
 
 	/* Initialize SPI1 */
@@ -95,10 +118,28 @@ int main(void)
 	/* Initialize I2C1 */
 	I2C1_Init();
 
+	/* Probe the Bus For the RTC Chip ( DS1307 or DS3231 ) */
+	RTC_Init(I2C_CONFIG);
+
+	/* Restart the RTC Oscillator If it Was Halted ( Dead Backup Battery ) & Replace Invalid Registers */
+	RtcHealth_Check(I2C_CONFIG, NULL, &RTC_Status);
+
+	/* Keep RTC Time in RAM , Advanced By the RTC 1 HZ Square Wave */
+	SoftClock_Init(I2C_CONFIG);
+
+	/* Load Alarms Saved Before the Reset */
+	RestoreAlarms();
+
+	/* Alarm , Button , Second & SPI Tasks , Set Before the Alarms Are Armed */
+	StartTasks();
+
+	/* Arm the Nearest Alarm */
+	StartAlarms();
+
 	/* Clear Terminal Window With Every Reset */
 	Clear_Terminal();
 
-	/* Receive ID From User */
+	/* Receive ID From User , Alarms & Timers Keep Running While the User Types */
 	ID_Ptr = ID_Reception();
 
 	/* Receive Password From User */
@@ -110,83 +151,158 @@ int main(void)
 	 */
 	Check_LoginInfo(ID_Ptr, Pass_Ptr, NUM_OF_TRIES);
 
+	/* System Login is Initiated Successfully , Each Option Typed Runs as the Console Task */
+	Console_Start(&Console_Menu);
+
+	Show_Menu();
 
+	/* Run the Tasks & Sleep Between Events */
+	Scheduler_Run();
+}
 
-	while (1)
+/* ========================================================================= *
+ *                        CONSOLE SECTION                                    *
+ * ========================================================================= */
+
+static void Console_Menu(void)
+{
+	/* Error State Variable to Check if the Receiving Process of Date & Time From User
+	 * is Done Successfully or Not
+	 */
+	Error_State_t Receiving_State = OK;
+
+	/* Choosen Option By the User From the Provided Options */
+	OPTIONS_t ChoosenOption = Read_Option();
+
+	/* Switch on the Chossen Option */
+	switch (ChoosenOption)
 	{
-		/* System Login is Initiated Successfully */
+	/* ========================================================================= *
+	 * 								OPTIONS SECTION 						     *
+	 * ========================================================================= */
+	case DISPLAY_OPTION:
 
-		/* Display the Menu of Options if Login Info is Correct
-		 * Else Stuck in the Call Back Function
-		 */
-		ChoosenOption = Display_Menu();
+		/* Read Date & Time */
+		Reading_Time();
 
-		/* Switch on the Chossen Option */
-		switch (ChoosenOption)
-		{
-		/* ========================================================================= *
-		 * 								OPTIONS SECTION 						     *
-		 * ========================================================================= */
-		case DISPLAY_OPTION:
+		/* Transmit Date & Time , the Second Task Keeps it Updated on the LCD */
+		Transmit_Time();
+
+		break;
 
-			/* Read Date & Time */
-			Reading_Time();
+	case SET_ALARM_OPTION:
 
-			/* Transmit Date & Time  */
-			Transmit_Time();
+		/* Set Alarm , the Changed Alarm is Moved in the Alarm Queue */
+		SetAlarm();
 
-			break;
+		break;
 
-		case SET_ALARM_OPTION:
+	case SET_DATE_TIME_OPTION:
 
-			/* Set Alarm */
-			SetAlarm();
+		while (1)
+		{
+			/*Read the settled time and date from PC terminal*/
+			Receiving_State = ReadDateTime_FromPC();
 
-			/* Configuring SYSTICK To Call CompTime Function Every One Second
-			to Compare Between Alarm Set By User & Real Time From RTC */
-			SYSTICK_voidSetINT(1000, 1, &SysTickPeriodicISR);
+			/*Check The Received Date & Time*/
+			if (OK == Receiving_State)
+			{
 
-			break;
+				/*Receiving Calender from user is done Successfully*/
+				/*Write the Received Calender in the RTC Module & the Soft Clock*/
+				/*Alarm Deadlines Follow the New Time , Alarms Skipped By Moving it Forward Fire Now*/
+				SetClockTime(&Date_Time_RTC);
 
-		case SET_DATE_TIME_OPTION:
+				/*Display message to user that the time settled successfully*/
+				USART_SendStringPolling(UART_2, "\nThe Given Time Settled successfully\n");
 
-			while (1)
+				/*Return to Main Menu*/
+				break;
+			}
+			else
 			{
-				/*Read the settled time and date from PC terminal*/
-				Receiving_State = ReadDateTime_FromPC();
-
-				/*Check The Received Date & Time*/
-				if (OK == Receiving_State)
-				{
-
-					/*Receiving Calender from user is done Successfully*/
-					/*Write the Received Calender in the RTC Module*/
-					DS1307_WriteDateTime(I2C_CONFIG, &Date_Time_RTC);
-
-					/*Display message to user that the time settled successfully*/
-					USART_SendStringPolling(UART_2, "\nThe Given Time Settled successfully\n");
-
-					/*Return to Main Menu*/
-					break;
-				}
-				else
-				{
-					/*Wrong Calender Received from User*/
-					USART_SendStringPolling(UART_2, "\nWrong Date or Time is Given , Please Try Again\n");
-				}
+				/*Wrong Calender Received from User*/
+				USART_SendStringPolling(UART_2, "\nWrong Date or Time is Given , Please Try Again\n");
 			}
-			break;
+		}
+		break;
 
-		default:
+	case ACKNOWLEDGE_ALARMS_OPTION:
 
-			/* If User Passed a Wrong Option */
-			WRONG_OptionChoosen();
-			continue;
+		/* Ringing & Snoozed Alarms Are Queued Again at Their Next Deadline , the User Button Does the Same */
+		if (0 == AcknowledgeAlarms())
+		{
+			USART_SendStringPolling(UART_2, "\nNo Ringing Alarms\n");
 		}
+		else
+		{
+			USART_SendStringPolling(UART_2, "\nAlarms Acknowledged\n");
+		}
+		break;
+
+	case SNOOZE_ALARMS_OPTION:
+
+		/* Ringing Alarms Ring Again After the Snooze */
+		if (0 == SnoozeAlarms())
+		{
+			USART_SendStringPolling(UART_2, "\nNo Ringing Alarms\n");
+		}
+		else
+		{
+			USART_SendStringPolling(UART_2, "\nAlarms Snoozed For 5 Minutes\n");
+		}
+		break;
+
+	case TIMERS_OPTION:
+
+		/* Countdowns Keep Running in the Background & Ring the Bell When They End */
+		TimersMenu();
+
+		break;
+
+	case STATS_OPTION:
+
+		/* Runs , Run Times & Queue Depths of Each Task */
+		ShowStatistics();
+
+		break;
 
-		/* After the User Functionality is Done Check if User wants To Continue or Not */
+	case DELETE_ALARM_OPTION:
+
+		/* The Alarm Leaves the Alarm Queue & its Number is Free For a New Alarm */
+		DeleteAlarm();
+
+		break;
+
+	default:
+
+		/* If User Passed a Wrong Option */
+		WRONG_OptionChoosen();
+
+		/* Display the Menu Again Without Asking to Continue */
+		ChoosenOption = NO_OPTION;
+
+		break;
+	}
+
+	/* After the User Functionality is Done Check if User wants To Continue or Not */
+	if (NO_OPTION != ChoosenOption)
+	{
 		Check_IF_ContinueisNeeded();
 	}
+
+	Show_Menu();
+}
+
+static void Show_Menu(void)
+{
+	if (RtcHealth_IsTimeStale())
+	{
+		USART_SendStringPolling(UART_2, "\nRTC Time Was Lost , Please Set Date & Time\n");
+	}
+
+	/* Display the Menu of Options , the Option is Read When the User Types it */
+	Display_Menu();
 }
 
 /* ========================================================================= *
@@ -200,10 +316,3 @@ void SPI_CallBackFunc(void)
 	/* ShutDown Sequence Excecution */
 	ShutDown_Sequence();
 }
-
-/* SYSTICK ISR to Compare Between Alarm Set By User & Real Time From RTC */
-void SysTickPeriodicISR()
-{
-	/* Systick ISR to Compare Time Comes Every 1 second */
-	CompTime();
-}
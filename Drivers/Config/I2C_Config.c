@@ -0,0 +1,36 @@
+/*
+ *@file		:	I2C_Config.c
+ *@author	: 	Mohamed Wael
+ *@brief	:	I2C Configuration File (Timeouts & Bus Recovery Pins)
+ */
+
+/******************* MAIN INCLUDES *********************/
+#include <stdint.h>
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../Inc/GPIO_Interface.h"
+#include "../Inc/I2C_Interface.h"
+/*******************************************************/
+
+
+/******************* CONFIGURATION *********************/
+
+/*HCLK in MHZ , Timeouts are Measured by the DWT Cycle Counter Running at HCLK*/
+const uint8_t I2C_HCLK_MHZ = SYSTEM_HCLK_MHZ;
+
+/*Maximum Time of Each Blocking Wait on an I2C Flag*/
+const uint16_t I2C_TIMEOUT_MS = 10;
+
+/*Timeout Given to Transfers Started by I2C_Master_Transfer_IT / DMA (or their Wrappers) , Checked by I2C_Process_Timeouts*/
+const uint16_t I2C_TRANSFER_TIMEOUT_MS = 100;
+
+/*SCL & SDA Pins of I2C1 , I2C2 & I2C3 Used in Bus Recovery*/
+const I2C_Bus_Pins_t I2C_BUS_PINS[] =
+{
+	{.SCL_Port = PORTB, .SCL_Pin = PIN8,  .SDA_Port = PORTB, .SDA_Pin = PIN9,  .AltFunc = AF4},
+	{.SCL_Port = PORTB, .SCL_Pin = PIN10, .SDA_Port = PORTB, .SDA_Pin = PIN11, .AltFunc = AF4},
+	{.SCL_Port = PORTA, .SCL_Pin = PIN8,  .SDA_Port = PORTC, .SDA_Pin = PIN9,  .AltFunc = AF4}
+};
+
+/*******************************************************/
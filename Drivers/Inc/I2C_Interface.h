@@ -38,6 +38,18 @@ typedef enum {
 	MASTER_MODE_FAST,
 }I2C_MASTER_MODE_t;
 
+typedef enum {
+	FM_DUTY_2,					/*Fast Mode Tlow/Thigh = 2*/
+	FM_DUTY_16_9,				/*Fast Mode Tlow/Thigh = 16/9 (Needed to Reach 400 KHz with PCLK Multiple of 10 MHz)*/
+}I2C_FM_DUTY_t;
+
+typedef enum {
+	I2C_SPEED_STANDARD,			/*Standard Mode Up to 100 KHz*/
+	I2C_SPEED_FAST_DUTY_2,		/*Fast Mode Up to 400 KHz , Duty 2*/
+	I2C_SPEED_FAST_DUTY_16_9,	/*Fast Mode Up to 400 KHz , Duty 16/9*/
+	I2C_SPEEDS_NUMBER
+}I2C_SPEED_t;
+
 typedef enum {
 	FLAGS_SR1_SB	,			/*Start BIT Flag : Set when a Start condition generated.*/
 
@@ -76,18 +88,69 @@ typedef enum {
 	I2C_INTERRUPTS_BUFIE,
 }I2C_INTERRUPTS_t;
 
+typedef enum {
+	I2C_STATE_IDLE,				/*No Transfer in Progress (Last Transfer Completed Successfully)*/
+	I2C_STATE_START_TX,			/*Start Sent, Waiting SB to Send Slave Address with Write*/
+	I2C_STATE_TRANSMIT,			/*Slave Address ACKed, Sending Data Bytes*/
+	I2C_STATE_START_RX,			/*(Repeated) Start Sent, Waiting SB to Send Slave Address with Read*/
+	I2C_STATE_RECEIVE,			/*Slave Address ACKed, Receiving Data Bytes*/
+	I2C_STATE_ERROR				/*Last Transfer Ended with an Error (AF / BERR / ARLO / OVR)*/
+}I2C_TRANSFER_STATE_t;
+
 typedef struct {
 
 	I2C_I2C_NUMBER_t				I2C_Num;
 	I2C_CLK_STRETCH_STATE_t			Stretch_state;
 	I2C_PACKET_ERROR_CHECK_STATE_t	PEC_State;
-	uint8_t 						I2C_Pclk_MHZ;
+	uint8_t 						I2C_Pclk_MHZ;		/*2 - 45 MHz in Standard Mode , 4 - 45 MHz in Fast Mode*/
 	I2C_ADDRESSING_MODE_t			ADD_Mode;
 	uint8_t							Chip_Address;
 	I2C_MASTER_MODE_t				I2C_Mode;
-	uint8_t							SCL_Frequency_KHZ;
+	uint16_t						SCL_Frequency_KHZ;
+	I2C_FM_DUTY_t					FM_Duty;			/*Used Only in Fast Mode*/
 }I2C_Configs_t;
 
+/*Descriptor of a Transaction (Write Phase Then Read Phase) Executed From the I2C Queue ,
+  Must Stay Valid Till its CallBack is Called*/
+typedef struct I2C_Transaction {
+
+	const I2C_Configs_t *			Device;				/*I2C Number & Bus Speed of the Device*/
+	uint8_t							SlaveADD;			/*Write Address , R/W Bit is Handled by the Driver*/
+	const uint8_t *					TxData;				/*Bytes to Write (Can be NULL if TxSize = 0)*/
+	uint8_t							TxSize;
+	uint8_t *						RxData;				/*Buffer of Bytes to Read (Can be NULL if RxSize = 0)*/
+	uint8_t							RxSize;
+	uint8_t							RepeatedStart;		/*ENABLED : Repeated Start Between Write & Read , DISABLED : Stop Then Start*/
+	uint8_t							UseDMA;				/*ENABLED : Read Phase is Done by DMA*/
+	uint16_t						Timeout_ms;			/*Maximum Execution Time Checked by I2C_Process_Timeouts (0 : No Timeout)*/
+	void (* CallBackFunc)(struct I2C_Transaction * Transaction);	/*Called From Interrupt Context When it Ends (Can be NULL)*/
+	volatile Error_State_t			Status;				/*I2C_TRANSFER_BUSY While Queued or Running , Then the Result*/
+}I2C_Transaction_t;
+
+/*SCL & SDA Pins of an I2C , Driven as GPIO by the Bus Recovery (Values of Port_t , Pin_t & AltFunc_t)*/
+typedef struct {
+
+	uint8_t							SCL_Port;
+	uint8_t							SCL_Pin;
+	uint8_t							SDA_Port;
+	uint8_t							SDA_Pin;
+	uint8_t							AltFunc;			/*Alternate Function Given Back to the Pins After Recovery*/
+}I2C_Bus_Pins_t;
+
+/*Error & Recovery Statistics of an I2C*/
+typedef struct {
+
+	uint32_t						Timeouts;			/*Blocking Waits & Transactions that Timed Out*/
+	uint32_t						AckFailures;
+	uint32_t						BusErrors;
+	uint32_t						ArbitrationLosses;
+	uint32_t						Overruns;
+	uint32_t						Recoveries;			/*Bus Recoveries that Released the Bus*/
+	uint32_t						FailedRecoveries;	/*Bus Recoveries that Ended With SDA Still Low*/
+	uint32_t						LastRecovery_us;	/*Duration of the Last Bus Recovery*/
+	uint32_t						MaxRecovery_us;		/*Longest Bus Recovery*/
+}I2C_Stats_t;
+
 /******** END OF MAIN USER DEFINED VARIABLES ***********/
 
 
@@ -106,7 +169,7 @@ Error_State_t I2C_Init(const I2C_Configs_t * I2C_Configs);
  * @function 		:	I2C_Send_Start_Condition
  * @brief			:	Send start condition by the chip
  * @param			:	I2C Number
- * @retval			:	Error State
+ * @retval			:	Error State (TIME_OUT_ERROR if Start is Not Generated in I2C_TIMEOUT_MS)
  * @Note			:	Calling this function for the first time will send Start Condition
 						and make the Chip State a Master.
  * @Note			:	Calling for second time without sending stop condition
@@ -134,7 +197,8 @@ Error_State_t I2C_Send_Stop_Condition(I2C_I2C_NUMBER_t	I2C_Num);
  * @param			:	I2C Configurations
  * @param			:	Slave Address
  * @param			:	Data to be send
- * @retval			:	Error State
+ * @retval			:	Error State (I2C_ACK_FAILURE , I2C_BUS_ERROR , I2C_ARBITRATION_LOST , TIME_OUT_ERROR)
+ * @Note			:	Each Wait is Bounded by I2C_TIMEOUT_MS , the Bus is Recovered on Timeout or Bus Error
 */
 Error_State_t I2C_Master_Transmit(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , uint8_t *DataToSend ,uint8_t data_Size);
 
@@ -144,9 +208,9 @@ Error_State_t I2C_Master_Transmit(const I2C_Configs_t * I2C_Configs , uint8_t Sl
 @brief            :    Send Address Packet
 @param            :    Pointer to I2c Config Structure
 @param            :    Address to Send
-@retval           :    VOID
+@retval           :    Error State
  */
-void I2C_SendAddressPacketMTransmitter( I2C_Configs_t * Config , uint8_t Address );
+Error_State_t I2C_SendAddressPacketMTransmitter( I2C_Configs_t * Config , uint8_t Address );
 
 /*
 
@@ -154,9 +218,9 @@ void I2C_SendAddressPacketMTransmitter( I2C_Configs_t * Config , uint8_t Address
 @brief            :    Send Data Packet
 @param            :    Pointer to I2c Config Structure
 @param            :    Data to Send
-@retval           :    VOID
+@retval           :    Error State
  */
-void I2C_SendDataPacket(I2C_Configs_t * Config , uint8_t Data );
+Error_State_t I2C_SendDataPacket(I2C_Configs_t * Config , uint8_t Data );
 
 /*
 
@@ -164,19 +228,165 @@ void I2C_SendDataPacket(I2C_Configs_t * Config , uint8_t Data );
 @brief            :    Send Address Packet
 @param            :    Pointer to I2c Config Structure
 @param            :    Address to Send
-@retval           :    VOID
+@retval           :    Error State
  */
-void I2C_SendAddressPacketMReceiver( I2C_Configs_t * Config , uint8_t Address );
+Error_State_t I2C_SendAddressPacketMReceiver( I2C_Configs_t * Config , uint8_t Address );
 
 /*
  * @function 		:	I2C_Master_Receive
  * @brief			:	Receive (READ) data From Slave device
  * @param			:	I2C Configurations
  * @param			:	Variable to save Received data
- * @retval			:	Error State
+ * @retval			:	Error State (TIME_OUT_ERROR if No Byte is Received in I2C_TIMEOUT_MS)
  */
 Error_State_t I2C_Master_Receive(const I2C_Configs_t * I2C_Configs , uint8_t *ReceivedData);
 
+/*
+ * @function 		:	I2C_Submit_Transaction
+ * @brief			:	Add a Transaction to the Queue of its I2C , Queued Transactions are Executed
+ * 						Back to Back From Interrupt Context
+ * @param			:	Transaction Descriptor
+ * @retval			:	Error State (I2C_TRANSFER_BUSY if the Descriptor is Already Queued , I2C_QUEUE_FULL)
+ * @Note			:	I2C Event & Error IRQs Must be Enabled (and the DMA Stream IRQ if UseDMA is ENABLED)
+ */
+Error_State_t I2C_Submit_Transaction(I2C_Transaction_t * Transaction);
+
+/*
+ * @function 		:	I2C_Process_Timeouts
+ * @brief			:	Abort the Running Transaction of Each I2C if it Exceeded its Timeout ,
+ * 						the Queue of that I2C Waits Till I2C_Process_Recovery Recovers the Bus
+ * @param			:	VOID
+ * @retval			:	1 if Any I2C Waits For I2C_Process_Recovery , 0 Otherwise
+ * @Note			:	Call it Periodically (Every ms for Example) , the Time is Measured on the DWT Cycle Counter
+ * 						From the Start of Each Transaction So the Call Period Does Not Matter ,
+ * 						Never Waits So it Can be Called From Interrupt Context
+ */
+uint8_t I2C_Process_Timeouts(void);
+
+/*
+ * @function 		:	I2C_Process_Recovery
+ * @brief			:	Recover the Bus of Each I2C Whose Transaction Was Aborted & Start its Next Transaction
+ * @param			:	VOID
+ * @retval			:	VOID
+ * @Note			:	Takes Up to About 10 ms of Busy Waiting , Call it From Thread Level With Interrupts Enabled
+ */
+void I2C_Process_Recovery(void);
+
+/*
+ * @function 		:	I2C_Wait_Transfer
+ * @brief			:	Wait Till the Transfer Started by I2C_Master_Transfer_IT / DMA (or their Wrappers) Ends ,
+ * 						if it Takes Longer than the Timeout it is Aborted (& the Bus Recovered) While Running ,
+ * 						or Taken Out of the Queue While Still Waiting , Other Transactions are Not Touched
+ * @param			:	I2C Number
+ * @param			:	Timeout in ms
+ * @retval			:	Result of the Transfer (Same as I2C_Get_Transfer_Status)
+ */
+Error_State_t I2C_Wait_Transfer(I2C_I2C_NUMBER_t I2C_Num , uint16_t Timeout_ms);
+
+/*
+ * @function 		:	I2C_Bus_Recovery
+ * @brief			:	Release a Bus Held Low by a Slave : Clock SCL as GPIO (Up to 9 Clocks) Till the Slave
+ * 						Releases SDA , Generate a Stop , Then Reset & Re-Initialize the I2C
+ * @param			:	I2C Number
+ * @retval			:	Error State (I2C_BUS_ERROR if SDA is Still Low)
+ * @Note			:	Pins are Taken From I2C_BUS_PINS in I2C_Config.c , I2C_Init Must be Called Before
+ */
+Error_State_t I2C_Bus_Recovery(I2C_I2C_NUMBER_t I2C_Num);
+
+/*
+ * @function 		:	I2C_Get_Stats
+ * @brief			:	Get Error & Recovery Statistics of the I2C
+ * @param			:	I2C Number
+ * @param			:	Structure to Save the Statistics in
+ * @retval			:	Error State
+ */
+Error_State_t I2C_Get_Stats(I2C_I2C_NUMBER_t I2C_Num , I2C_Stats_t * Stats);
+
+/*
+ * @function 		:	I2C_Master_Transfer_IT
+ * @brief			:	Start a Non Blocking Master Transfer Driven by Event & Error Interrupts
+ * 						(Start -> Address(W) -> Tx Bytes -> Repeated Start -> Address(R) -> Rx Bytes -> Stop)
+ * @param			:	I2C Configurations
+ * @param			:	Slave Address (Write Address , R/W Bit is Handled by the Driver)
+ * @param			:	Data buffer to be send (Can be NULL if TxSize = 0)
+ * @param			:	Number of Bytes to be send
+ * @param			:	Buffer to save Received data (Can be NULL if RxSize = 0)
+ * @param			:	Number of Bytes to be received
+ * @param			:	CallBack Function Called From Interrupt Context When Transfer Ends
+ * @retval			:	Error State
+ * @Note			:	I2C Event & Error IRQs Must be Enabled in the NVIC
+ * @Note			:	Buffers Must Stay Valid Till the CallBack is Called , Use
+ * 						I2C_Get_Transfer_Status Inside the CallBack to Know the Result
+ * @Note			:	Bus Speed is Switched to the Speed of the Passed Configurations Before Start ,
+ * 						so Each Device Can Have its Own Configurations on the Same I2C
+ * @Note			:	The Transfer is Queued Behind Other Transactions of the I2C , Only One Transfer
+ * 						Started by this Function (or its Wrappers) Can be Pending Per I2C
+ */
+Error_State_t I2C_Master_Transfer_IT(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , const uint8_t * TxData , uint8_t TxSize , uint8_t * RxData , uint8_t RxSize , void (* I2C_CallBackFunc)(void));
+
+/*
+ * @function 		:	I2C_Master_Transmit_IT
+ * @brief			:	Transmit (Write) data to Slave device Without Blocking
+ * @param			:	I2C Configurations
+ * @param			:	Slave Address
+ * @param			:	Data buffer to be send
+ * @param			:	Number of data elements to be send
+ * @param			:	CallBack Function
+ * @retval			:	Error State
+ */
+Error_State_t I2C_Master_Transmit_IT(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , const uint8_t * DataToSend , uint8_t data_Size , void (* I2C_CallBackFunc)(void));
+
+/*
+ * @function 		:	I2C_Master_Receive_IT
+ * @brief			:	Receive (READ) data From Slave device Without Blocking
+ * @param			:	I2C Configurations
+ * @param			:	Slave Address
+ * @param			:	Buffer to save Received data
+ * @param			:	Number of data elements to be received
+ * @param			:	CallBack Function
+ * @retval			:	Error State
+ */
+Error_State_t I2C_Master_Receive_IT(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , uint8_t * ReceivedData , uint8_t data_Size , void (* I2C_CallBackFunc)(void));
+
+/*
+ * @function 		:	I2C_Master_Transfer_DMA
+ * @brief			:	Same as I2C_Master_Transfer_IT but the Read Phase is Done by DMA in One Burst ,
+ * 						the Hardware NACKs the Last Byte (LAST Bit) Without CPU Intervention
+ * @param			:	I2C Configurations
+ * @param			:	Slave Address (Write Address , R/W Bit is Handled by the Driver)
+ * @param			:	Data buffer to be send (Can be NULL if TxSize = 0)
+ * @param			:	Number of Bytes to be send
+ * @param			:	Buffer to save Received data
+ * @param			:	Number of Bytes to be received
+ * @param			:	CallBack Function Called From Interrupt Context When Transfer Ends
+ * @retval			:	Error State
+ * @Note			:	Receive Streams : I2C1 -> DMA1 Stream0 Ch1 , I2C2 -> DMA1 Stream3 Ch7 , I2C3 -> DMA1 Stream2 Ch3 ,
+ * 						DMA1 Clock & the Stream IRQ Must be Enabled in Addition to I2C Event & Error IRQs
+ * @Note			:	Reading a Single Byte is Done by Interrupts (LAST Bit Needs at Least 2 Bytes)
+ */
+Error_State_t I2C_Master_Transfer_DMA(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , const uint8_t * TxData , uint8_t TxSize , uint8_t * RxData , uint8_t RxSize , void (* I2C_CallBackFunc)(void));
+
+/*
+ * @function 		:	I2C_Master_Receive_DMA
+ * @brief			:	Receive (READ) data From Slave device by DMA Without Blocking
+ * @param			:	I2C Configurations
+ * @param			:	Slave Address
+ * @param			:	Buffer to save Received data
+ * @param			:	Number of data elements to be received
+ * @param			:	CallBack Function
+ * @retval			:	Error State
+ */
+Error_State_t I2C_Master_Receive_DMA(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , uint8_t * ReceivedData , uint8_t data_Size , void (* I2C_CallBackFunc)(void));
+
+/*
+ * @function 		:	I2C_Get_Transfer_Status
+ * @brief			:	Get Result of the Last Transfer Started by I2C_Master_Transfer_IT / DMA (or their Wrappers)
+ * @param			:	I2C Number
+ * @retval			:	OK if Last Transfer Completed , I2C_TRANSFER_BUSY if Still Queued or Running ,
+ * 						or the Error that Ended it (I2C_ACK_FAILURE , I2C_BUS_ERROR , ...)
+ */
+Error_State_t I2C_Get_Transfer_Status(I2C_I2C_NUMBER_t I2C_Num);
+
 /*
  * @function 		:	I2C_Enable_DMA
  * @brief			:	Enable DMA Stream
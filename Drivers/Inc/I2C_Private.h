@@ -7,6 +7,36 @@
 #ifndef I2C_INC_I2C_PRIVATE_H_
 #define I2C_INC_I2C_PRIVATE_H_
 
+/****************** PRIVATE TYPES **********************/
+
+/*Maximum Number of Transactions Waiting on Each I2C (Excluding the Running One)*/
+#define I2C_QUEUE_SIZE			8
+
+/*Context & Queue of the Interrupt Driven Transactions of an I2C Peripheral*/
+typedef struct {
+
+	volatile I2C_TRANSFER_STATE_t	State;
+	I2C_Transaction_t * volatile	Transaction;		/*Running Transaction , NULL if Idle*/
+	uint8_t							TxIndex;
+	uint8_t							RxIndex;
+	uint8_t							UseDMA;				/*Read Phase of the Running Transaction is Done by DMA*/
+	uint32_t						Start_Cycles;		/*DWT Cycle Count When the Running Transaction Started*/
+	volatile uint8_t				Recovery;			/*I2C_RECOVERY_xxx , the Queue Waits While it is Not NONE*/
+	I2C_Transaction_t *				Queue[I2C_QUEUE_SIZE];
+	uint8_t							QueueHead;
+	uint8_t							QueueCount;
+}I2C_Transfer_t;
+
+/*CCR & TRISE Values of a Bus Speed*/
+typedef struct {
+
+	uint16_t						CCR;			/*Including F/S & DUTY Bits*/
+	uint8_t							TRISE;
+}I2C_Timing_t;
+
+/************** End of PRIVATE TYPES *******************/
+
+
 /***************** STATIC FUNCTIONS ********************/
 /*
  * @function 		:	I2C_Set_SCL_Frequency
@@ -16,6 +46,15 @@
  */
 static void I2C_Set_SCL_Frequency(const I2C_Configs_t * I2C_Configs);
 
+/*
+ * @function 		:	I2C_Get_Timing
+ * @brief			:	Get CCR & TRISE Values of the Wanted Speed , From the Timing Table for
+ * 						Maximum Speed of the Mode (100 / 400 KHz) or Calculated for Lower Speeds
+ * @param			:	I2C Configurations
+ * @retval			:	CCR & TRISE Values
+ */
+static I2C_Timing_t I2C_Get_Timing(const I2C_Configs_t * I2C_Configs);
+
 /*
  * @function 		:	I2C_CheckConfigs
  * @brief			:	Check I2c Configurations
@@ -32,6 +71,194 @@ static Error_State_t I2C_CheckConfigs(const I2C_Configs_t * I2C_Configs);
 @retval            :    VOID
 */
  void I2C_CLR_ADDR(I2C_I2C_NUMBER_t I2C_Num);
+
+/*
+ * @function 		:	I2C_EV_Handler
+ * @brief			:	Event Interrupt State Machine of the Interrupt Driven Transfer
+ * @param			:	I2C Number
+ * @retval			:	VOID
+ */
+static void I2C_EV_Handler(I2C_I2C_NUMBER_t I2C_Num);
+
+/*
+ * @function 		:	I2C_ER_Handler
+ * @brief			:	Error Interrupt Handling (AF / BERR / ARLO / OVR) of the Interrupt Driven Transfer
+ * @param			:	I2C Number
+ * @retval			:	VOID
+ */
+static void I2C_ER_Handler(I2C_I2C_NUMBER_t I2C_Num);
+
+/*
+ * @function 		:	I2C_End_Transfer
+ * @brief			:	Disable Transfer Interrupts , Save the Result & Call the User CallBack
+ * @param			:	I2C Number
+ * @param			:	Result of the Transfer
+ * @retval			:	VOID
+ */
+static void I2C_End_Transfer(I2C_I2C_NUMBER_t I2C_Num , Error_State_t Status);
+
+/*
+ * @function 		:	I2C_CheckTransaction
+ * @brief			:	Check Transaction Descriptor
+ * @param			:	Transaction Descriptor
+ * @retval			:	Error State
+ */
+static Error_State_t I2C_CheckTransaction(const I2C_Transaction_t * Transaction);
+
+/*
+ * @function 		:	I2C_Submit_Default
+ * @brief			:	Fill the Default Transaction of the I2C (Used by the Non Descriptor Functions) & Queue it
+ * @param			:	I2C Configurations
+ * @param			:	Slave Address
+ * @param			:	Data buffer to be send
+ * @param			:	Number of Bytes to be send
+ * @param			:	Buffer to save Received data
+ * @param			:	Number of Bytes to be received
+ * @param			:	ENABLED to Receive by DMA , DISABLED to Receive by Interrupts
+ * @param			:	CallBack Function
+ * @retval			:	Error State
+ */
+static Error_State_t I2C_Submit_Default(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , const uint8_t * TxData , uint8_t TxSize , uint8_t * RxData , uint8_t RxSize , uint8_t UseDMA , void (* I2C_CallBackFunc)(void));
+
+/*
+ * @function 		:	I2C_Default_CallBack
+ * @brief			:	Call the User CallBack of the Default Transaction
+ * @param			:	Finished Transaction
+ * @retval			:	VOID
+ */
+static void I2C_Default_CallBack(I2C_Transaction_t * Transaction);
+
+/*
+ * @function 		:	I2C_Enqueue
+ * @brief			:	Add a Claimed Transaction to the Queue of its I2C & Start it if the I2C is Idle
+ * @param			:	Transaction Descriptor
+ * @retval			:	Error State
+ */
+static Error_State_t I2C_Enqueue(I2C_Transaction_t * Transaction);
+
+/*
+ * @function 		:	I2C_Start_Next
+ * @brief			:	Take the Next Transaction From the Queue & Send Start , the Rest is Done by the Event Handler
+ * @param			:	I2C Number
+ * @retval			:	VOID
+ */
+static void I2C_Start_Next(I2C_I2C_NUMBER_t I2C_Num);
+
+/*
+ * @function 		:	I2C_Send_Start
+ * @brief			:	Configure the I2C For the Running Transaction & Send (Repeated) Start Once the Stop of the
+ * 						Previous Transfer is Sent
+ * @param			:	I2C Number
+ * @retval			:	Error State (TIME_OUT_ERROR if the STOP Bit is Not Cleared Within I2C_STOP_TIMEOUT_US)
+ */
+static Error_State_t I2C_Send_Start(I2C_I2C_NUMBER_t I2C_Num);
+
+/*
+ * @function 		:	I2C_Wait_Flag
+ * @brief			:	Wait Till a Status Flag Reaches a State , Bounded by I2C_TIMEOUT_MS &
+ * 						Stopped Early by an Error Flag in SR1
+ * @param			:	I2C Number
+ * @param			:	Status Register (SR1 / SR2)
+ * @param			:	Flag Bit Number
+ * @param			:	Wanted Flag State (FLAG_SET / FLAG_RESET)
+ * @retval			:	Error State (TIME_OUT_ERROR , I2C_ACK_FAILURE , I2C_BUS_ERROR , I2C_ARBITRATION_LOST)
+ */
+static Error_State_t I2C_Wait_Flag(I2C_I2C_NUMBER_t I2C_Num , volatile uint32_t * Reg , uint8_t Flag , uint8_t State);
+
+/*
+ * @function 		:	I2C_Blocking_Error
+ * @brief			:	Count an Error of a Blocking Function & Leave the Bus Usable : Stop on ACK Failure ,
+ * 						Bus Recovery on Timeout or Bus Error
+ * @param			:	I2C Number
+ * @param			:	Error
+ * @retval			:	The Same Error
+ */
+static Error_State_t I2C_Blocking_Error(I2C_I2C_NUMBER_t I2C_Num , Error_State_t Error_State);
+
+/*
+ * @function 		:	I2C_SR1_Error
+ * @brief			:	Get the Error Indicated by the Error Flags of SR1
+ * @param			:	SR1 Value
+ * @retval			:	Error State (OK if No Error Flag is Set)
+ */
+static Error_State_t I2C_SR1_Error(uint32_t SR1);
+
+/*
+ * @function 		:	I2C_Count_Error
+ * @brief			:	Increment the Statistics Counter of an Error
+ * @param			:	I2C Number
+ * @param			:	Error
+ * @retval			:	VOID
+ */
+static void I2C_Count_Error(I2C_I2C_NUMBER_t I2C_Num , Error_State_t Error_State);
+
+/*
+ * @function 		:	I2C_Abort_Transfer
+ * @brief			:	Abort the Running Queued Transaction With a Timeout & Hold the Queue Till the Bus is Recovered
+ * @param			:	I2C Number
+ * @retval			:	VOID
+ */
+static void I2C_Abort_Transfer(I2C_I2C_NUMBER_t I2C_Num);
+
+/*
+ * @function 		:	I2C_Cancel_Transaction
+ * @brief			:	End a Transaction With a Timeout : Aborted if it is Running , Taken Out of the Queue if it is Waiting
+ * @param			:	I2C Number
+ * @param			:	Transaction Descriptor
+ * @retval			:	VOID
+ */
+static void I2C_Cancel_Transaction(I2C_I2C_NUMBER_t I2C_Num , I2C_Transaction_t * Transaction);
+
+/*
+ * @function 		:	I2C_Run_Recovery
+ * @brief			:	Recover the Bus After an Aborted Transaction & Start the Next One
+ * @param			:	I2C Number
+ * @retval			:	VOID
+ */
+static void I2C_Run_Recovery(I2C_I2C_NUMBER_t I2C_Num);
+
+/*
+ * @function 		:	I2C_Elapsed_us
+ * @brief			:	Time Passed Since a DWT Cycle Count
+ * @param			:	Start Cycle Count
+ * @retval			:	Elapsed Time in us
+ */
+static uint32_t I2C_Elapsed_us(uint32_t Start);
+
+/*
+ * @function 		:	I2C_Delay_us
+ * @brief			:	Busy Wait Using the DWT Cycle Counter
+ * @param			:	Time in us
+ * @retval			:	VOID
+ */
+static void I2C_Delay_us(uint32_t Time_us);
+
+/*
+ * @function 		:	I2C_DMA_Start_RX
+ * @brief			:	Arm the Receive DMA Stream of the I2C , Requests Start Only When DMAEN is Set in the Address Phase
+ * @param			:	I2C Number
+ * @param			:	Buffer to save Received data
+ * @param			:	Number of Bytes to be received
+ * @retval			:	Error State
+ */
+static Error_State_t I2C_DMA_Start_RX(I2C_I2C_NUMBER_t I2C_Num , uint8_t * RxData , uint8_t RxSize);
+
+/*
+ * @function 		:	I2C_DMA_RX_Done
+ * @brief			:	End of the DMA Read Phase , Send Stop & End the Transfer
+ * @param			:	I2C Number
+ * @param			:	OK on Transfer Complete , I2C_DMA_ERROR on DMA Transfer Error
+ * @retval			:	VOID
+ */
+static void I2C_DMA_RX_Done(I2C_I2C_NUMBER_t I2C_Num , Error_State_t Status);
+
+/*DMA Receive Call Backs of Each I2C*/
+static void I2C1_DMA_RX_Cplt(void);
+static void I2C2_DMA_RX_Cplt(void);
+static void I2C3_DMA_RX_Cplt(void);
+static void I2C1_DMA_RX_Error(void);
+static void I2C2_DMA_RX_Error(void);
+static void I2C3_DMA_RX_Error(void);
 /************** End of STATIC FUNCTIONS ****************/
 
 
@@ -49,7 +276,61 @@ static Error_State_t I2C_CheckConfigs(const I2C_Configs_t * I2C_Configs);
 #define START_GENERATE_BIT		8
 #define STOP_GENERATE_BIT		9
 #define DMAEN_BIT				11
+#define POS_BIT					11
+#define LAST_BIT				12
 #define PE_BIT					0
+#define SWRST_BIT				15
+
+#define I2C_READ_BIT			0x01
+#define I2C_RX_BTF_BYTES		3			/*Last Bytes of a Read Handled on BTF (RM0390 Master Receiver)*/
+#define I2C_ERROR_FLAGS_MASK	((1<<FLAGS_SR1_BERR)|(1<<FLAGS_SR1_ARLO)|(1<<FLAGS_SR1_AF)|(1<<FLAGS_SR1_OVR))
+#define I2C_TRANSFER_IT_MASK	((1<<I2C_INTERRUPTS_ERRIE)|(1<<I2C_INTERRUPTS_EVEIE)|(1<<I2C_INTERRUPTS_BUFIE))
+
+#define DUTY_BIT				14
+#define CCR_MASK				0xFFFF
+#define TRISE_MASK				0b111111
+
+#define I2C_MAX_PCLK_MHZ		45
+#define I2C_STANDARD_MIN_PCLK_MHZ	2		/*RM0390 : Minimum PCLK For Standard Mode*/
+#define I2C_FAST_MIN_PCLK_MHZ	4			/*RM0390 : Minimum PCLK For Fast Mode*/
+#define I2C_STANDARD_MAX_KHZ	100
+#define I2C_FAST_MAX_KHZ		400
+#define I2C_CCR_STANDARD_MIN	4
+#define I2C_CCR_FAST_MIN		1
+
+/*CCR Rounded Up so SCL Never Exceeds the Wanted Frequency*/
+#define I2C_DIV_ROUND_UP(N,D)					(((N)+(D)-1)/(D))
+#define I2C_MAX(A,B)							(((A)>(B))?(A):(B))
+
+/*Standard : Thigh = Tlow = CCR * Tpclk*/
+#define I2C_CCR_STANDARD(PCLK_MHZ,SCL_KHZ)		I2C_MAX(I2C_DIV_ROUND_UP((PCLK_MHZ)*1000UL,2UL*(SCL_KHZ)),I2C_CCR_STANDARD_MIN)
+/*Fast Duty 2 : Thigh = CCR * Tpclk , Tlow = 2 * CCR * Tpclk*/
+#define I2C_CCR_FAST_DUTY_2(PCLK_MHZ,SCL_KHZ)	I2C_MAX(I2C_DIV_ROUND_UP((PCLK_MHZ)*1000UL,3UL*(SCL_KHZ)),I2C_CCR_FAST_MIN)
+/*Fast Duty 16/9 : Thigh = 9 * CCR * Tpclk , Tlow = 16 * CCR * Tpclk*/
+#define I2C_CCR_FAST_DUTY_16_9(PCLK_MHZ,SCL_KHZ)	I2C_MAX(I2C_DIV_ROUND_UP((PCLK_MHZ)*1000UL,25UL*(SCL_KHZ)),I2C_CCR_FAST_MIN)
+
+/*TRISE = Maximum Rise Time / Tpclk + 1 (1000 ns Standard , 300 ns Fast)*/
+#define I2C_TRISE_STANDARD(PCLK_MHZ)			((PCLK_MHZ)+1)
+#define I2C_TRISE_FAST(PCLK_MHZ)				((((PCLK_MHZ)*300UL)/1000UL)+1)
+
+/*Timing Table Row of a PCLK , Ordered as I2C_SPEED_t*/
+#define I2C_TIMING_ROW(PCLK_MHZ)	{	\
+	{I2C_CCR_STANDARD(PCLK_MHZ,I2C_STANDARD_MAX_KHZ), I2C_TRISE_STANDARD(PCLK_MHZ)},	\
+	{(1<<I2C_MODE_BIT)|I2C_CCR_FAST_DUTY_2(PCLK_MHZ,I2C_FAST_MAX_KHZ), I2C_TRISE_FAST(PCLK_MHZ)},	\
+	{(1<<I2C_MODE_BIT)|(1<<DUTY_BIT)|I2C_CCR_FAST_DUTY_16_9(PCLK_MHZ,I2C_FAST_MAX_KHZ), I2C_TRISE_FAST(PCLK_MHZ)}	}
+
+/*Bus Recovery : a Stuck Slave Needs at Most 8 Data Clocks + ACK Clock to Release SDA*/
+#define I2C_RECOVERY_CLOCKS		9
+#define I2C_RECOVERY_HALF_US	5			/*Half SCL Period (100 KHz)*/
+#define I2C_RECOVERY_STRETCH_US	1000		/*Maximum Time a Slave Can Hold SCL Low*/
+
+/*A Stop Programmed After the Last Byte Ends Within One SCL Period (10 us at 100 KHz) , Longer Means a Held Bus*/
+#define I2C_STOP_TIMEOUT_US		50
+
+/*Bus Recovery State of an Aborted Transaction*/
+#define I2C_RECOVERY_NONE		0
+#define I2C_RECOVERY_PENDING	1
+#define I2C_RECOVERY_RUNNING	2
 
 #define PCLK_MASK				0b111111
 #define ADDVALUE_MASK			0b1111111
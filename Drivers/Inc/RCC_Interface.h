@@ -189,6 +189,7 @@ SAI2EN
 }RCC_APB2ENR_BITS_t;
 uint8_t RCC_setCLKStatus(RCC_CLK_TYPE CLK_TYPE, RCC_CLK_STATUS Status);
 void RCC_SetSYSCLK(SYSCLK_SRC SYS_CLK_TYPE);
+SYSCLK_SRC RCC_GetSYSCLK(void);
 void RCC_HSEConfig(RCC_HSE_CONFIG HSE_USERCONFIG);
 void RCC_PLLConfig(RCC_PLL_CONFIG_t * PLL_USERCONFIG);
 void RCC_AHB1EnableCLK(RCC_AHB1ENR_BITS_t Prephiral);
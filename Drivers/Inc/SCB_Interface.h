@@ -42,14 +42,15 @@ typedef enum
     PENDSV_HANDLER
 } HANDLER_t;
 
+/* Values Are The Byte Index of The Handler Priority in SHPR1 - SHPR3 ( Exception Number - 4 ) */
 typedef enum
 {
-MemoryManagment_FAULT =4   ,
-BusFault_FAULT=12,
-Usage_FAULT=20,
-SVCCALL_FAULT=28,
-PENDSV_FAULT=20  ,
-SYSTICK_FAULT=28,
+MemoryManagment_FAULT =0   ,
+BusFault_FAULT=1,
+Usage_FAULT=2,
+SVCCALL_FAULT=7,
+PENDSV_FAULT=10  ,
+SYSTICK_FAULT=11,
 }SystemFault_t;
 /*==============================================================================================================================================
  *@fn SCB_VoidSetPriorityGroup
@@ -76,7 +77,22 @@ void SCB_VoidDisableFaultException(Fault_t Local_Fault);
  *@fn SCB_VoidSetCorePriority
  *@brief This function used to Set priority for Core peripheral
  *@paramter[in] Local_Fault: Fault Type
+ *@paramter[in] Copy_u8Priority: Priority ( 0 - 15 ) , Split Into Group & Sub Priority as in NVIC_SetPriority
  *@retval void
  *==============================================================================================================================================*/
 void SCB_VoidSetCorePriority (SystemFault_t SystemFault , uint8_t  Copy_u8Priority);
+/*==============================================================================================================================================
+ *@fn SCB_u8SetHandler
+ *@brief Setting Call Back Function of a System Handler
+ *@paramter[in] Local_Handler: Handler ( NMI_HANDLER - PENDSV_HANDLER )
+ *@paramter[in] Local_ptrToFunction: Call Back Function
+ *@retval Error State
+ *==============================================================================================================================================*/
+uint8_t SCB_u8SetHandler(HANDLER_t Local_Handler, void (*Local_ptrToFunction)(void));
+/*==============================================================================================================================================
+ *@fn SCB_VoidSetPendSV
+ *@brief Pend The PendSV Exception , it Runs When No Higher Priority Handler is Active
+ *@retval void
+ *==============================================================================================================================================*/
+void SCB_VoidSetPendSV(void);
 #endif /* SCB_INCLUDE_SCB_INTERFACE_H_ */
@@ -17,6 +17,11 @@
 #ifndef SCB_INCLUDE_SCB_PRIVATE_H_
 #define SCB_INCLUDE_SCB_PRIVATE_H_
 
+/* Priority is Kept in The High 4 Bits of Each Priority Byte */
+#define SCB_PRIORITY_SHIFT 4u
+
+/* ICSR Set Pending PendSV Bit */
+#define SCB_ICSR_PENDSVSET 28u
 
 
 #endif /* SCB_INCLUDE_SCB_PRIVATE_H_ */
@@ -78,6 +78,8 @@ typedef struct
  *              you can go with the other configuration ( SYSTICK_AHB_BY8 ) or Just Use ( SYSTICK_AHB ) & Repeat Calling the Function
  *
  *           => While Using ( SYSTICK_AHB_BY8 ) Configuration Max Delay you can make in milliseconds is ( 8000 ms = 8s )
+ *
+ *           => While SYSTICK Runs a Periodic Interrupt the Delay Only Counts its Ticks , No Limit Other Than the 32 Bit Time
  **/
 
 ERRORS_t SYSTICK_Delayms(uint32_t Copy_u32TimeInMillis) ;
@@ -92,6 +94,8 @@ ERRORS_t SYSTICK_Delayms(uint32_t Copy_u32TimeInMillis) ;
  * @note   : => While Using ( STYSTICK_AHB ) Configuration Max Delay you can make in microseconds is ( 1000000 us = 1s ) if you want more than this value
  *
  *           => While Using ( SYSTICK_AHB_BY8 ) Configuration Max Delay you can make in microseconds is ( 8000000 us = 8s )
+ *
+ *           => While SYSTICK Runs a Periodic Interrupt the Delay Only Counts its Ticks , No Limit Other Than the 32 Bit Time
  **/
 ERRORS_t SYSTICK_Delayus(uint32_t Copy_u32TimeInMicroSeconds) ;
 
@@ -104,4 +108,12 @@ ERRORS_t SYSTICK_Delayus(uint32_t Copy_u32TimeInMicroSeconds) ;
  */
 
 void	SYSTICK_voidSetINT	(uint32_t	Time_ms , SYSTICK_CLOCK_t Systick_CLK_SRC , void (* SYSTK_pfCallBackFunc )(void));
+
+/***********************************
+ * @function 		:	SYSTICK_voidStopINT
+ * @brief			:	Stop the periodic interrupt Set by SYSTICK_voidSetINT
+ * @retval			:	void
+ */
+
+void	SYSTICK_voidStopINT	(void);
 #endif /* SYSTICK_INTERFACE_H_ */
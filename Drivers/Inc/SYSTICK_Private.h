@@ -31,4 +31,16 @@
 #define		CLKSRC_MASK				0b1
 #define 	CLKSRC_BIT_ACCESS		2u
 
+/* Reload Register is 24 Bits */
+#define		SYSTICK_MAX_RELOAD		0x00FFFFFFUL
+
+/**
+ * @fn     : SYSTICK_Wait
+ * @brief  : Busy Wait For a Number of MicroSeconds , a Running SYSTICK is Only Read So its Periodic Interrupt Keeps Working ,
+ *           a Stopped One is Used as a One Shot Timer
+ * @param  : Copy_u32TimeInMicroSeconds => Time to Wait in MicroSeconds
+ * @retval : ErrorStatus ( NOK If the Time Does Not Fit the Stopped Timer )
+ **/
+static ERRORS_t SYSTICK_Wait(uint32_t Copy_u32TimeInMicroSeconds);
+
 #endif /* SYSTICK_INC_SYSTICK_PRIVATE_H_ */
@@ -28,7 +28,7 @@ static void UART_HANDLE_IT( UART_ID_t UARTNumber );
 
 
 #define UARTNUMBER 6
-#define Clock_Freq 16000000UL
+#define Clock_Freq (SYSTEM_HCLK_MHZ * 1000000UL)
 #define FlagsNumber 10
 #define OneBitMasking 0b1
 #define TwoBitMasking 0b11
@@ -604,6 +604,10 @@ void DMA1_Stream1_IRQHandler(void)
 {
     DMA_IRQHandler(DMA1_CONTROLLER, DMA_STREAM1);
 }
+void DMA1_Stream2_IRQHandler(void)
+{
+    DMA_IRQHandler(DMA1_CONTROLLER, DMA_STREAM2);
+}
 void DMA1_Stream3_IRQHandler(void)
 {
     DMA_IRQHandler(DMA1_CONTROLLER, DMA_STREAM3);
@@ -10,6 +10,8 @@
 #include "../../Library/ErrTypes.h"
 
 
+#include "../Inc/DMA_Interface.h"
+#include "../Inc/GPIO_Interface.h"
 #include "../Inc/I2C_Interface.h"
 #include "../Inc/I2C_Private.h"
 /*******************************************************/
@@ -19,6 +21,102 @@
 
 I2C_REG_t * I2Cs[MAX_I2C_NUMBERS]={I2C1,I2C2,I2C3};
 
+/*Configurations From I2C_Config.c*/
+extern const uint8_t I2C_HCLK_MHZ;
+extern const uint16_t I2C_TIMEOUT_MS;
+extern const uint16_t I2C_TRANSFER_TIMEOUT_MS;
+extern const I2C_Bus_Pins_t I2C_BUS_PINS[MAX_I2C_NUMBERS];
+
+/*Configurations Passed to I2C_Init , Restored After Bus Recovery*/
+static const I2C_Configs_t * I2C_Init_Configs[MAX_I2C_NUMBERS] = {NULL};
+
+/*Error & Recovery Statistics of Each I2C*/
+static I2C_Stats_t I2C_Stats[MAX_I2C_NUMBERS];
+
+/*CCR & TRISE of Maximum Speed of Each Mode , Indexed by PCLK in MHZ*/
+static const I2C_Timing_t I2C_Timing_Table[I2C_MAX_PCLK_MHZ + 1][I2C_SPEEDS_NUMBER] =
+{
+	I2C_TIMING_ROW(0),
+	I2C_TIMING_ROW(1),
+	I2C_TIMING_ROW(2),
+	I2C_TIMING_ROW(3),
+	I2C_TIMING_ROW(4),
+	I2C_TIMING_ROW(5),
+	I2C_TIMING_ROW(6),
+	I2C_TIMING_ROW(7),
+	I2C_TIMING_ROW(8),
+	I2C_TIMING_ROW(9),
+	I2C_TIMING_ROW(10),
+	I2C_TIMING_ROW(11),
+	I2C_TIMING_ROW(12),
+	I2C_TIMING_ROW(13),
+	I2C_TIMING_ROW(14),
+	I2C_TIMING_ROW(15),
+	I2C_TIMING_ROW(16),
+	I2C_TIMING_ROW(17),
+	I2C_TIMING_ROW(18),
+	I2C_TIMING_ROW(19),
+	I2C_TIMING_ROW(20),
+	I2C_TIMING_ROW(21),
+	I2C_TIMING_ROW(22),
+	I2C_TIMING_ROW(23),
+	I2C_TIMING_ROW(24),
+	I2C_TIMING_ROW(25),
+	I2C_TIMING_ROW(26),
+	I2C_TIMING_ROW(27),
+	I2C_TIMING_ROW(28),
+	I2C_TIMING_ROW(29),
+	I2C_TIMING_ROW(30),
+	I2C_TIMING_ROW(31),
+	I2C_TIMING_ROW(32),
+	I2C_TIMING_ROW(33),
+	I2C_TIMING_ROW(34),
+	I2C_TIMING_ROW(35),
+	I2C_TIMING_ROW(36),
+	I2C_TIMING_ROW(37),
+	I2C_TIMING_ROW(38),
+	I2C_TIMING_ROW(39),
+	I2C_TIMING_ROW(40),
+	I2C_TIMING_ROW(41),
+	I2C_TIMING_ROW(42),
+	I2C_TIMING_ROW(43),
+	I2C_TIMING_ROW(44),
+	I2C_TIMING_ROW(45)
+};
+
+/*CCR & TRISE Currently Programmed in Each I2C*/
+static I2C_Timing_t I2C_Current_Timing[MAX_I2C_NUMBERS];
+
+/*Interrupt Driven Transfer Context & Queue of Each I2C*/
+static I2C_Transfer_t I2C_Transfers[MAX_I2C_NUMBERS];
+
+/*Transactions & CallBacks Used by the Non Descriptor Functions (I2C_Master_Transfer_IT , ...)*/
+static I2C_Transaction_t I2C_Default_Transactions[MAX_I2C_NUMBERS];
+static void (* I2C_Default_CallBacks[MAX_I2C_NUMBERS])(void) = {NULL};
+
+/*DMA1 Receive Stream of Each I2C (I2C1 : Stream0 Ch1 , I2C2 : Stream3 Ch7 , I2C3 : Stream2 Ch3)*/
+static DMA_INIT_STRUCT_t I2C_DMA_RX_Configs[MAX_I2C_NUMBERS] =
+{
+	{.DMAController = DMA1_CONTROLLER, .StreamNumber = DMA_STREAM0, .ChannelNumber = DMA_CHANNEL1, .Priority = DMA_HIGH_PRIORITY,
+	 .MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS, .PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS, .MemInc = DMA_MINC_ENABLE, .PeriphInc = DMA_PINC_DISABLE,
+	 .Mode = DMA_NORMAL, .Direction = DMA_PERIPH_TO_MEM, .EnableIT = {.TransferErrorIT = DMA_INT_ENABLE, .TransferCompleteIT = DMA_INT_ENABLE}},
+
+	{.DMAController = DMA1_CONTROLLER, .StreamNumber = DMA_STREAM3, .ChannelNumber = DMA_CHANNEL7, .Priority = DMA_HIGH_PRIORITY,
+	 .MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS, .PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS, .MemInc = DMA_MINC_ENABLE, .PeriphInc = DMA_PINC_DISABLE,
+	 .Mode = DMA_NORMAL, .Direction = DMA_PERIPH_TO_MEM, .EnableIT = {.TransferErrorIT = DMA_INT_ENABLE, .TransferCompleteIT = DMA_INT_ENABLE}},
+
+	{.DMAController = DMA1_CONTROLLER, .StreamNumber = DMA_STREAM2, .ChannelNumber = DMA_CHANNEL3, .Priority = DMA_HIGH_PRIORITY,
+	 .MemDataWidth = DMA_MEM_DATA_WIDTH_8BITS, .PeriphDataWidth = DMA_PERIPH_DATA_WIDTH_8BITS, .MemInc = DMA_MINC_ENABLE, .PeriphInc = DMA_PINC_DISABLE,
+	 .Mode = DMA_NORMAL, .Direction = DMA_PERIPH_TO_MEM, .EnableIT = {.TransferErrorIT = DMA_INT_ENABLE, .TransferCompleteIT = DMA_INT_ENABLE}}
+};
+
+/*DMA Call Backs of Each I2C*/
+static void (* const I2C_DMA_RX_CpltCallBacks[MAX_I2C_NUMBERS])(void) = {I2C1_DMA_RX_Cplt, I2C2_DMA_RX_Cplt, I2C3_DMA_RX_Cplt};
+static void (* const I2C_DMA_RX_ErrorCallBacks[MAX_I2C_NUMBERS])(void) = {I2C1_DMA_RX_Error, I2C2_DMA_RX_Error, I2C3_DMA_RX_Error};
+
+/*Receive Stream of Each I2C is Initialized Once on its First DMA Transfer*/
+static uint8_t I2C_DMA_RX_Initialized[MAX_I2C_NUMBERS] = {0};
+
 
 /*******************************************************/
 
@@ -57,12 +155,16 @@ Error_State_t I2C_Init(const I2C_Configs_t * I2C_Configs)
 		I2Cs[I2C_Configs->I2C_Num]->I2C_OAR1 &= ~(ADDVALUE_MASK<<(ADDVALUE_BIT));
 		I2Cs[I2C_Configs->I2C_Num]->I2C_OAR1 |=  ((I2C_Configs->Chip_Address)<<(ADDVALUE_BIT));
 
-		/*Set The Mode when the Chip Transferred to master*/
-		I2Cs[I2C_Configs->I2C_Num]->I2C_CCR &= ~(1<<(I2C_MODE_BIT));
-		I2Cs[I2C_Configs->I2C_Num]->I2C_CCR |=  ((I2C_Configs->I2C_Mode)<<(I2C_MODE_BIT));
-
-		/*Set SCL Frequency*/
+		/*Set The Mode when the Chip Transferred to master & SCL Frequency*/
+		I2C_Current_Timing[I2C_Configs->I2C_Num].CCR = 0;
 		I2C_Set_SCL_Frequency(I2C_Configs);
+
+		/*Save Configurations to Restore them After Bus Recovery*/
+		I2C_Init_Configs[I2C_Configs->I2C_Num] = I2C_Configs;
+
+		/*Enable DWT Cycle Counter Used in Timeouts*/
+		DEMCR |= (1<<DEMCR_TRCENA);
+		DWT->CTRL |= (1<<DWT_CTRL_CYCCNTENA);
 	}
 	else {
 
@@ -93,8 +195,12 @@ Error_State_t I2C_Send_Start_Condition(I2C_I2C_NUMBER_t	I2C_Num)
 		I2Cs[I2C_Num]->I2C_CR1 |= (1<<START_GENERATE_BIT);
 
 		/*Wait till Start Condition is Generated*/
-		while (!(GET_BIT(I2Cs[I2C_Num]->I2C_SR1,FLAGS_SR1_SB)));
+		Error_State = I2C_Wait_Flag(I2C_Num, &(I2Cs[I2C_Num]->I2C_SR1), FLAGS_SR1_SB, FLAG_SET);
 
+		if (OK != Error_State)
+		{
+			I2C_Blocking_Error(I2C_Num, Error_State);
+		}
 	}
 	else {
 		Error_State = I2C_WRONG_I2C_NUMBER;
@@ -154,45 +260,70 @@ Error_State_t I2C_Master_Transmit(const I2C_Configs_t * I2C_Configs , uint8_t Sl
 
 	uint8_t Counter=0;
 
+	I2C_I2C_NUMBER_t I2C_Num = I2C_NUMBER_1;
+
 	if (OK == Error_State)
 	{
+		I2C_Num = I2C_Configs->I2C_Num;
 
 		/*Wait till Bus is FREE (Not busy)*/
-		while((GET_BIT(I2Cs[I2C_Configs->I2C_Num]->I2C_SR2,FLAGS_SR2_BUSY)));
+		Error_State = I2C_Wait_Flag(I2C_Num, &(I2Cs[I2C_Num]->I2C_SR2), FLAGS_SR2_BUSY, FLAG_RESET);
 
+		if (TIME_OUT_ERROR == Error_State)
+		{
+			/*Bus is Held by a Stuck Slave , Release it & Continue if Recovered*/
+			I2C_Count_Error(I2C_Num, Error_State);
+			Error_State = I2C_Bus_Recovery(I2C_Num);
+		}
+	}
+
+	if (OK == Error_State)
+	{
 		/*Enable I2C*/
-		I2Cs[I2C_Configs->I2C_Num]->I2C_CR1 |= (1<<PE_BIT);
+		I2Cs[I2C_Num]->I2C_CR1 |= (1<<PE_BIT);
 
 		/*Send Start Condition*/
-		I2C_Send_Start_Condition(I2C_Configs->I2C_Num);
+		Error_State = I2C_Send_Start_Condition(I2C_Num);
+	}
 
+	if (OK == Error_State)
+	{
 		/*Send Slave Address With Write Signal (LSB = 0)*/
-		I2Cs[I2C_Configs->I2C_Num]->I2C_DR = (SlaveADD);
+		I2Cs[I2C_Num]->I2C_DR = (SlaveADD);
 
 		/*Wait Till Address is Sent*/
-		while (!(GET_BIT(I2Cs[I2C_Configs->I2C_Num]->I2C_SR1,FLAGS_SR1_ADDR)));
+		Error_State = I2C_Wait_Flag(I2C_Num, &(I2Cs[I2C_Num]->I2C_SR1), FLAGS_SR1_ADDR, FLAG_SET);
 
-		/*Clear ADDR*/
-		I2C_CLR_ADDR(I2C_Configs->I2C_Num) ;
+		if (OK == Error_State)
+		{
+			/*Clear ADDR*/
+			I2C_CLR_ADDR(I2C_Num) ;
+		}
 
 		/*Send data Bytes till Buffer ends*/
-		while (Counter <=data_Size)
+		while ((OK == Error_State) && (Counter < data_Size))
 		{
 			/*wait till TxD Register empty*/
-			while (!(GET_BIT(I2Cs[I2C_Configs->I2C_Num]->I2C_SR1,FLAGS_SR1_TXE)));
+			Error_State = I2C_Wait_Flag(I2C_Num, &(I2Cs[I2C_Num]->I2C_SR1), FLAGS_SR1_TXE, FLAG_SET);
 
-			/*Write data in DR*/
-			I2Cs[I2C_Configs->I2C_Num]->I2C_DR = DataToSend[Counter++];
+			if (OK == Error_State)
+			{
+				/*Write data in DR*/
+				I2Cs[I2C_Num]->I2C_DR = DataToSend[Counter++];
 
-			/*wait till Byte transfer is finished*/
-			while (!(GET_BIT(I2Cs[I2C_Configs->I2C_Num]->I2C_SR2,FLAGS_SR1_BTF)));
+				/*wait till Byte transfer is finished*/
+				Error_State = I2C_Wait_Flag(I2C_Num, &(I2Cs[I2C_Num]->I2C_SR1), FLAGS_SR1_BTF, FLAG_SET);
+			}
 		}
-		I2C_Send_Stop_Condition(I2C_NUMBER_1);
-	}
-	else {
-
-		/*Error => Do Nothing*/
 
+		if (OK == Error_State)
+		{
+			I2C_Send_Stop_Condition(I2C_Num);
+		}
+		else
+		{
+			I2C_Blocking_Error(I2C_Num, Error_State);
+		}
 	}
 	return Error_State ;
 }
@@ -213,10 +344,17 @@ Error_State_t I2C_Master_Receive(const I2C_Configs_t * I2C_Configs , uint8_t *Re
 	{
 
 		/*wait till RxNE Register Not empty*/
-		while (!(GET_BIT(I2Cs[I2C_Configs->I2C_Num]->I2C_SR1,FLAGS_SR1_RXNE)));
+		Error_State = I2C_Wait_Flag(I2C_Configs->I2C_Num, &(I2Cs[I2C_Configs->I2C_Num]->I2C_SR1), FLAGS_SR1_RXNE, FLAG_SET);
 
-		/*Read data in the DR*/
-		*ReceivedData = I2Cs[I2C_Configs->I2C_Num]->I2C_DR;
+		if (OK == Error_State)
+		{
+			/*Read data in the DR*/
+			*ReceivedData = I2Cs[I2C_Configs->I2C_Num]->I2C_DR;
+		}
+		else
+		{
+			I2C_Blocking_Error(I2C_Configs->I2C_Num, Error_State);
+		}
 	}
 	else {
 
@@ -268,201 +406,1570 @@ Error_State_t I2C_Disable_DMA(I2C_I2C_NUMBER_t	I2C_Num)
 	}
 	return Error_State	;
 }
-/***************End of MAIN FUNCTIONS*******************/
 
+/*
+ * @function 		:	I2C_Submit_Transaction
+ * @brief			:	Add a Transaction to the Queue of its I2C , Queued Transactions are Executed
+ * 						Back to Back From Interrupt Context
+ * @param			:	Transaction Descriptor
+ * @retval			:	Error State
+ */
+Error_State_t I2C_Submit_Transaction(I2C_Transaction_t * Transaction)
+{
+	Error_State_t Error_State = OK ;
 
+	uint32_t PriMask = 0 ;
 
-/***************** STATIC FUNCTIONS ********************/
+	if (NULL == Transaction)
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		Error_State = I2C_CheckTransaction(Transaction);
+	}
+
+	if (OK == Error_State)
+	{
+		/*Claim the Descriptor , it May be Submitted From Main & Interrupt Context*/
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		if (I2C_TRANSFER_BUSY == Transaction->Status)
+		{
+			Error_State = I2C_TRANSFER_BUSY;
+		}
+		else
+		{
+			Transaction->Status = I2C_TRANSFER_BUSY;
+		}
+
+		EXIT_CRITICAL_SECTION(PriMask);
+
+		if (OK == Error_State)
+		{
+			Error_State = I2C_Enqueue(Transaction);
+		}
+	}
+	return Error_State ;
+}
 
 /*
- * @function 		:	I2C_Set_SCL_Frequency
- * @brief			:	Set SCL Frequency of the wanted I2C
+ * @function 		:	I2C_Master_Transfer_IT
+ * @brief			:	Start a Non Blocking Master Transfer Driven by Event & Error Interrupts
+ * 						(Start -> Address(W) -> Tx Bytes -> Repeated Start -> Address(R) -> Rx Bytes -> Stop)
  * @param			:	I2C Configurations
+ * @param			:	Slave Address (Write Address , R/W Bit is Handled by the Driver)
+ * @param			:	Data buffer to be send (Can be NULL if TxSize = 0)
+ * @param			:	Number of Bytes to be send
+ * @param			:	Buffer to save Received data (Can be NULL if RxSize = 0)
+ * @param			:	Number of Bytes to be received
+ * @param			:	CallBack Function Called From Interrupt Context When Transfer Ends
  * @retval			:	Error State
  */
-static void I2C_Set_SCL_Frequency(const I2C_Configs_t * I2C_Configs)
+Error_State_t I2C_Master_Transfer_IT(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , const uint8_t * TxData , uint8_t TxSize , uint8_t * RxData , uint8_t RxSize , void (* I2C_CallBackFunc)(void))
 {
-	uint16_t CCR_Value =0;
+	return I2C_Submit_Default(I2C_Configs, SlaveADD, TxData, TxSize, RxData, RxSize, DISABLED, I2C_CallBackFunc);
+}
 
-	/*Calculate CCR Register Value*/
-	CCR_Value = ((I2C_Configs->I2C_Pclk_MHZ) * (1000));
-	CCR_Value /= (I2C_Configs->SCL_Frequency_KHZ);
-	CCR_Value /= 2;
+/*
+ * @function 		:	I2C_Master_Transfer_DMA
+ * @brief			:	Same as I2C_Master_Transfer_IT but the Read Phase is Done by DMA in One Burst ,
+ * 						the Hardware NACKs the Last Byte (LAST Bit) Without CPU Intervention
+ * @param			:	I2C Configurations
+ * @param			:	Slave Address (Write Address , R/W Bit is Handled by the Driver)
+ * @param			:	Data buffer to be send (Can be NULL if TxSize = 0)
+ * @param			:	Number of Bytes to be send
+ * @param			:	Buffer to save Received data
+ * @param			:	Number of Bytes to be received
+ * @param			:	CallBack Function Called From Interrupt Context When Transfer Ends
+ * @retval			:	Error State
+ */
+Error_State_t I2C_Master_Transfer_DMA(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , const uint8_t * TxData , uint8_t TxSize , uint8_t * RxData , uint8_t RxSize , void (* I2C_CallBackFunc)(void))
+{
+	return I2C_Submit_Default(I2C_Configs, SlaveADD, TxData, TxSize, RxData, RxSize, ENABLED, I2C_CallBackFunc);
+}
 
-	I2Cs[I2C_Configs->I2C_Num]->I2C_CCR |= CCR_Value ;
+/*
+ * @function 		:	I2C_Master_Receive_DMA
+ * @brief			:	Receive (READ) data From Slave device by DMA Without Blocking
+ * @param			:	I2C Configurations
+ * @param			:	Slave Address
+ * @param			:	Buffer to save Received data
+ * @param			:	Number of data elements to be received
+ * @param			:	CallBack Function
+ * @retval			:	Error State
+ */
+Error_State_t I2C_Master_Receive_DMA(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , uint8_t * ReceivedData , uint8_t data_Size , void (* I2C_CallBackFunc)(void))
+{
+	return I2C_Submit_Default(I2C_Configs, SlaveADD, NULL, 0, ReceivedData, data_Size, ENABLED, I2C_CallBackFunc);
 }
 
 /*
- * @function 		:	I2C_CheckConfigs
- * @brief			:	Check I2c Configurations
+ * @function 		:	I2C_Master_Transmit_IT
+ * @brief			:	Transmit (Write) data to Slave device Without Blocking
  * @param			:	I2C Configurations
+ * @param			:	Slave Address
+ * @param			:	Data buffer to be send
+ * @param			:	Number of data elements to be send
+ * @param			:	CallBack Function
  * @retval			:	Error State
  */
-static Error_State_t I2C_CheckConfigs(const I2C_Configs_t * I2C_Configs)
+Error_State_t I2C_Master_Transmit_IT(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , const uint8_t * DataToSend , uint8_t data_Size , void (* I2C_CallBackFunc)(void))
 {
-	Error_State_t Error_State=OK;
+	return I2C_Master_Transfer_IT(I2C_Configs, SlaveADD, DataToSend, data_Size, NULL, 0, I2C_CallBackFunc);
+}
 
-	if (NULL != I2C_Configs)
+/*
+ * @function 		:	I2C_Master_Receive_IT
+ * @brief			:	Receive (READ) data From Slave device Without Blocking
+ * @param			:	I2C Configurations
+ * @param			:	Slave Address
+ * @param			:	Buffer to save Received data
+ * @param			:	Number of data elements to be received
+ * @param			:	CallBack Function
+ * @retval			:	Error State
+ */
+Error_State_t I2C_Master_Receive_IT(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , uint8_t * ReceivedData , uint8_t data_Size , void (* I2C_CallBackFunc)(void))
+{
+	return I2C_Master_Transfer_IT(I2C_Configs, SlaveADD, NULL, 0, ReceivedData, data_Size, I2C_CallBackFunc);
+}
+
+/*
+ * @function 		:	I2C_Get_Transfer_Status
+ * @brief			:	Get Result of the Last Transfer Started by I2C_Master_Transfer_IT / DMA (or their Wrappers)
+ * @param			:	I2C Number
+ * @retval			:	OK if Last Transfer Completed , I2C_TRANSFER_BUSY if Still Queued or Running ,
+ * 						or the Error that Ended it (I2C_ACK_FAILURE , I2C_BUS_ERROR , ...)
+ */
+Error_State_t I2C_Get_Transfer_Status(I2C_I2C_NUMBER_t I2C_Num)
+{
+	Error_State_t Error_State = OK ;
+
+	if ((I2C_Num >= I2C_NUMBER_1)&&(I2C_Num <= I2C_NUMBER_3))
+	{
+		Error_State = I2C_Default_Transactions[I2C_Num].Status;
+	}
+	else {
+		Error_State = I2C_WRONG_I2C_NUMBER;
+	}
+	return Error_State	;
+}
+
+/*
+ * @function 		:	I2C_Process_Timeouts
+ * @brief			:	Abort the Running Transaction of Each I2C if it Exceeded its Timeout
+ * @param			:	VOID
+ * @retval			:	1 if Any I2C Waits For I2C_Process_Recovery , 0 Otherwise
+ * @Note			:	Call it Periodically (Every ms for Example) , the Time is Measured on the DWT Cycle Counter
+ * 						From the Start of Each Transaction So the Call Period Does Not Matter ,
+ * 						the Bus Recovery is Left to I2C_Process_Recovery
+ */
+uint8_t I2C_Process_Timeouts(void)
+{
+	I2C_I2C_NUMBER_t I2C_Num = I2C_NUMBER_1;
+
+	I2C_Transaction_t * Transaction = NULL;
+
+	uint32_t PriMask = 0 ;
+
+	uint8_t RecoveryPending = 0 ;
+
+	for (I2C_Num = I2C_NUMBER_1 ; I2C_Num <= I2C_NUMBER_3 ; I2C_Num++)
 	{
+		ENTER_CRITICAL_SECTION(PriMask);
 
-		if ( (I2C_Configs->ADD_Mode == ADDRESSING_MODE_10BITS) || (I2C_Configs->ADD_Mode == ADDRESSING_MODE_7BITS))
+		Transaction = I2C_Transfers[I2C_Num].Transaction;
+
+		if ((NULL != Transaction) && (0 != Transaction->Timeout_ms) &&
+			(I2C_Elapsed_us(I2C_Transfers[I2C_Num].Start_Cycles) >= (Transaction->Timeout_ms * 1000UL)))
 		{
-			if ( (I2C_Configs->Chip_Address > 0) && (I2C_Configs->Chip_Address < 128))
+			I2C_Abort_Transfer(I2C_Num);
+		}
+
+		/*Also Set by an Abort in the Event Handler*/
+		if (I2C_RECOVERY_PENDING == I2C_Transfers[I2C_Num].Recovery)
+		{
+			RecoveryPending = 1;
+		}
+
+		EXIT_CRITICAL_SECTION(PriMask);
+	}
+	return RecoveryPending ;
+}
+
+/*
+ * @function 		:	I2C_Process_Recovery
+ * @brief			:	Recover the Bus of Each I2C Whose Transaction Was Aborted & Start its Next Transaction
+ * @param			:	VOID
+ * @retval			:	VOID
+ * @Note			:	Takes Up to About 10 ms of Busy Waiting , Call it From Thread Level With Interrupts Enabled
+ */
+void I2C_Process_Recovery(void)
+{
+	I2C_I2C_NUMBER_t I2C_Num = I2C_NUMBER_1;
+
+	for (I2C_Num = I2C_NUMBER_1 ; I2C_Num <= I2C_NUMBER_3 ; I2C_Num++)
+	{
+		I2C_Run_Recovery(I2C_Num);
+	}
+}
+
+/*
+ * @function 		:	I2C_Wait_Transfer
+ * @brief			:	Wait Till the Transfer Started by I2C_Master_Transfer_IT / DMA (or their Wrappers) Ends ,
+ * 						if it Takes Longer than the Timeout it is Aborted (& the Bus Recovered) While Running ,
+ * 						or Taken Out of the Queue While Still Waiting , Other Transactions are Not Touched
+ * @param			:	I2C Number
+ * @param			:	Timeout in ms
+ * @retval			:	Result of the Transfer (Same as I2C_Get_Transfer_Status)
+ */
+Error_State_t I2C_Wait_Transfer(I2C_I2C_NUMBER_t I2C_Num , uint16_t Timeout_ms)
+{
+	Error_State_t Error_State = OK ;
+
+	uint32_t Start = 0 ;
+
+	uint32_t PriMask = 0 ;
+
+	if ((I2C_Num >= I2C_NUMBER_1)&&(I2C_Num <= I2C_NUMBER_3))
+	{
+		Start = DWT->CYCCNT;
+
+		while (I2C_TRANSFER_BUSY == I2C_Default_Transactions[I2C_Num].Status)
+		{
+			if (I2C_Elapsed_us(Start) >= (Timeout_ms * 1000UL))
 			{
-				if ((I2C_Configs->I2C_Mode == MASTER_MODE_STANDARD) || (I2C_Configs->I2C_Mode == MASTER_MODE_FAST))
-				{
-					if ((I2C_Configs->I2C_Num >= I2C_NUMBER_1) && (I2C_Configs->I2C_Num <= I2C_NUMBER_3))
-					{
-						if ((I2C_Configs->I2C_Pclk_MHZ < 45) && (I2C_Configs->I2C_Pclk_MHZ > 2 ))
-						{
-							if ((I2C_Configs->PEC_State == PACKET_ERR_CHECK_ENABLED) ||(I2C_Configs->PEC_State == PACKET_ERR_CHECK_DISABLED))
-							{
-								if (((I2C_Configs->SCL_Frequency_KHZ <=100) && (I2C_Configs->I2C_Mode == MASTER_MODE_STANDARD)) ||((I2C_Configs->SCL_Frequency_KHZ <=400) && (I2C_Configs->I2C_Mode == MASTER_MODE_FAST)))
-								{
-									if ((I2C_Configs->Stretch_state == CLK_STRETCH_ENABLED) ||(I2C_Configs->Stretch_state == CLK_STRETCH_DISABLED))
-									{
-										Error_State	=	OK;
-									}
-									else {
-										Error_State	=	I2C_WRONG_CLK_STRETCH_STATE;
-									}
-								}
-								else {
-									Error_State	=	I2C_WRONG_SCL_FREQUENCY;
-								}
-							}
-							else {
-								Error_State	=	I2C_WRONG_PEC_STATE;
-							}
-						}
-						else {
-							Error_State	=	I2C_WRONG_PCLK;
-						}
-					}
-					else {
-						Error_State	=	I2C_WRONG_I2C_NUMBER;
-					}
-				}
-				else {
-					Error_State	=	I2C_WRONG_I2C_MASTER_MODE;
-				}
-			}
-			else {
-				Error_State	=	I2C_WRONG_ADDRESS_VALUE;
+				/*Only the Waited Transfer is Ended , Another Client's Transfer May Hold the Bus*/
+				ENTER_CRITICAL_SECTION(PriMask);
+
+				I2C_Cancel_Transaction(I2C_Num, &I2C_Default_Transactions[I2C_Num]);
+
+				EXIT_CRITICAL_SECTION(PriMask);
+
+				/*Runs Only if the Waited Transfer Was the Running One*/
+				I2C_Run_Recovery(I2C_Num);
 			}
 		}
-		else{
-			Error_State = I2C_WRONG_ADDRESS_MODE_STATE;
-		}
+		Error_State = I2C_Default_Transactions[I2C_Num].Status;
 	}
 	else {
-		Error_State	=	Null_Pointer;
+		Error_State = I2C_WRONG_I2C_NUMBER;
 	}
 	return Error_State ;
 }
 
-
 /*
-
-@function         :    I2C_CLR_ADDR
-@brief            :    Software sequence to Clear ADDR Flag
-@param            :    I2C Number
-@retval            :    VOID
+ * @function 		:	I2C_Bus_Recovery
+ * @brief			:	Release a Bus Held Low by a Slave : Clock SCL as GPIO (Up to 9 Clocks) Till the Slave
+ * 						Releases SDA , Generate a Stop , Then Reset & Re-Initialize the I2C
+ * @param			:	I2C Number
+ * @retval			:	Error State (I2C_BUS_ERROR if SDA is Still Low)
  */
-void I2C_CLR_ADDR(I2C_I2C_NUMBER_t I2C_Num)
+Error_State_t I2C_Bus_Recovery(I2C_I2C_NUMBER_t I2C_Num)
 {
-	uint32_t Temp_Reg = 0 ;
+	Error_State_t Error_State = OK ;
 
-	Temp_Reg = I2Cs[I2C_Num]->I2C_SR1;
-	Temp_Reg = I2Cs[I2C_Num]->I2C_SR2;
+	const I2C_Bus_Pins_t * Pins = NULL;
 
+	GPIO_PinConfig_t Pin = {.Mode = OUTPUT, .OutputType = OPEN_DRAIN, .PullType = PULL_UP, .Speed = LOW_SPEED, .AltFunc = AF0};
 
-}
+	PinValue_t SDA_Value = PIN_LOW;
+	PinValue_t SCL_Value = PIN_LOW;
 
+	uint32_t Start = 0 ;
+	uint32_t Stretch_Start = 0 ;
 
-/*
+	uint8_t Clocks = 0 ;
 
-@function         :    I2C_SendAddressPacketMTransmitter
-@brief            :    Send Address Packet
-@param            :    Pointer to I2c Config Structure
-@param            :    Address to Send
-@retval           :    VOID
- */
-void I2C_SendAddressPacketMTransmitter( I2C_Configs_t * Config , uint8_t Address )
-{
-	/*Wait till Bus is FREE (Not busy)*/
-	while((GET_BIT(I2Cs[Config->I2C_Num]->I2C_SR2,FLAGS_SR2_BUSY)));
+	if ((I2C_Num < I2C_NUMBER_1) || (I2C_Num > I2C_NUMBER_3))
+	{
+		Error_State = I2C_WRONG_I2C_NUMBER;
+	}
+	else if (NULL == I2C_Init_Configs[I2C_Num])
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		Start = DWT->CYCCNT;
 
-	/*Enable I2C*/
-	I2Cs[Config->I2C_Num]->I2C_CR1 |= (1<<0);
+		Pins = &I2C_BUS_PINS[I2C_Num];
 
-	/*Send Start Condition*/
-	I2C_Send_Start_Condition(Config->I2C_Num);
+		/*Disable I2C So it Does Not Drive the Lines*/
+		I2Cs[I2C_Num]->I2C_CR1 &= ~(1<<PE_BIT);
 
-	/*Send Slave Address With Write Signal (LSB = 0)*/
-	I2Cs[Config->I2C_Num]->I2C_DR = (Address);
+		/*Take SCL & SDA as Open Drain Outputs Released High*/
+		GPIO_u8SetPinValue(Pins->SCL_Port, Pins->SCL_Pin, PIN_HIGH);
+		GPIO_u8SetPinValue(Pins->SDA_Port, Pins->SDA_Pin, PIN_HIGH);
 
-	/*Wait Till Address is Sent*/
-	while (!(GET_BIT(I2Cs[Config->I2C_Num]->I2C_SR1,FLAGS_SR1_ADDR)));
+		Pin.Port = Pins->SCL_Port;
+		Pin.PinNum = Pins->SCL_Pin;
+		GPIO_u8PinInit(&Pin);
 
-	/*Clear ADDR*/
-	I2C_CLR_ADDR(Config->I2C_Num) ;
-}
+		Pin.Port = Pins->SDA_Port;
+		Pin.PinNum = Pins->SDA_Pin;
+		GPIO_u8PinInit(&Pin);
 
+		I2C_Delay_us(I2C_RECOVERY_HALF_US);
 
-/*
+		/*Clock Out the Byte the Slave is Stuck in Till it Releases SDA*/
+		GPIO_u8ReadPinValue(Pins->SDA_Port, Pins->SDA_Pin, &SDA_Value);
 
-@function         :    I2C_SendDataPacket
-@brief            :    Send Data Packet
-@param            :    Pointer to I2c Config Structure
-@param            :    Data to Send
-@retval           :    VOID
- */
-void I2C_SendDataPacket(I2C_Configs_t * Config , uint8_t Data )
-{
-	/*wait till TxD Register empty*/
-	while (!(GET_BIT(I2Cs[Config->I2C_Num]->I2C_SR1,FLAGS_SR1_TXE)));
+		for (Clocks = 0 ; (Clocks < I2C_RECOVERY_CLOCKS) && (PIN_LOW == SDA_Value) ; Clocks++)
+		{
+			GPIO_u8SetPinValue(Pins->SCL_Port, Pins->SCL_Pin, PIN_LOW);
+			I2C_Delay_us(I2C_RECOVERY_HALF_US);
 
-	/*Write data in DR*/
-	I2Cs[Config->I2C_Num]->I2C_DR = Data;
+			GPIO_u8SetPinValue(Pins->SCL_Port, Pins->SCL_Pin, PIN_HIGH);
 
-	/*wait till Byte transfer is finished*/
-	while (!(GET_BIT(I2Cs[Config->I2C_Num]->I2C_SR2,FLAGS_SR1_BTF)));
-}
+			/*Slave May Stretch the Clock*/
+			Stretch_Start = DWT->CYCCNT;
+			do
+			{
+				GPIO_u8ReadPinValue(Pins->SCL_Port, Pins->SCL_Pin, &SCL_Value);
+			}while ((PIN_LOW == SCL_Value) && (I2C_Elapsed_us(Stretch_Start) < I2C_RECOVERY_STRETCH_US));
 
-/*
+			I2C_Delay_us(I2C_RECOVERY_HALF_US);
 
-@function         :    I2C_SendAddressPacketMReceiver
-@brief            :    Send Address Packet
-@param            :    Pointer to I2c Config Structure
-@param            :    Address to Send
-@retval           :    VOID
- */
-void I2C_SendAddressPacketMReceiver( I2C_Configs_t * Config , uint8_t Address )
-{
-	/*Send Start Condition*/
-	I2C_Send_Start_Condition(Config->I2C_Num);
+			GPIO_u8ReadPinValue(Pins->SDA_Port, Pins->SDA_Pin, &SDA_Value);
+		}
 
-	/*Send Slave Address With Read Signal (LSB = 1)*/
-	I2Cs[Config->I2C_Num]->I2C_DR = ( Address );
+		/*Generate Stop : SDA Low to High While SCL is High*/
+		GPIO_u8SetPinValue(Pins->SCL_Port, Pins->SCL_Pin, PIN_LOW);
+		I2C_Delay_us(I2C_RECOVERY_HALF_US);
+		GPIO_u8SetPinValue(Pins->SDA_Port, Pins->SDA_Pin, PIN_LOW);
+		I2C_Delay_us(I2C_RECOVERY_HALF_US);
+		GPIO_u8SetPinValue(Pins->SCL_Port, Pins->SCL_Pin, PIN_HIGH);
+		I2C_Delay_us(I2C_RECOVERY_HALF_US);
+		GPIO_u8SetPinValue(Pins->SDA_Port, Pins->SDA_Pin, PIN_HIGH);
+		I2C_Delay_us(I2C_RECOVERY_HALF_US);
 
-	/*Enable ACK*/
-	SET_BIT(I2Cs[I2C_NUMBER_1]->I2C_CR1,10);
+		GPIO_u8ReadPinValue(Pins->SDA_Port, Pins->SDA_Pin, &SDA_Value);
 
-	/*Wait Till Address is Sent*/
-	while (!(GET_BIT(I2Cs[I2C_NUMBER_1]->I2C_SR1,FLAGS_SR1_ADDR)));
+		if (PIN_LOW == SDA_Value)
+		{
+			Error_State = I2C_BUS_ERROR;
+		}
 
-	/*Clear ADDR*/
-	I2C_CLR_ADDR(I2C_NUMBER_1) ;
+		/*Give the Pins Back to I2C*/
+		Pin.Mode = ALTERNATE_FUNCTION;
+		Pin.AltFunc = Pins->AltFunc;
 
-}
+		Pin.Port = Pins->SCL_Port;
+		Pin.PinNum = Pins->SCL_Pin;
+		GPIO_u8PinInit(&Pin);
 
+		Pin.Port = Pins->SDA_Port;
+		Pin.PinNum = Pins->SDA_Pin;
+		GPIO_u8PinInit(&Pin);
 
-/************** End of STATIC FUNCTIONS ****************/
+		/*Software Reset Clears BUSY & the Internal State , Then Restore Configurations*/
+		I2Cs[I2C_Num]->I2C_CR1 |= (1<<SWRST_BIT);
+		I2Cs[I2C_Num]->I2C_CR1 &= ~(1<<SWRST_BIT);
+
+		I2C_Init(I2C_Init_Configs[I2C_Num]);
+
+		/*Update Statistics*/
+		if (OK == Error_State)
+		{
+			I2C_Stats[I2C_Num].Recoveries++;
+		}
+		else
+		{
+			I2C_Stats[I2C_Num].FailedRecoveries++;
+		}
+
+		I2C_Stats[I2C_Num].LastRecovery_us = I2C_Elapsed_us(Start);
+
+		if (I2C_Stats[I2C_Num].LastRecovery_us > I2C_Stats[I2C_Num].MaxRecovery_us)
+		{
+			I2C_Stats[I2C_Num].MaxRecovery_us = I2C_Stats[I2C_Num].LastRecovery_us;
+		}
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	I2C_Get_Stats
+ * @brief			:	Get Error & Recovery Statistics of the I2C
+ * @param			:	I2C Number
+ * @param			:	Structure to Save the Statistics in
+ * @retval			:	Error State
+ */
+Error_State_t I2C_Get_Stats(I2C_I2C_NUMBER_t I2C_Num , I2C_Stats_t * Stats)
+{
+	Error_State_t Error_State = OK ;
+
+	uint32_t PriMask = 0 ;
+
+	if (NULL == Stats)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if ((I2C_Num >= I2C_NUMBER_1)&&(I2C_Num <= I2C_NUMBER_3))
+	{
+		/*Counters are Updated From Interrupts*/
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		*Stats = I2C_Stats[I2C_Num];
+
+		EXIT_CRITICAL_SECTION(PriMask);
+	}
+	else {
+		Error_State = I2C_WRONG_I2C_NUMBER;
+	}
+	return Error_State ;
+}
+/***************End of MAIN FUNCTIONS*******************/
+
+
+
+/***************** STATIC FUNCTIONS ********************/
+
+/*
+ * @function 		:	I2C_Set_SCL_Frequency
+ * @brief			:	Set SCL Frequency of the wanted I2C
+ * @param			:	I2C Configurations
+ * @retval			:	Error State
+ */
+static void I2C_Set_SCL_Frequency(const I2C_Configs_t * I2C_Configs)
+{
+	I2C_Timing_t Timing = I2C_Get_Timing(I2C_Configs);
+
+	uint32_t PE_State = 0;
+
+	/*Nothing to Do if the Bus Already Runs at this Speed*/
+	if ((Timing.CCR != I2C_Current_Timing[I2C_Configs->I2C_Num].CCR) || (Timing.TRISE != I2C_Current_Timing[I2C_Configs->I2C_Num].TRISE))
+	{
+		/*CCR Can be Written Only When I2C is Disabled*/
+		PE_State = I2Cs[I2C_Configs->I2C_Num]->I2C_CR1 & (1<<PE_BIT);
+		I2Cs[I2C_Configs->I2C_Num]->I2C_CR1 &= ~(1<<PE_BIT);
+
+		/*Set Mode , Duty & CCR Register Value*/
+		I2Cs[I2C_Configs->I2C_Num]->I2C_CCR &= ~(CCR_MASK);
+		I2Cs[I2C_Configs->I2C_Num]->I2C_CCR |= Timing.CCR ;
+
+		/*Set Maximum Rise Time*/
+		I2Cs[I2C_Configs->I2C_Num]->I2C_TRISE &= ~(TRISE_MASK);
+		I2Cs[I2C_Configs->I2C_Num]->I2C_TRISE |= Timing.TRISE ;
+
+		I2Cs[I2C_Configs->I2C_Num]->I2C_CR1 |= PE_State;
+
+		I2C_Current_Timing[I2C_Configs->I2C_Num] = Timing;
+	}
+}
+
+/*
+ * @function 		:	I2C_Get_Timing
+ * @brief			:	Get CCR & TRISE Values of the Wanted Speed , From the Timing Table for
+ * 						Maximum Speed of the Mode (100 / 400 KHz) or Calculated for Lower Speeds
+ * @param			:	I2C Configurations
+ * @retval			:	CCR & TRISE Values
+ */
+static I2C_Timing_t I2C_Get_Timing(const I2C_Configs_t * I2C_Configs)
+{
+	I2C_Timing_t Timing;
+
+	I2C_SPEED_t Speed = I2C_SPEED_STANDARD;
+
+	uint8_t	Pclk = I2C_Configs->I2C_Pclk_MHZ;
+
+	if (MASTER_MODE_FAST == I2C_Configs->I2C_Mode)
+	{
+		Speed = (FM_DUTY_16_9 == I2C_Configs->FM_Duty) ? I2C_SPEED_FAST_DUTY_16_9 : I2C_SPEED_FAST_DUTY_2;
+	}
+
+	if (((I2C_SPEED_STANDARD == Speed) && (I2C_STANDARD_MAX_KHZ == I2C_Configs->SCL_Frequency_KHZ)) ||
+		((I2C_SPEED_STANDARD != Speed) && (I2C_FAST_MAX_KHZ == I2C_Configs->SCL_Frequency_KHZ)))
+	{
+		Timing = I2C_Timing_Table[Pclk][Speed];
+	}
+	else
+	{
+		switch (Speed)
+		{
+		case I2C_SPEED_FAST_DUTY_2:
+			Timing.CCR		= (1<<I2C_MODE_BIT) | I2C_CCR_FAST_DUTY_2(Pclk, I2C_Configs->SCL_Frequency_KHZ);
+			Timing.TRISE	= I2C_TRISE_FAST(Pclk);
+			break;
+
+		case I2C_SPEED_FAST_DUTY_16_9:
+			Timing.CCR		= (1<<I2C_MODE_BIT) | (1<<DUTY_BIT) | I2C_CCR_FAST_DUTY_16_9(Pclk, I2C_Configs->SCL_Frequency_KHZ);
+			Timing.TRISE	= I2C_TRISE_FAST(Pclk);
+			break;
+
+		default:
+			Timing.CCR		= I2C_CCR_STANDARD(Pclk, I2C_Configs->SCL_Frequency_KHZ);
+			Timing.TRISE	= I2C_TRISE_STANDARD(Pclk);
+			break;
+		}
+	}
+	return Timing ;
+}
+
+/*
+ * @function 		:	I2C_CheckConfigs
+ * @brief			:	Check I2c Configurations
+ * @param			:	I2C Configurations
+ * @retval			:	Error State
+ */
+static Error_State_t I2C_CheckConfigs(const I2C_Configs_t * I2C_Configs)
+{
+	Error_State_t Error_State=OK;
+
+	if (NULL != I2C_Configs)
+	{
+
+		if ( (I2C_Configs->ADD_Mode == ADDRESSING_MODE_10BITS) || (I2C_Configs->ADD_Mode == ADDRESSING_MODE_7BITS))
+		{
+			if ( (I2C_Configs->Chip_Address > 0) && (I2C_Configs->Chip_Address < 128))
+			{
+				if ((I2C_Configs->I2C_Mode == MASTER_MODE_STANDARD) || (I2C_Configs->I2C_Mode == MASTER_MODE_FAST))
+				{
+					if ((I2C_Configs->I2C_Num >= I2C_NUMBER_1) && (I2C_Configs->I2C_Num <= I2C_NUMBER_3))
+					{
+						if ((I2C_Configs->I2C_Pclk_MHZ <= I2C_MAX_PCLK_MHZ) &&
+							(((I2C_Configs->I2C_Pclk_MHZ >= I2C_STANDARD_MIN_PCLK_MHZ) && (I2C_Configs->I2C_Mode == MASTER_MODE_STANDARD)) ||
+							((I2C_Configs->I2C_Pclk_MHZ >= I2C_FAST_MIN_PCLK_MHZ) && (I2C_Configs->I2C_Mode == MASTER_MODE_FAST))))
+						{
+							if ((I2C_Configs->PEC_State == PACKET_ERR_CHECK_ENABLED) ||(I2C_Configs->PEC_State == PACKET_ERR_CHECK_DISABLED))
+							{
+								if ((I2C_Configs->SCL_Frequency_KHZ > 0) &&
+									(((I2C_Configs->SCL_Frequency_KHZ <=I2C_STANDARD_MAX_KHZ) && (I2C_Configs->I2C_Mode == MASTER_MODE_STANDARD)) ||
+									((I2C_Configs->SCL_Frequency_KHZ <=I2C_FAST_MAX_KHZ) && (I2C_Configs->I2C_Mode == MASTER_MODE_FAST) &&
+									((I2C_Configs->FM_Duty == FM_DUTY_2) || (I2C_Configs->FM_Duty == FM_DUTY_16_9)))))
+								{
+									if ((I2C_Configs->Stretch_state == CLK_STRETCH_ENABLED) ||(I2C_Configs->Stretch_state == CLK_STRETCH_DISABLED))
+									{
+										Error_State	=	OK;
+									}
+									else {
+										Error_State	=	I2C_WRONG_CLK_STRETCH_STATE;
+									}
+								}
+								else {
+									Error_State	=	I2C_WRONG_SCL_FREQUENCY;
+								}
+							}
+							else {
+								Error_State	=	I2C_WRONG_PEC_STATE;
+							}
+						}
+						else {
+							Error_State	=	I2C_WRONG_PCLK;
+						}
+					}
+					else {
+						Error_State	=	I2C_WRONG_I2C_NUMBER;
+					}
+				}
+				else {
+					Error_State	=	I2C_WRONG_I2C_MASTER_MODE;
+				}
+			}
+			else {
+				Error_State	=	I2C_WRONG_ADDRESS_VALUE;
+			}
+		}
+		else{
+			Error_State = I2C_WRONG_ADDRESS_MODE_STATE;
+		}
+	}
+	else {
+		Error_State	=	Null_Pointer;
+	}
+	return Error_State ;
+}
+
+
+/*
+
+@function         :    I2C_CLR_ADDR
+@brief            :    Software sequence to Clear ADDR Flag
+@param            :    I2C Number
+@retval            :    VOID
+ */
+void I2C_CLR_ADDR(I2C_I2C_NUMBER_t I2C_Num)
+{
+	uint32_t Temp_Reg = 0 ;
+
+	Temp_Reg = I2Cs[I2C_Num]->I2C_SR1;
+	Temp_Reg = I2Cs[I2C_Num]->I2C_SR2;
+
+
+}
+
+
+/*
+
+@function         :    I2C_SendAddressPacketMTransmitter
+@brief            :    Send Address Packet
+@param            :    Pointer to I2c Config Structure
+@param            :    Address to Send
+@retval           :    Error State
+ */
+Error_State_t I2C_SendAddressPacketMTransmitter( I2C_Configs_t * Config , uint8_t Address )
+{
+	Error_State_t Error_State = OK ;
+
+	/*Wait till Bus is FREE (Not busy)*/
+	Error_State = I2C_Wait_Flag(Config->I2C_Num, &(I2Cs[Config->I2C_Num]->I2C_SR2), FLAGS_SR2_BUSY, FLAG_RESET);
+
+	if (TIME_OUT_ERROR == Error_State)
+	{
+		I2C_Count_Error(Config->I2C_Num, Error_State);
+		Error_State = I2C_Bus_Recovery(Config->I2C_Num);
+	}
+
+	if (OK == Error_State)
+	{
+		/*Enable I2C*/
+		I2Cs[Config->I2C_Num]->I2C_CR1 |= (1<<0);
+
+		/*Send Start Condition*/
+		Error_State = I2C_Send_Start_Condition(Config->I2C_Num);
+	}
+
+	if (OK == Error_State)
+	{
+		/*Send Slave Address With Write Signal (LSB = 0)*/
+		I2Cs[Config->I2C_Num]->I2C_DR = (Address);
+
+		/*Wait Till Address is Sent*/
+		Error_State = I2C_Wait_Flag(Config->I2C_Num, &(I2Cs[Config->I2C_Num]->I2C_SR1), FLAGS_SR1_ADDR, FLAG_SET);
+
+		if (OK == Error_State)
+		{
+			/*Clear ADDR*/
+			I2C_CLR_ADDR(Config->I2C_Num) ;
+		}
+		else
+		{
+			I2C_Blocking_Error(Config->I2C_Num, Error_State);
+		}
+	}
+	return Error_State ;
+}
+
+
+/*
+
+@function         :    I2C_SendDataPacket
+@brief            :    Send Data Packet
+@param            :    Pointer to I2c Config Structure
+@param            :    Data to Send
+@retval           :    Error State
+ */
+Error_State_t I2C_SendDataPacket(I2C_Configs_t * Config , uint8_t Data )
+{
+	Error_State_t Error_State = OK ;
+
+	/*wait till TxD Register empty*/
+	Error_State = I2C_Wait_Flag(Config->I2C_Num, &(I2Cs[Config->I2C_Num]->I2C_SR1), FLAGS_SR1_TXE, FLAG_SET);
+
+	if (OK == Error_State)
+	{
+		/*Write data in DR*/
+		I2Cs[Config->I2C_Num]->I2C_DR = Data;
+
+		/*wait till Byte transfer is finished*/
+		Error_State = I2C_Wait_Flag(Config->I2C_Num, &(I2Cs[Config->I2C_Num]->I2C_SR1), FLAGS_SR1_BTF, FLAG_SET);
+	}
+
+	if (OK != Error_State)
+	{
+		I2C_Blocking_Error(Config->I2C_Num, Error_State);
+	}
+	return Error_State ;
+}
+
+/*
+
+@function         :    I2C_SendAddressPacketMReceiver
+@brief            :    Send Address Packet
+@param            :    Pointer to I2c Config Structure
+@param            :    Address to Send
+@retval           :    Error State
+ */
+Error_State_t I2C_SendAddressPacketMReceiver( I2C_Configs_t * Config , uint8_t Address )
+{
+	Error_State_t Error_State = OK ;
+
+	/*Send Start Condition*/
+	Error_State = I2C_Send_Start_Condition(Config->I2C_Num);
+
+	if (OK == Error_State)
+	{
+		/*Send Slave Address With Read Signal (LSB = 1)*/
+		I2Cs[Config->I2C_Num]->I2C_DR = ( Address );
+
+		/*Enable ACK*/
+		SET_BIT(I2Cs[Config->I2C_Num]->I2C_CR1,ACK_STATE_BIT);
+
+		/*Wait Till Address is Sent*/
+		Error_State = I2C_Wait_Flag(Config->I2C_Num, &(I2Cs[Config->I2C_Num]->I2C_SR1), FLAGS_SR1_ADDR, FLAG_SET);
+
+		if (OK == Error_State)
+		{
+			/*Clear ADDR*/
+			I2C_CLR_ADDR(Config->I2C_Num) ;
+		}
+		else
+		{
+			I2C_Blocking_Error(Config->I2C_Num, Error_State);
+		}
+	}
+	return Error_State ;
+}
+
+
+/*
+ * @function 		:	I2C_CheckTransaction
+ * @brief			:	Check Transaction Descriptor
+ * @param			:	Transaction Descriptor
+ * @retval			:	Error State
+ */
+static Error_State_t I2C_CheckTransaction(const I2C_Transaction_t * Transaction)
+{
+	Error_State_t Error_State = I2C_CheckConfigs(Transaction->Device);
+
+	if (OK == Error_State)
+	{
+		if (((0 == Transaction->TxSize) && (0 == Transaction->RxSize)) ||
+			((0 != Transaction->TxSize) && (NULL == Transaction->TxData)) ||
+			((0 != Transaction->RxSize) && (NULL == Transaction->RxData)))
+		{
+			Error_State = Null_Pointer;
+		}
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	I2C_Submit_Default
+ * @brief			:	Fill the Default Transaction of the I2C (Used by the Non Descriptor Functions) & Queue it
+ * @param			:	I2C Configurations
+ * @param			:	Slave Address
+ * @param			:	Data buffer to be send
+ * @param			:	Number of Bytes to be send
+ * @param			:	Buffer to save Received data
+ * @param			:	Number of Bytes to be received
+ * @param			:	ENABLED to Receive by DMA , DISABLED to Receive by Interrupts
+ * @param			:	CallBack Function
+ * @retval			:	Error State
+ */
+static Error_State_t I2C_Submit_Default(const I2C_Configs_t * I2C_Configs , uint8_t SlaveADD , const uint8_t * TxData , uint8_t TxSize , uint8_t * RxData , uint8_t RxSize , uint8_t UseDMA , void (* I2C_CallBackFunc)(void))
+{
+	Error_State_t	Error_State = OK;
+
+	I2C_Transaction_t * Transaction = NULL;
+
+	uint32_t PriMask = 0 ;
+
+	Error_State = I2C_CheckConfigs(I2C_Configs);
+
+	if (OK == Error_State)
+	{
+		Transaction = &I2C_Default_Transactions[I2C_Configs->I2C_Num];
+
+		if (((0 == TxSize) && (0 == RxSize)) || ((0 != TxSize) && (NULL == TxData)) || ((0 != RxSize) && (NULL == RxData)))
+		{
+			Error_State = Null_Pointer;
+		}
+		else
+		{
+			/*Only One Default Transfer Per I2C Can be Queued at a Time*/
+			ENTER_CRITICAL_SECTION(PriMask);
+
+			if (I2C_TRANSFER_BUSY == Transaction->Status)
+			{
+				Error_State = I2C_TRANSFER_BUSY;
+			}
+			else
+			{
+				Transaction->Status = I2C_TRANSFER_BUSY;
+			}
+
+			EXIT_CRITICAL_SECTION(PriMask);
+		}
+	}
+
+	if (OK == Error_State)
+	{
+		Transaction->Device			= I2C_Configs;
+		Transaction->SlaveADD		= SlaveADD;
+		Transaction->TxData			= TxData;
+		Transaction->TxSize			= TxSize;
+		Transaction->RxData			= RxData;
+		Transaction->RxSize			= RxSize;
+		Transaction->RepeatedStart	= ENABLED;
+		Transaction->UseDMA			= UseDMA;
+		Transaction->Timeout_ms		= I2C_TRANSFER_TIMEOUT_MS;
+		Transaction->CallBackFunc	= &I2C_Default_CallBack;
+
+		I2C_Default_CallBacks[I2C_Configs->I2C_Num] = I2C_CallBackFunc;
+
+		Error_State = I2C_Enqueue(Transaction);
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	I2C_Default_CallBack
+ * @brief			:	Call the User CallBack of the Default Transaction
+ * @param			:	Finished Transaction
+ * @retval			:	VOID
+ */
+static void I2C_Default_CallBack(I2C_Transaction_t * Transaction)
+{
+	if (NULL != I2C_Default_CallBacks[Transaction->Device->I2C_Num])
+	{
+		I2C_Default_CallBacks[Transaction->Device->I2C_Num]();
+	}
+}
+
+/*
+ * @function 		:	I2C_Enqueue
+ * @brief			:	Add a Claimed Transaction to the Queue of its I2C & Start it if the I2C is Idle
+ * @param			:	Transaction Descriptor
+ * @retval			:	Error State
+ */
+static Error_State_t I2C_Enqueue(I2C_Transaction_t * Transaction)
+{
+	Error_State_t Error_State = OK ;
+
+	I2C_Transfer_t * Transfer = &I2C_Transfers[Transaction->Device->I2C_Num];
+
+	uint32_t PriMask = 0 ;
+
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	if (I2C_QUEUE_SIZE == Transfer->QueueCount)
+	{
+		Transaction->Status = I2C_QUEUE_FULL;
+
+		Error_State = I2C_QUEUE_FULL;
+	}
+	else
+	{
+		Transfer->Queue[(Transfer->QueueHead + Transfer->QueueCount) % I2C_QUEUE_SIZE] = Transaction;
+		Transfer->QueueCount++;
+
+		if (NULL == Transfer->Transaction)
+		{
+			I2C_Start_Next(Transaction->Device->I2C_Num);
+		}
+	}
+
+	EXIT_CRITICAL_SECTION(PriMask);
+
+	return Error_State ;
+}
+
+/*
+ * @function 		:	I2C_Start_Next
+ * @brief			:	Take the Next Transaction From the Queue & Send Start , the Rest is Done by the Event Handler
+ * @param			:	I2C Number
+ * @retval			:	VOID
+ * @Note			:	Called With Interrupts Disabled or From I2C / DMA Interrupt Context
+ */
+static void I2C_Start_Next(I2C_I2C_NUMBER_t I2C_Num)
+{
+	I2C_Transfer_t * Transfer = &I2C_Transfers[I2C_Num];
+
+	I2C_Transaction_t * Transaction = NULL;
+
+	/*Nothing Starts on a Bus Waiting For Recovery*/
+	while ((I2C_RECOVERY_NONE == Transfer->Recovery) && (NULL == Transfer->Transaction) && (0 != Transfer->QueueCount))
+	{
+		Transaction = Transfer->Queue[Transfer->QueueHead];
+		Transfer->QueueHead = (Transfer->QueueHead + 1) % I2C_QUEUE_SIZE;
+		Transfer->QueueCount--;
+
+		/*Set Transfer Context*/
+		Transfer->Transaction	= Transaction;
+		Transfer->TxIndex		= 0;
+		Transfer->RxIndex		= 0;
+		Transfer->Start_Cycles	= DWT->CYCCNT;
+
+		/*LAST Bit Needs at Least 2 Bytes , a Single Byte is Received by Interrupt*/
+		Transfer->UseDMA		= ((ENABLED == Transaction->UseDMA) && (Transaction->RxSize >= 2)) ? ENABLED : DISABLED;
+
+		/*Start With Write Phase if there are Bytes to Send , Else Start Reading Directly*/
+		Transfer->State = (0 != Transaction->TxSize) ? I2C_STATE_START_TX : I2C_STATE_START_RX;
+
+		if ((ENABLED == Transfer->UseDMA) && (OK != I2C_DMA_Start_RX(I2C_Num, Transaction->RxData, Transaction->RxSize)))
+		{
+			/*Report it & Try the Next One*/
+			I2C_End_Transfer(I2C_Num, I2C_DMA_ERROR);
+		}
+		else if (OK != I2C_Send_Start(I2C_Num))
+		{
+			/*The Previous Stop Never Ended , the Bus is Held*/
+			I2C_Abort_Transfer(I2C_Num);
+		}
+		else
+		{
+			/*Started , the Rest is Done by the Event Handler*/
+		}
+	}
+}
+
+/*
+ * @function 		:	I2C_Send_Start
+ * @brief			:	Configure the I2C For the Running Transaction & Send (Repeated) Start Once the Stop of the
+ * 						Previous Transfer is Sent
+ * @param			:	I2C Number
+ * @retval			:	Error State (TIME_OUT_ERROR if the STOP Bit is Not Cleared Within I2C_STOP_TIMEOUT_US)
+ * @Note			:	Called From Interrupt Context Too , So Queued Transactions Follow Each Other Back to Back ,
+ * 						the Wait is Bounded to a Few SCL Periods
+ */
+static Error_State_t I2C_Send_Start(I2C_I2C_NUMBER_t I2C_Num)
+{
+	Error_State_t Error_State = OK ;
+
+	I2C_Transfer_t * Transfer = &I2C_Transfers[I2C_Num];
+
+	uint32_t Start = DWT->CYCCNT;
+
+	/*CR1 Must Not be Written While the Stop of the Previous Transfer is Pending*/
+	while ((GET_BIT(I2Cs[I2C_Num]->I2C_CR1,STOP_GENERATE_BIT)) && (I2C_Elapsed_us(Start) < I2C_STOP_TIMEOUT_US));
+
+	if (GET_BIT(I2Cs[I2C_Num]->I2C_CR1,STOP_GENERATE_BIT))
+	{
+		Error_State = TIME_OUT_ERROR;
+	}
+	else
+	{
+		/*Switch the Bus to the Speed of this Device*/
+		I2C_Set_SCL_Frequency(Transfer->Transaction->Device);
+
+		/*Enable I2C*/
+		I2Cs[I2C_Num]->I2C_CR1 |= (1<<PE_BIT);
+
+		/*Enable ACK , POS is Set Only by a 2 Bytes Read*/
+		I2Cs[I2C_Num]->I2C_CR1 &= ~(1<<POS_BIT);
+		I2Cs[I2C_Num]->I2C_CR1 |= (1<<ACK_STATE_BIT);
+
+		/*Enable Event & Error Interrupts (Buffer Interrupt is Enabled After Address Phase)*/
+		I2Cs[I2C_Num]->I2C_CR2 |= ((1<<I2C_INTERRUPTS_ERRIE)|(1<<I2C_INTERRUPTS_EVEIE));
+
+		/*Send Start Condition , the Rest is Done in the Event Handler*/
+		I2Cs[I2C_Num]->I2C_CR1 |= (1<<START_GENERATE_BIT);
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	I2C_DMA_Start_RX
+ * @brief			:	Arm the Receive DMA Stream of the I2C , Requests Start Only When DMAEN is Set in the Address Phase
+ * @param			:	I2C Number
+ * @param			:	Buffer to save Received data
+ * @param			:	Number of Bytes to be received
+ * @retval			:	Error State
+ */
+static Error_State_t I2C_DMA_Start_RX(I2C_I2C_NUMBER_t I2C_Num , uint8_t * RxData , uint8_t RxSize)
+{
+	Error_State_t Error_State = OK ;
+
+	DMA_INIT_STRUCT_t * DMA_Config = &I2C_DMA_RX_Configs[I2C_Num];
+
+	if (0 == I2C_DMA_RX_Initialized[I2C_Num])
+	{
+		DMA_Init(DMA_Config);
+		DMA_SetCallBack(DMA_Config, DMA_TRANSFER_CMP_CALLBACK, I2C_DMA_RX_CpltCallBacks[I2C_Num]);
+		DMA_SetCallBack(DMA_Config, DMA_TRANSFER_ERROR_CALLBACK, I2C_DMA_RX_ErrorCallBacks[I2C_Num]);
+
+		I2C_DMA_RX_Initialized[I2C_Num] = 1;
+	}
+
+	if (DMA_NOK == DMA_StartTransfer(DMA_Config, (uint32_t *)&(I2Cs[I2C_Num]->I2C_DR), (uint32_t *)RxData, RxSize))
+	{
+		Error_State = I2C_DMA_ERROR;
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	I2C_DMA_RX_Done
+ * @brief			:	End of the DMA Read Phase , Send Stop & End the Transfer
+ * @param			:	I2C Number
+ * @param			:	OK on Transfer Complete , I2C_DMA_ERROR on DMA Transfer Error
+ * @retval			:	VOID
+ */
+static void I2C_DMA_RX_Done(I2C_I2C_NUMBER_t I2C_Num , Error_State_t Status)
+{
+	/*Last Byte is Already NACKed by the Hardware (LAST Bit)*/
+	I2Cs[I2C_Num]->I2C_CR1 |= (1<<STOP_GENERATE_BIT);
+
+	I2C_End_Transfer(I2C_Num, Status);
+}
+
+/*
+ * @function 		:	I2C_EV_Handler
+ * @brief			:	Event Interrupt State Machine of the Interrupt Driven Transfer
+ * @param			:	I2C Number
+ * @retval			:	VOID
+ */
+static void I2C_EV_Handler(I2C_I2C_NUMBER_t I2C_Num)
+{
+	I2C_Transfer_t * Transfer = &I2C_Transfers[I2C_Num];
+
+	I2C_Transaction_t * Transaction = Transfer->Transaction;
+
+	/*Reading SR1 is the First Step of Clearing SB & ADDR*/
+	uint32_t SR1 = I2Cs[I2C_Num]->I2C_SR1;
+
+	/*Bytes Left to Read*/
+	uint8_t Remaining = 0;
+
+	if (NULL == Transaction)
+	{
+		/*No Running Transaction => Spurious Event*/
+		I2Cs[I2C_Num]->I2C_CR2 &= ~(I2C_TRANSFER_IT_MASK);
+	}
+	else if (GET_BIT(SR1,FLAGS_SR1_SB))
+	{
+		/*Start Generated => Send Slave Address (Writing DR Clears SB)*/
+		if (I2C_STATE_START_TX == Transfer->State)
+		{
+			I2Cs[I2C_Num]->I2C_DR = (Transaction->SlaveADD & (~I2C_READ_BIT));
+		}
+		else
+		{
+			I2Cs[I2C_Num]->I2C_DR = (Transaction->SlaveADD | I2C_READ_BIT);
+		}
+	}
+	else if (GET_BIT(SR1,FLAGS_SR1_ADDR))
+	{
+		if (I2C_STATE_START_TX == Transfer->State)
+		{
+			Transfer->State = I2C_STATE_TRANSMIT;
+
+			I2C_CLR_ADDR(I2C_Num);
+		}
+		else
+		{
+			Transfer->State = I2C_STATE_RECEIVE;
+
+			if (ENABLED == Transfer->UseDMA)
+			{
+				/*DMA Reads the Bytes , LAST Makes the Hardware NACK the Last One*/
+				I2Cs[I2C_Num]->I2C_CR1 |= (1<<ACK_STATE_BIT);
+
+				I2Cs[I2C_Num]->I2C_CR2 |= ((1<<DMAEN_BIT)|(1<<LAST_BIT));
+
+				I2C_CLR_ADDR(I2C_Num);
+			}
+			else if (1 == Transaction->RxSize)
+			{
+				/*Single Byte => NACK it & Program Stop Before Clearing ADDR*/
+				I2Cs[I2C_Num]->I2C_CR1 &= ~(1<<ACK_STATE_BIT);
+
+				I2C_CLR_ADDR(I2C_Num);
+
+				I2Cs[I2C_Num]->I2C_CR1 |= (1<<STOP_GENERATE_BIT);
+			}
+			else if (2 == Transaction->RxSize)
+			{
+				/*Two Bytes => POS Moves the ACK Bit to the Next Byte , Cleared After ADDR the Second Byte is NACKed*/
+				I2Cs[I2C_Num]->I2C_CR1 |= ((1<<POS_BIT)|(1<<ACK_STATE_BIT));
+
+				I2C_CLR_ADDR(I2C_Num);
+
+				I2Cs[I2C_Num]->I2C_CR1 &= ~(1<<ACK_STATE_BIT);
+			}
+			else
+			{
+				I2Cs[I2C_Num]->I2C_CR1 |= (1<<ACK_STATE_BIT);
+
+				I2C_CLR_ADDR(I2C_Num);
+			}
+		}
+
+		/*Data Phase is Driven by TXE / RXNE Unless Received by DMA ,
+		  the Last I2C_RX_BTF_BYTES of a Read are Driven by BTF Only*/
+		if ((I2C_STATE_RECEIVE != Transfer->State) ||
+			((DISABLED == Transfer->UseDMA) && ((1 == Transaction->RxSize) || (Transaction->RxSize > I2C_RX_BTF_BYTES))))
+		{
+			I2Cs[I2C_Num]->I2C_CR2 |= (1<<I2C_INTERRUPTS_BUFIE);
+		}
+	}
+	else if (I2C_STATE_TRANSMIT == Transfer->State)
+	{
+		if ((GET_BIT(SR1,FLAGS_SR1_TXE)) && (Transfer->TxIndex < Transaction->TxSize))
+		{
+			I2Cs[I2C_Num]->I2C_DR = Transaction->TxData[Transfer->TxIndex++];
+
+			if (Transfer->TxIndex == Transaction->TxSize)
+			{
+				/*Last Byte is Loaded , Wait BTF Only (TXE Would Keep Firing)*/
+				I2Cs[I2C_Num]->I2C_CR2 &= ~(1<<I2C_INTERRUPTS_BUFIE);
+			}
+		}
+		else if (GET_BIT(SR1,FLAGS_SR1_BTF))
+		{
+			if (0 != Transaction->RxSize)
+			{
+				Transfer->State = I2C_STATE_START_RX;
+
+				if (DISABLED == Transaction->RepeatedStart)
+				{
+					/*Release the Bus Between Write & Read Phases , the Start Follows Once the Stop is Sent*/
+					I2Cs[I2C_Num]->I2C_CR1 |= (1<<STOP_GENERATE_BIT);
+
+					if (OK != I2C_Send_Start(I2C_Num))
+					{
+						I2C_Abort_Transfer(I2C_Num);
+					}
+				}
+				else
+				{
+					/*Repeated Start to Switch to Read Phase*/
+					I2Cs[I2C_Num]->I2C_CR1 |= (1<<START_GENERATE_BIT);
+				}
+			}
+			else
+			{
+				I2Cs[I2C_Num]->I2C_CR1 |= (1<<STOP_GENERATE_BIT);
+
+				I2C_End_Transfer(I2C_Num, OK);
+			}
+		}
+	}
+	else if (I2C_STATE_RECEIVE == Transfer->State)
+	{
+		Remaining = Transaction->RxSize - Transfer->RxIndex;
+
+		if ((Remaining > I2C_RX_BTF_BYTES) && (GET_BIT(SR1,FLAGS_SR1_RXNE)))
+		{
+			Transaction->RxData[Transfer->RxIndex++] = I2Cs[I2C_Num]->I2C_DR;
+
+			if ((Remaining - 1) == I2C_RX_BTF_BYTES)
+			{
+				/*Wait BTF From Now , the Clock is Stretched Till the Bytes are Read So a Late Interrupt Cannot Over-Run*/
+				I2Cs[I2C_Num]->I2C_CR2 &= ~(1<<I2C_INTERRUPTS_BUFIE);
+			}
+		}
+		else if ((I2C_RX_BTF_BYTES == Remaining) && (GET_BIT(SR1,FLAGS_SR1_BTF)))
+		{
+			/*Byte N-2 in DR & N-1 in Shift Register => NACK Byte N , Then Read N-2*/
+			I2Cs[I2C_Num]->I2C_CR1 &= ~(1<<ACK_STATE_BIT);
+
+			Transaction->RxData[Transfer->RxIndex++] = I2Cs[I2C_Num]->I2C_DR;
+		}
+		else if ((2 == Remaining) && (GET_BIT(SR1,FLAGS_SR1_BTF)))
+		{
+			/*Byte N-1 in DR & N in Shift Register => Program Stop , Then Read Both*/
+			I2Cs[I2C_Num]->I2C_CR1 |= (1<<STOP_GENERATE_BIT);
+
+			Transaction->RxData[Transfer->RxIndex++] = I2Cs[I2C_Num]->I2C_DR;
+			Transaction->RxData[Transfer->RxIndex++] = I2Cs[I2C_Num]->I2C_DR;
+
+			I2C_End_Transfer(I2C_Num, OK);
+		}
+		else if ((1 == Remaining) && (GET_BIT(SR1,FLAGS_SR1_RXNE)))
+		{
+			/*Single Byte Read , NACK & Stop Were Programmed in the Address Phase*/
+			Transaction->RxData[Transfer->RxIndex++] = I2Cs[I2C_Num]->I2C_DR;
+
+			I2C_End_Transfer(I2C_Num, OK);
+		}
+	}
+	else
+	{
+		/*Unexpected Event => Do Nothing*/
+	}
+}
+
+/*
+ * @function 		:	I2C_ER_Handler
+ * @brief			:	Error Interrupt Handling (AF / BERR / ARLO / OVR) of the Interrupt Driven Transfer
+ * @param			:	I2C Number
+ * @retval			:	VOID
+ */
+static void I2C_ER_Handler(I2C_I2C_NUMBER_t I2C_Num)
+{
+	Error_State_t Error_State = NOK;
+
+	uint32_t SR1 = I2Cs[I2C_Num]->I2C_SR1;
+
+	Error_State = I2C_SR1_Error(SR1);
+
+	if (OK == Error_State)
+	{
+		Error_State = NOK;
+	}
+
+	I2C_Count_Error(I2C_Num, Error_State);
+
+	/*Clear Error Flags (rc_w0)*/
+	I2Cs[I2C_Num]->I2C_SR1 &= ~(I2C_ERROR_FLAGS_MASK);
+
+	/*Release the Bus Unless Arbitration is Lost (Hardware Already Went Back to Slave)*/
+	if (!(GET_BIT(SR1,FLAGS_SR1_ARLO)))
+	{
+		I2Cs[I2C_Num]->I2C_CR1 |= (1<<STOP_GENERATE_BIT);
+	}
+
+	I2C_End_Transfer(I2C_Num, Error_State);
+}
+
+/*
+ * @function 		:	I2C_End_Transfer
+ * @brief			:	Disable Transfer Interrupts , Save the Result & Call the User CallBack
+ * @param			:	I2C Number
+ * @param			:	Result of the Transfer
+ * @retval			:	VOID
+ */
+static void I2C_End_Transfer(I2C_I2C_NUMBER_t I2C_Num , Error_State_t Status)
+{
+	I2C_Transfer_t * Transfer = &I2C_Transfers[I2C_Num];
+
+	I2C_Transaction_t * Transaction = Transfer->Transaction;
+
+	/*Disable Transfer Interrupts*/
+	I2Cs[I2C_Num]->I2C_CR2 &= ~(I2C_TRANSFER_IT_MASK);
+
+	if (ENABLED == Transfer->UseDMA)
+	{
+		/*Release DMA Requests & Stop the Stream if the Transfer Ended Early*/
+		I2Cs[I2C_Num]->I2C_CR2 &= ~((1<<DMAEN_BIT)|(1<<LAST_BIT));
+
+		DMA_DisableStream(I2C_DMA_RX_Configs[I2C_Num].DMAController, I2C_DMA_RX_Configs[I2C_Num].StreamNumber);
+
+		Transfer->UseDMA = DISABLED;
+	}
+
+	Transfer->State  = (OK == Status) ? I2C_STATE_IDLE : I2C_STATE_ERROR;
+	Transfer->Transaction = NULL;
+
+	if (NULL != Transaction)
+	{
+		Transaction->Status = Status;
+
+		if (NULL != Transaction->CallBackFunc)
+		{
+			Transaction->CallBackFunc(Transaction);
+		}
+	}
+
+	/*Execute the Next Queued Transaction (if the CallBack Did Not Already Start One)*/
+	I2C_Start_Next(I2C_Num);
+}
+
+/*
+ * @function 		:	I2C_Wait_Flag
+ * @brief			:	Wait Till a Status Flag Reaches a State , Bounded by I2C_TIMEOUT_MS &
+ * 						Stopped Early by an Error Flag in SR1
+ * @param			:	I2C Number
+ * @param			:	Status Register (SR1 / SR2)
+ * @param			:	Flag Bit Number
+ * @param			:	Wanted Flag State (FLAG_SET / FLAG_RESET)
+ * @retval			:	Error State (TIME_OUT_ERROR , I2C_ACK_FAILURE , I2C_BUS_ERROR , I2C_ARBITRATION_LOST)
+ */
+static Error_State_t I2C_Wait_Flag(I2C_I2C_NUMBER_t I2C_Num , volatile uint32_t * Reg , uint8_t Flag , uint8_t State)
+{
+	Error_State_t Error_State = OK ;
+
+	uint32_t Start = DWT->CYCCNT;
+
+	while ((OK == Error_State) && (State != GET_BIT(*Reg,Flag)))
+	{
+		Error_State = I2C_SR1_Error(I2Cs[I2C_Num]->I2C_SR1);
+
+		if ((OK == Error_State) && (I2C_Elapsed_us(Start) >= (I2C_TIMEOUT_MS * 1000UL)))
+		{
+			Error_State = TIME_OUT_ERROR;
+		}
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	I2C_Blocking_Error
+ * @brief			:	Count an Error of a Blocking Function & Leave the Bus Usable : Stop on ACK Failure ,
+ * 						Bus Recovery on Timeout or Bus Error
+ * @param			:	I2C Number
+ * @param			:	Error
+ * @retval			:	The Same Error
+ */
+static Error_State_t I2C_Blocking_Error(I2C_I2C_NUMBER_t I2C_Num , Error_State_t Error_State)
+{
+	I2C_Count_Error(I2C_Num, Error_State);
+
+	/*Clear Error Flags (rc_w0)*/
+	I2Cs[I2C_Num]->I2C_SR1 &= ~(I2C_ERROR_FLAGS_MASK);
+
+	switch (Error_State)
+	{
+	case I2C_ACK_FAILURE:
+		/*Slave is Not Holding the Bus , Release it*/
+		I2Cs[I2C_Num]->I2C_CR1 |= (1<<STOP_GENERATE_BIT);
+		break;
+
+	case TIME_OUT_ERROR:
+	case I2C_BUS_ERROR:
+		I2C_Bus_Recovery(I2C_Num);
+		break;
+
+	default:
+		/*Arbitration Lost => Hardware Already Went Back to Slave*/
+		break;
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	I2C_SR1_Error
+ * @brief			:	Get the Error Indicated by the Error Flags of SR1
+ * @param			:	SR1 Value
+ * @retval			:	Error State (OK if No Error Flag is Set)
+ */
+static Error_State_t I2C_SR1_Error(uint32_t SR1)
+{
+	Error_State_t Error_State = OK ;
+
+	if (GET_BIT(SR1,FLAGS_SR1_AF))
+	{
+		Error_State = I2C_ACK_FAILURE;
+	}
+	else if (GET_BIT(SR1,FLAGS_SR1_BERR))
+	{
+		Error_State = I2C_BUS_ERROR;
+	}
+	else if (GET_BIT(SR1,FLAGS_SR1_ARLO))
+	{
+		Error_State = I2C_ARBITRATION_LOST;
+	}
+	else if (GET_BIT(SR1,FLAGS_SR1_OVR))
+	{
+		Error_State = I2C_OVERRUN;
+	}
+	return Error_State ;
+}
+
+/*
+ * @function 		:	I2C_Count_Error
+ * @brief			:	Increment the Statistics Counter of an Error
+ * @param			:	I2C Number
+ * @param			:	Error
+ * @retval			:	VOID
+ */
+static void I2C_Count_Error(I2C_I2C_NUMBER_t I2C_Num , Error_State_t Error_State)
+{
+	switch (Error_State)
+	{
+	case TIME_OUT_ERROR:		I2C_Stats[I2C_Num].Timeouts++;				break;
+	case I2C_ACK_FAILURE:		I2C_Stats[I2C_Num].AckFailures++;			break;
+	case I2C_BUS_ERROR:			I2C_Stats[I2C_Num].BusErrors++;				break;
+	case I2C_ARBITRATION_LOST:	I2C_Stats[I2C_Num].ArbitrationLosses++;		break;
+	case I2C_OVERRUN:			I2C_Stats[I2C_Num].Overruns++;				break;
+	default:															break;
+	}
+}
+
+/*
+ * @function 		:	I2C_Abort_Transfer
+ * @brief			:	Abort the Running Queued Transaction With a Timeout & Hold the Queue Till the Bus is Recovered
+ * @param			:	I2C Number
+ * @retval			:	VOID
+ * @Note			:	Called With Interrupts Disabled or From I2C Interrupt Context , I2C_Run_Recovery is Called
+ * 						Later With Interrupts Enabled
+ */
+static void I2C_Abort_Transfer(I2C_I2C_NUMBER_t I2C_Num)
+{
+	I2C_Count_Error(I2C_Num, TIME_OUT_ERROR);
+
+	/*Stop Transfer Interrupts Before the Peripheral is Reset*/
+	I2Cs[I2C_Num]->I2C_CR2 &= ~(I2C_TRANSFER_IT_MASK);
+
+	/*The Recovery Takes Up to About 10 ms , it Must Not Run Here*/
+	I2C_Transfers[I2C_Num].Recovery = I2C_RECOVERY_PENDING;
+
+	I2C_End_Transfer(I2C_Num, TIME_OUT_ERROR);
+}
+
+/*
+ * @function 		:	I2C_Cancel_Transaction
+ * @brief			:	End a Transaction With a Timeout : Aborted if it is Running , Taken Out of the Queue if it is Waiting
+ * @param			:	I2C Number
+ * @param			:	Transaction Descriptor
+ * @retval			:	VOID
+ * @Note			:	Called With Interrupts Disabled , a Transaction That Already Ended is Left As it is
+ */
+static void I2C_Cancel_Transaction(I2C_I2C_NUMBER_t I2C_Num , I2C_Transaction_t * Transaction)
+{
+	I2C_Transfer_t * Transfer = &I2C_Transfers[I2C_Num];
+
+	uint8_t Index = 0 ;
+
+	if (Transaction == Transfer->Transaction)
+	{
+		I2C_Abort_Transfer(I2C_Num);
+	}
+	else
+	{
+		/*Find it in the Queue*/
+		while ((Index < Transfer->QueueCount) &&
+			   (Transaction != Transfer->Queue[(Transfer->QueueHead + Index) % I2C_QUEUE_SIZE]))
+		{
+			Index++;
+		}
+
+		if (Index < Transfer->QueueCount)
+		{
+			/*Close the Gap , the Other Transactions Keep Their Order*/
+			for ( ; Index < (Transfer->QueueCount - 1) ; Index++)
+			{
+				Transfer->Queue[(Transfer->QueueHead + Index) % I2C_QUEUE_SIZE] =
+					Transfer->Queue[(Transfer->QueueHead + Index + 1) % I2C_QUEUE_SIZE];
+			}
+			Transfer->QueueCount--;
+
+			I2C_Count_Error(I2C_Num, TIME_OUT_ERROR);
+
+			Transaction->Status = TIME_OUT_ERROR;
+
+			if (NULL != Transaction->CallBackFunc)
+			{
+				Transaction->CallBackFunc(Transaction);
+			}
+		}
+	}
+}
+
+/*
+ * @function 		:	I2C_Run_Recovery
+ * @brief			:	Recover the Bus After an Aborted Transaction & Start the Next One
+ * @param			:	I2C Number
+ * @retval			:	VOID
+ * @Note			:	Called With Interrupts Enabled , Only One Caller Runs a Pending Recovery
+ */
+static void I2C_Run_Recovery(I2C_I2C_NUMBER_t I2C_Num)
+{
+	I2C_Transfer_t * Transfer = &I2C_Transfers[I2C_Num];
+
+	uint32_t PriMask = 0 ;
+
+	uint8_t Claimed = 0 ;
+
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	if (I2C_RECOVERY_PENDING == Transfer->Recovery)
+	{
+		Transfer->Recovery = I2C_RECOVERY_RUNNING;
+		Claimed = 1;
+	}
+
+	EXIT_CRITICAL_SECTION(PriMask);
+
+	if (Claimed)
+	{
+		/*Release a Slave that May Hold SDA & Reset the I2C*/
+		I2C_Bus_Recovery(I2C_Num);
+
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		Transfer->Recovery = I2C_RECOVERY_NONE;
+
+		I2C_Start_Next(I2C_Num);
+
+		EXIT_CRITICAL_SECTION(PriMask);
+	}
+}
+
+/*
+ * @function 		:	I2C_Elapsed_us
+ * @brief			:	Time Passed Since a DWT Cycle Count
+ * @param			:	Start Cycle Count
+ * @retval			:	Elapsed Time in us
+ * @Note			:	Valid for Intervals Shorter than the Cycle Counter Wrap (2^32 HCLK Cycles)
+ */
+static uint32_t I2C_Elapsed_us(uint32_t Start)
+{
+	return ((DWT->CYCCNT - Start) / I2C_HCLK_MHZ);
+}
+
+/*
+ * @function 		:	I2C_Delay_us
+ * @brief			:	Busy Wait Using the DWT Cycle Counter
+ * @param			:	Time in us
+ * @retval			:	VOID
+ */
+static void I2C_Delay_us(uint32_t Time_us)
+{
+	uint32_t Start = DWT->CYCCNT;
+
+	while (I2C_Elapsed_us(Start) < Time_us);
+}
+
+/************** End of STATIC FUNCTIONS ****************/
 
 
 
 
 /********************* IRQ HANDLERS ********************/
 
+void I2C1_EV_IRQHandler(void)
+{
+	I2C_EV_Handler(I2C_NUMBER_1);
+}
+
+void I2C1_ER_IRQHandler(void)
+{
+	I2C_ER_Handler(I2C_NUMBER_1);
+}
+
+void I2C2_EV_IRQHandler(void)
+{
+	I2C_EV_Handler(I2C_NUMBER_2);
+}
+
+void I2C2_ER_IRQHandler(void)
+{
+	I2C_ER_Handler(I2C_NUMBER_2);
+}
+
+void I2C3_EV_IRQHandler(void)
+{
+	I2C_EV_Handler(I2C_NUMBER_3);
+}
+
+void I2C3_ER_IRQHandler(void)
+{
+	I2C_ER_Handler(I2C_NUMBER_3);
+}
+
+/*DMA Receive Call Backs*/
+static void I2C1_DMA_RX_Cplt(void)
+{
+	I2C_DMA_RX_Done(I2C_NUMBER_1, OK);
+}
+
+static void I2C2_DMA_RX_Cplt(void)
+{
+	I2C_DMA_RX_Done(I2C_NUMBER_2, OK);
+}
+
+static void I2C3_DMA_RX_Cplt(void)
+{
+	I2C_DMA_RX_Done(I2C_NUMBER_3, OK);
+}
+
+static void I2C1_DMA_RX_Error(void)
+{
+	I2C_DMA_RX_Done(I2C_NUMBER_1, I2C_DMA_ERROR);
+}
+
+static void I2C2_DMA_RX_Error(void)
+{
+	I2C_DMA_RX_Done(I2C_NUMBER_2, I2C_DMA_ERROR);
+}
+
+static void I2C3_DMA_RX_Error(void)
+{
+	I2C_DMA_RX_Done(I2C_NUMBER_3, I2C_DMA_ERROR);
+}
+
 /****************** End OF IRQ HANDLERS ****************/
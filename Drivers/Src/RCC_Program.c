@@ -77,6 +77,17 @@ void RCC_SetSYSCLK(SYSCLK_SRC SYS_CLK_TYPE)
     RCC->CFGR &= ~(TWO_BIT_MASKING << CFGR_SW);
      RCC->CFGR |= (SYS_CLK_TYPE << CFGR_SW);
 }
+/*
+ * Prototype   : SYSCLK_SRC RCC_GetSYSCLK(void)
+ * Description : Get The Clock Actually Used as System Clock
+ * Arguments   : void
+ *
+ * return      : SYSCLK_SRC : HSI, HSE,PLL ( Switch Status Bits )
+ */
+SYSCLK_SRC RCC_GetSYSCLK(void)
+{
+    return (SYSCLK_SRC)((RCC->CFGR >> CFGR_SWS) & TWO_BIT_MASKING);
+}
 /*
  * Prototype   : void RCC_HSEConfig(HSE_CONFIG * HSE_USERCONFIG)
  * Description : Set HSE Configuration
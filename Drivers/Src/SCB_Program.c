@@ -61,11 +61,17 @@ void SCB_VoidDisableFaultException(Fault_t Local_Fault)
 	/*Clearing Enable Bit For Fault Exception*/
 	SCB->SHCSR &= ~(1 << Local_Fault);
 }
-
+/*==============================================================================================================================================
+ *@fn SCB_u8SetHandler
+ *@brief Setting Call Back Function of a System Handler
+ *@paramter[in] Local_Handler: Handler ( NMI_HANDLER - PENDSV_HANDLER )
+ *@paramter[in] Local_ptrToFunction: Call Back Function
+ *@retval Error State
+ *==============================================================================================================================================*/
 uint8_t SCB_u8SetHandler(HANDLER_t Local_Handler, void (*Local_ptrToFunction)(void))
 {
 	uint8_t Local_u8ErrorState = OK;
-	if (Local_Handler < PENDSV_HANDLER && Local_ptrToFunction != NULL)
+	if (Local_Handler <= PENDSV_HANDLER && Local_ptrToFunction != NULL)
 	{
 		SCB_PTR_TO_FUNCTION[Local_Handler] = Local_ptrToFunction;
 	}
@@ -83,21 +89,11 @@ uint8_t SCB_u8SetHandler(HANDLER_t Local_Handler, void (*Local_ptrToFunction)(vo
  *==============================================================================================================================================*/
 void SCB_VoidSetCorePriority (SystemFault_t SystemFault , uint8_t  Copy_u8Priority)
 {
-	if( (SystemFault == MemoryManagment_FAULT) || (SystemFault ==BusFault_FAULT) || (SystemFault ==Usage_FAULT) )
-	{
-		SCB->SHPR[0] &= ~(15 << SystemFault);
-		SCB->SHPR[0] |= (Copy_u8Priority << SystemFault);
-
-	}
-	else if (SystemFault == SVCCALL_FAULT)
-	{
-		SCB->SHPR[1] &= ~(15 << SystemFault);
-		SCB->SHPR[1] |= (Copy_u8Priority << SystemFault);
-	}
-	else if( (SystemFault == SYSTICK_FAULT) || (SystemFault == PENDSV_FAULT) )
+	if( (SystemFault == MemoryManagment_FAULT) || (SystemFault ==BusFault_FAULT) || (SystemFault ==Usage_FAULT) ||
+		(SystemFault == SVCCALL_FAULT) || (SystemFault == SYSTICK_FAULT) || (SystemFault == PENDSV_FAULT) )
 	{
-		SCB->SHPR[2] &= ~(15 << SystemFault);
-		SCB->SHPR[2] |= (Copy_u8Priority << SystemFault);
+		/* Priority Registers Are Byte Accessible , One Byte For Each Handler */
+		((volatile uint8_t *)SCB->SHPR)[SystemFault] = (uint8_t)(Copy_u8Priority << SCB_PRIORITY_SHIFT);
 	}
 	else
 	{
@@ -106,6 +102,17 @@ void SCB_VoidSetCorePriority (SystemFault_t SystemFault , uint8_t  Copy_u8Priori
 
 }
 
+/*==============================================================================================================================================
+ *@fn SCB_VoidSetPendSV
+ *@brief Pend The PendSV Exception , it Runs When No Higher Priority Handler is Active
+ *@retval void
+ *==============================================================================================================================================*/
+void SCB_VoidSetPendSV(void)
+{
+	/* Writing Zero to Other ICSR Bits Has No Effect */
+	SCB->ICSR = (1UL << SCB_ICSR_PENDSVSET);
+}
+
 /*==============================================================================================================================================
  * HANDLERS SECTION
  *==============================================================================================================================================*/
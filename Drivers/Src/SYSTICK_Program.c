@@ -55,53 +55,13 @@ static void (* SYSTK_GpfCallBackFunc )(void)= NULL ;
  *              you can go with the other configuration ( SYSTICK_AHB_BY8 ) or Just Use ( SYSTICK_AHB ) & Repeat Calling the Function
  *
  *           => While Using ( SYSTICK_AHB_BY8 ) Configuration Max Delay you can make in milliseconds is ( 8000 ms = 8s )
+ *
+ *           => While SYSTICK Runs a Periodic Interrupt the Delay Only Counts its Ticks , No Limit Other Than the 32 Bit Time
  **/
 
 ERRORS_t SYSTICK_Delayms(uint32_t Copy_u32TimeInMillis)
 {
-	ERRORS_t Local_u8ErrorStatus = OK ;
-
-	/* Variable To Carry RELOAD Value */
-	uint32_t RELOAD_Value = 0 ;
-
-	/* Check on TIMER_CLK  */
-	if( SYSTICK_TIMER_CONFIG.CLK == SYSTICK_AHB )
-	{
-		RELOAD_Value = ( Copy_u32TimeInMillis * 1000UL ) / AHB_TICK_TIME ;
-	}
-	else if( SYSTICK_TIMER_CONFIG.CLK == SYSTICK_AHB_BY8 )
-	{
-		RELOAD_Value = ( Copy_u32TimeInMillis * 1000UL ) / AHB_BY8_TICK_TIME ;
-	}
-	else
-	{
-		Local_u8ErrorStatus = NOK ;
-	}
-
-	/* Setting Reload Value */
-	( SYSTICK->SYST_RVR ) = RELOAD_Value ;
-
-	/* Clear Current */
-	( SYSTICK->SYST_CVR ) = 0 ;
-
-	/* Set Exception */
-	( SYSTICK->SYST_CSR ) &= ~(1<<CSR_TICKINT) ;
-	( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.Exception ) << CSR_TICKINT ) ;
-
-	/* Set Clock Source */
-	( SYSTICK->SYST_CSR ) &= ~(1<<CSR_CLKSOURCE) ;
-	( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.CLK ) << CSR_CLKSOURCE ) ;
-
-	/* Enable Timer */
-	( SYSTICK->SYST_CSR ) |= ( 1 << CSR_ENABLE ) ;
-
-	/* Check on Flag */
-	while( !( ( (SYSTICK->SYST_CSR)>>CSR_COUNTFLAG )&0x01) ) ;
-
-	/* Disable Timer */
-	( SYSTICK->SYST_CSR ) &= ~( 1 << CSR_ENABLE ) ;
-
-	return Local_u8ErrorStatus ;
+	return SYSTICK_Wait( Copy_u32TimeInMillis * 1000UL ) ;
 }
 
 
@@ -110,51 +70,15 @@ ERRORS_t SYSTICK_Delayms(uint32_t Copy_u32TimeInMillis)
  * @brief  : Fuction That Makes Delay in Software Based on Passed Number of MicroSeconds
  * @param  : Copy_u32TimeInMicroSeconds => Time Passed To Delay in MicroSeconds
  * @retval : ErrorStatus To Indicate If Function Worked Properly
- * @note   : => While Using ( STYSTICK_AHB ) Configuration Max Delay you can make in microseconds is ( 1000000 us = 1s ) if you want more than this value
+ * @note   : => While Using ( STYSTICK_AHB ) Configuration Max Delay you can make in microseconds is ( 1000000 us = 1s )
  *
  *           => While Using ( SYSTICK_AHB_BY8 ) Configuration Max Delay you can make in microseconds is ( 8000000 us = 8s )
+ *
+ *           => While SYSTICK Runs a Periodic Interrupt the Delay Only Counts its Ticks , No Limit Other Than the 32 Bit Time
  **/
 ERRORS_t SYSTICK_Delayus(uint32_t Copy_u32TimeInMicroSeconds)
 {
-	ERRORS_t Local_u8ErrorStatus = OK ;
-
-	/* Variable To Carry RELOAD Value */
-	uint32_t RELOAD_Value = 0 ;
-
-	/* Check on TIMER_CLK  */
-	if( SYSTICK_TIMER_CONFIG.CLK == SYSTICK_AHB )
-	{
-		RELOAD_Value = ( Copy_u32TimeInMicroSeconds  / AHB_TICK_TIME ) ;
-	}
-	else if( SYSTICK_TIMER_CONFIG.CLK == SYSTICK_AHB_BY8 )
-	{
-		RELOAD_Value = ( Copy_u32TimeInMicroSeconds  / AHB_BY8_TICK_TIME ) ;
-	}
-
-	/* Setting Reload Value */
-	( SYSTICK->SYST_RVR ) = RELOAD_Value ;
-
-	/* Clear Current */
-	( SYSTICK->SYST_CVR ) = 0 ;
-
-	/* Set Exception */
-	( SYSTICK->SYST_CSR ) &= ~(1<<CSR_TICKINT) ;
-	( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.Exception ) << CSR_TICKINT ) ;
-
-	/* Set Clock Source */
-	( SYSTICK->SYST_CSR ) &= ~(1<<CSR_CLKSOURCE) ;
-	( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.CLK ) << CSR_CLKSOURCE ) ;
-
-	/* Enable Timer */
-	( SYSTICK->SYST_CSR ) |= ( 1 << CSR_ENABLE ) ;
-
-	/* Check on Flag */
-	while( !( ( (SYSTICK->SYST_CSR)>>CSR_COUNTFLAG )&0x01) ) ;
-
-	/* Disable Timer */
-	( SYSTICK->SYST_CSR ) &= ~( 1 << CSR_ENABLE ) ;
-
-	return Local_u8ErrorStatus ;
+	return SYSTICK_Wait( Copy_u32TimeInMicroSeconds ) ;
 }
 /***********************************
  * @function 		:	SYSTICK_voidSetINT
@@ -180,8 +104,8 @@ void	SYSTICK_voidSetINT	(uint32_t	Time_ms , SYSTICK_CLOCK_t Systick_CLK_SRC , vo
 			RELOAD_VALUE	=	(Time_ms*1000)/AHB_TICK_TIME;
 		}
 
-		/*Set reload value in the Reload Value Register*/
-		SYSTICK->SYST_RVR	=	RELOAD_VALUE;
+		/*Set reload value in the Reload Value Register , the Period is Reload + 1 Ticks*/
+		SYSTICK->SYST_RVR	=	RELOAD_VALUE - 1;
 
 		/*Clear the Current Value*/
 		SYSTICK->SYST_CVR	=0;
@@ -204,6 +128,21 @@ void	SYSTICK_voidSetINT	(uint32_t	Time_ms , SYSTICK_CLOCK_t Systick_CLK_SRC , vo
 	}
 }
 
+/***********************************
+ * @function 		:	SYSTICK_voidStopINT
+ * @brief			:	Stop the periodic interrupt Set by SYSTICK_voidSetINT
+ * @retval			:	void
+ */
+
+void	SYSTICK_voidStopINT	(void)
+{
+	/*Disable SYSTICK & its Interrupt*/
+	SYSTICK ->SYST_CSR	&=	~((1<<(ENABLE_BIT_ACCESS)) | (1<<(INTERRUPT_BIT_ACCESS)));
+
+	/*Remove CallBack*/
+	SYSTK_GpfCallBackFunc = NULL;
+}
+
 /*SYSTICK IRQ HANDLER*/
 void SysTick_Handler (void)
 {
@@ -212,3 +151,101 @@ void SysTick_Handler (void)
 		SYSTK_GpfCallBackFunc();
 	}
 }
+
+/*==============================================================================================================================================
+ * PRIVATE FUNCTIONS IMPLEMENTATION
+ *==============================================================================================================================================*/
+
+/**
+ * @fn     : SYSTICK_Wait
+ * @brief  : Busy Wait For a Number of MicroSeconds , a Running SYSTICK is Only Read So its Periodic Interrupt Keeps Working ,
+ *           a Stopped One is Used as a One Shot Timer
+ * @param  : Copy_u32TimeInMicroSeconds => Time to Wait in MicroSeconds
+ * @retval : ErrorStatus ( NOK If the Time Does Not Fit the Stopped Timer )
+ **/
+static ERRORS_t SYSTICK_Wait(uint32_t Copy_u32TimeInMicroSeconds)
+{
+	ERRORS_t Local_u8ErrorStatus = OK ;
+
+	uint32_t Local_u32Ticks = 0 , Local_u32Period = 0 , Local_u32Last = 0 , Local_u32Now = 0 , Local_u32Elapsed = 0 ;
+
+	if( ( (SYSTICK->SYST_CSR) >> CSR_ENABLE ) & 0x01 )
+	{
+		/* Tick Length Follows the Clock the Running Timer Was Set With */
+		if( ( (SYSTICK->SYST_CSR) >> CSR_CLKSOURCE ) & 0x01 )
+		{
+			Local_u32Ticks = ( uint32_t )( Copy_u32TimeInMicroSeconds / AHB_TICK_TIME ) ;
+		}
+		else
+		{
+			Local_u32Ticks = ( uint32_t )( Copy_u32TimeInMicroSeconds / AHB_BY8_TICK_TIME ) ;
+		}
+
+		Local_u32Period = ( SYSTICK->SYST_RVR ) + 1 ;
+		Local_u32Last = ( SYSTICK->SYST_CVR ) ;
+
+		/* Down Counter , a Reload Between Two Reads Adds One Period , Reads Must Come More Often Than Once a Period */
+		while( Local_u32Elapsed < Local_u32Ticks )
+		{
+			Local_u32Now = ( SYSTICK->SYST_CVR ) ;
+
+			if( Local_u32Now <= Local_u32Last )
+			{
+				Local_u32Elapsed += ( Local_u32Last - Local_u32Now ) ;
+			}
+			else
+			{
+				Local_u32Elapsed += ( Local_u32Last + Local_u32Period - Local_u32Now ) ;
+			}
+			Local_u32Last = Local_u32Now ;
+		}
+	}
+	else
+	{
+		/* Check on TIMER_CLK  */
+		if( SYSTICK_TIMER_CONFIG.CLK == SYSTICK_AHB )
+		{
+			Local_u32Ticks = ( uint32_t )( Copy_u32TimeInMicroSeconds / AHB_TICK_TIME ) ;
+		}
+		else if( SYSTICK_TIMER_CONFIG.CLK == SYSTICK_AHB_BY8 )
+		{
+			Local_u32Ticks = ( uint32_t )( Copy_u32TimeInMicroSeconds / AHB_BY8_TICK_TIME ) ;
+		}
+		else
+		{
+			Local_u8ErrorStatus = NOK ;
+		}
+
+		if( Local_u32Ticks > SYSTICK_MAX_RELOAD )
+		{
+			Local_u8ErrorStatus = NOK ;
+		}
+		else if( ( OK == Local_u8ErrorStatus ) && ( Local_u32Ticks > 0 ) )
+		{
+			/* Setting Reload Value , COUNTFLAG Sets After Reload + 1 Ticks */
+			( SYSTICK->SYST_RVR ) = Local_u32Ticks - 1 ;
+
+			/* Clear Current */
+			( SYSTICK->SYST_CVR ) = 0 ;
+
+			/* Set Exception */
+			( SYSTICK->SYST_CSR ) &= ~(1<<CSR_TICKINT) ;
+			( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.Exception ) << CSR_TICKINT ) ;
+
+			/* Set Clock Source */
+			( SYSTICK->SYST_CSR ) &= ~(1<<CSR_CLKSOURCE) ;
+			( SYSTICK->SYST_CSR ) |= ( ( SYSTICK_TIMER_CONFIG.CLK ) << CSR_CLKSOURCE ) ;
+
+			/* Enable Timer */
+			( SYSTICK->SYST_CSR ) |= ( 1 << CSR_ENABLE ) ;
+
+			/* Check on Flag */
+			while( !( ( (SYSTICK->SYST_CSR)>>CSR_COUNTFLAG )&0x01) ) ;
+
+			/* Disable Timer */
+			( SYSTICK->SYST_CSR ) &= ~( 1 << CSR_ENABLE ) ;
+		}
+	}
+
+	return Local_u8ErrorStatus ;
+}
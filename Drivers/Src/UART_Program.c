@@ -39,6 +39,8 @@ static uint8_t UART_RecieveBufferSize[UARTNUMBER] = {0};
 static uint16_t *UART_RecievedBufferIT[UARTNUMBER] = {0};
 
 static uint16_t *UART_RecievedBuffer[UARTNUMBER] = {0};
+
+static void (*UART_ReceiveStreamCallBack[UARTNUMBER])(uint16_t Data) = {NULL};
 /*==============================================================================================================================================
  * FUNCTION DEFINITION SECTION
  *==============================================================================================================================================*/
@@ -195,6 +197,29 @@ void UART_u16ReceiveIT(UART_Config_t *UART_Config, void (*pv_CallBackFunc)(void)
 	/* Enabling Read Data Register Not Empty Interrupt */
 	UART[UART_Config->UART_ID]->CR1 |= (1 << USART_RXNEIE);
 }
+/*==============================================================================================================================================
+ *@fn      : UART_voidReceiveStreamIT
+ *@brief  :  This is a function used to receive every byte through UART peripheral using interrupts , the interrupt stays enabled
+ *@paramter[in]  : UART_Config_t *UART_Config : Pointer to the UART peripheral configuration structure
+ *@paramter[in]  : pv_CallBackFunc : Called from the interrupt with each received byte , NULL stops the reception
+ *@retval void
+ *==============================================================================================================================================*/
+void UART_voidReceiveStreamIT(UART_Config_t *UART_Config, void (*pv_CallBackFunc)(uint16_t Data))
+{
+	/* Setting CallBack Function */
+	UART_ReceiveStreamCallBack[UART_Config->UART_ID] = pv_CallBackFunc;
+
+	if (NULL != pv_CallBackFunc)
+	{
+		/* Enabling Read Data Register Not Empty Interrupt */
+		UART[UART_Config->UART_ID]->CR1 |= (1 << USART_RXNEIE);
+	}
+	else
+	{
+		/* Disabling Read Data Register Not Empty Interrupt */
+		UART[UART_Config->UART_ID]->CR1 &= ~(1 << USART_RXNEIE);
+	}
+}
 /*==============================================================================================================================================
  *@fn    USART_voidRecieveBuffer
  *@brief  This function is used to receive a string through UART peripheral using polling
@@ -325,6 +350,12 @@ static void UART_HANDLE_IT( UART_ID_t UARTNumber )
 			}
 		}
 
+		/* Comming From UART_voidReceiveStreamIT , Reading DR Also Clears an Overrun */
+		if ((UART_ReadFlag(UARTNumber, RXNE_Flage) == 1) && (NULL != UART_ReceiveStreamCallBack[UARTNumber]))
+		{
+			UART_ReceiveStreamCallBack[UARTNumber](UART[UARTNumber]->DR);
+		}
+
 		/* Comming From UART_RecieBuffer*/
 		if ((UART_ReadFlag(UARTNumber, RXNE_Flage) == 1))
 		{
@@ -336,7 +367,7 @@ static void UART_HANDLE_IT( UART_ID_t UARTNumber )
 			UART_PTR_TO_FUNC[UARTNumber][RXN]();
 		}
 		/* Transmission Complete */
-		if (UART_ReadFlag(UARTNumber, TC_Flage) == 1)
+		if ((UART_ReadFlag(UARTNumber, TC_Flage) == 1) && (NULL != UART_PTR_TO_FUNC[UARTNumber][TC_Flage]))
 		{
 			/* Clearing the TC Flag */
 			UART[UARTNumber]->SR &= ~(1 << TC_Flage);
@@ -345,7 +376,7 @@ static void UART_HANDLE_IT( UART_ID_t UARTNumber )
 			UART_PTR_TO_FUNC[UARTNumber][TC_Flage]();
 		}
 		/* Transmit Data Register Empty */
-		if (UART_ReadFlag(UARTNumber, TXE_Flage) == 1)
+		if ((UART_ReadFlag(UARTNumber, TXE_Flage) == 1) && (NULL != UART_PTR_TO_FUNC[UARTNumber][TXE_Flage]))
 		{
 			/* Clearing the TXE Flag */
 			UART[UARTNumber]->SR &= ~(1 << TXE_Flage);
@@ -355,7 +386,7 @@ static void UART_HANDLE_IT( UART_ID_t UARTNumber )
 		}
 
 		/* Overrun Error */
-		if (UART_ReadFlag(UARTNumber, ORE_Flage) == 1)
+		if ((UART_ReadFlag(UARTNumber, ORE_Flage) == 1) && (NULL != UART_PTR_TO_FUNC[UARTNumber][ORE_Flage]))
 		{
 			/* Clearing the ORE Flag */
 			UART[UARTNumber]->SR &= ~(1 << ORE_Flage);
@@ -365,7 +396,7 @@ static void UART_HANDLE_IT( UART_ID_t UARTNumber )
 		}
 
 		/* Framing Error */
-		if (UART_ReadFlag(UARTNumber, FE_Flage) == 1)
+		if ((UART_ReadFlag(UARTNumber, FE_Flage) == 1) && (NULL != UART_PTR_TO_FUNC[UARTNumber][FE_Flage]))
 		{
 			/* Clearing the FE Flag */
 			UART[UARTNumber]->SR &= ~(1 << FE_Flage);
@@ -374,7 +405,7 @@ static void UART_HANDLE_IT( UART_ID_t UARTNumber )
 			UART_PTR_TO_FUNC[UARTNumber][FE_Flage]();
 		}
 		/* Noise Error */
-		if (UART_ReadFlag(UARTNumber, NF_Flage) == 1)
+		if ((UART_ReadFlag(UARTNumber, NF_Flage) == 1) && (NULL != UART_PTR_TO_FUNC[UARTNumber][NF_Flage]))
 		{
 			/* Clearing the NE Flag */
 			UART[UARTNumber]->SR &= ~(1 << NF_Flage);
@@ -384,7 +415,7 @@ static void UART_HANDLE_IT( UART_ID_t UARTNumber )
 		}
 
 		/* Parity Error */
-		if (UART_ReadFlag(UARTNumber, PE_Flage) == 1)
+		if ((UART_ReadFlag(UARTNumber, PE_Flage) == 1) && (NULL != UART_PTR_TO_FUNC[UARTNumber][PE_Flage]))
 		{
 			/* Clearing the PE Flag */
 			UART[UARTNumber]->SR &= ~(1 << PE_Flage);
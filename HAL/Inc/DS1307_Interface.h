@@ -26,6 +26,18 @@ typedef enum
 	DS1307_SATURDAY
 }DS1307_DAYS_t;
 
+/* Frequency of SQW/OUT Pin ( RS1 : RS0 Bits of Control Register ) */
+typedef enum
+{
+	DS1307_SQW_1HZ = 0 , DS1307_SQW_4096HZ , DS1307_SQW_8192HZ , DS1307_SQW_32768HZ
+}DS1307_SQW_RATE_t;
+
+/* Format of the Hours Register , Hours in DS1307_Config_t Are Always 0 - 23 */
+typedef enum
+{
+	DS1307_24H_MODE = 0 , DS1307_12H_MODE
+}DS1307_HOUR_MODE_t;
+
 
 typedef struct
 {
@@ -36,6 +48,7 @@ typedef struct
     uint8_t Date ;
     uint8_t Month ;
     uint8_t Year ;
+    DS1307_HOUR_MODE_t Mode ;	/* Filled By Reading , Used in Writing */
 
 } DS1307_Config_t;
 
@@ -45,6 +58,9 @@ typedef struct
 #define DS1307_FIRST_LOC 0x00 /* Address of First Location in DS1307 Registers */
 #define DS1307_WRITE_ARR_SIZE 0x08
 #define DS1307_RECEIVE_ARR_SIZE 0x07
+#define DS1307_REGISTERS_SIZE 0x40 /* Timekeeping , Control & NVRAM Registers ( 0x00 - 0x3F ) */
+#define DS1307_NVRAM_SIZE 0x38     /* Battery Backed RAM ( 0x08 - 0x3F ) */
+#define DS1307_CH_MASK 0x80        /* Clock Halt Bit of Seconds Register */
 
 #define DS1307_SLAVE_ADDRESS_WRITE 0b11010000
 #define DS1307_SLAVE_ADDRESS_READ  0b11010001
@@ -54,41 +70,176 @@ typedef struct
  * =================================================================================== */
 
 
+/**
+ * @fn     : DS1307_HoursTo12
+ * @brief  : This Function Converts 0 - 23 Hours to 12 Hours Format
+ * @param  : Hours24 => Hours ( 0 - 23 )
+ * @param  : PM => Returns 1 For PM , 0 For AM ( Can be NULL )
+ * @return : Hours ( 1 - 12 )
+ */
+uint8_t DS1307_HoursTo12( uint8_t Hours24 , uint8_t * PM );
+
+/**
+ * @fn     : DS1307_HoursTo24
+ * @brief  : This Function Converts 12 Hours Format to 0 - 23 Hours
+ * @param  : Hours12 => Hours ( 1 - 12 )
+ * @param  : PM => 1 For PM , 0 For AM
+ * @return : Hours ( 0 - 23 )
+ */
+uint8_t DS1307_HoursTo24( uint8_t Hours12 , uint8_t PM );
+
 /**
  * @fn     : RTC_DateTimetoBCD
- * @brief  : This Function Returns Array of Values to Be Set inside the DS1307 Registers
+ * @brief  : This Function Fills Array of Values to Be Set inside the DS1307 Registers
  * @param  : Config => Pointer to Config Structure of DS1307 Config in it Time & Date
- * @return : Array of Values Needs to be Passed to DS1307 to Set Time
+ * @param  : ConfigArr => Caller Owned Array of ( DS1307_WRITE_ARR_SIZE ) Bytes to Fill ( Word Address + Registers )
+ * @return : void
+ * @note   : Reentrant , Uses Only the Caller Buffers , Hours Are Written in the Format Given By ( Mode )
  */
-uint8_t * DS1307_DateTimetoBCD( DS1307_Config_t * Config );
+void DS1307_DateTimetoBCD( const DS1307_Config_t * Config , uint8_t * ConfigArr );
 
 /**
  * @fn     : RTC_BCDToDateTime
- * @brief  : This Function Returns A Pointer to Structure that Holds Date & Time Values Normal
+ * @brief  : This Function Converts the BCD Registers Read From DS1307 to Normal Date & Time Values
  * @param  : ReadingsArray => Pointer to Readings Array Read From DS1307 in BCD & Needed to Be Converted to Normal Integers
- * @return : Pointer to Structure of Type DS1307_Config_t
+ * @param  : DateTime => Caller Owned Structure to Fill
+ * @return : void
+ * @note   : Reentrant , Safe to Call From an I2C Call Back While the Main Loop Converts Another Snapshot ,
+ *           Hours Are Returned as 0 - 23 in Both Formats & ( Mode ) Tells the Format of the Register
  */
-DS1307_Config_t * DS1307_BCDToDateTime( uint8_t * ReadingsArray );
+void DS1307_BCDToDateTime( const uint8_t * ReadingsArray , DS1307_Config_t * DateTime );
 
 /**
  * @fn     : DS1307_WriteDateTime
  * @brief  : This Function Writes Data Into RTC Module to Set Date & Time
  * @param  : I2CConfig => Pointer to Structure of I2C Initialization
  * @param  : Config => Pointer to Structure of DS1307 Configuration of Setting Date & Time
- * @return : void
+ * @return : Error State ( I2C_TRANSFER_BUSY if Another Transfer Took the Bus Meanwhile )
  * @note   : Before Calling This Function You Should Initialize I2C Pins as ( AF , Open Drain , Pull Up ) Through GPIO
- *           & Initialize a Certain I2C By Using ( I2C_Init )
+ *           & Initialize a Certain I2C By Using ( I2C_Init ) , Blocks ( Bounded ) Till the Write is Done
  */
-void DS1307_WriteDateTime(I2C_Configs_t * I2CConfig , DS1307_Config_t * Config  );
+Error_State_t DS1307_WriteDateTime( I2C_Configs_t * I2CConfig , const DS1307_Config_t * Config );
 
 /**
  * @fn     : DS1307_ReadDateTime
  * @brief  : This Function Reads Data From RTC Module
  * @param  : I2CConfig => Pointer to Structure of I2C Initialization
- * @param  : ReturnDateTime => Pointer to Structure of DS1307 Configuration of to Return Current Date & Time
- * @return : DS_Config_t Pointer
+ * @param  : DateTime => Caller Owned Structure to Return Current Date & Time in
+ * @return : Error State ( DateTime is Not Changed on Failure )
+ * @note   : Blocks ( Bounded ) Till the DMA Read is Done , Same Interrupts as ( DS1307_ReadRegisters_DMA ) Must be Enabled
+ */
+Error_State_t DS1307_ReadDateTime( I2C_Configs_t * I2CConfig , DS1307_Config_t * DateTime );
+
+/**
+ * @fn     : DS1307_ReadDateTime_IT
+ * @brief  : This Function Starts Reading Data From RTC Module Without Blocking ( I2C Interrupts )
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : ReceiveArr => Array of ( DS1307_RECEIVE_ARR_SIZE ) Bytes to Receive the BCD Registers in it
+ * @param  : CallBack => Function Called From I2C Interrupt When Reading is Done
+ * @return : Error State ( I2C_TRANSFER_BUSY if Another Transfer is Running on the Bus )
+ * @note   : Convert the Received Array Using ( DS1307_BCDToDateTime ) Inside the Call Back After Checking
+ *           ( I2C_Get_Transfer_Status ) , I2C Event & Error IRQs Must be Enabled
+ */
+Error_State_t DS1307_ReadDateTime_IT( I2C_Configs_t * I2CConfig , uint8_t * ReceiveArr , void (* CallBack)(void) );
+
+/**
+ * @fn     : DS1307_ReadRegisters_DMA
+ * @brief  : This Function Starts Reading a Block of RTC Registers in One I2C Transaction Using DMA
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Read
+ * @param  : ReceiveArr => Caller Owned Array to Receive the Registers in it
+ * @param  : Size => Number of Registers to Read ( Up to DS1307_REGISTERS_SIZE )
+ * @param  : CallBack => Function Called From Interrupt When Reading is Done
+ * @return : Error State ( NOK if the Block Exceeds the Register Space )
+ * @note   : Check ( I2C_Get_Transfer_Status ) Inside the Call Back , I2C Event & Error IRQs , DMA1 Clock
+ *           & the I2C Receive DMA Stream IRQ Must be Enabled
+ */
+Error_State_t DS1307_ReadRegisters_DMA( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size , void (* CallBack)(void) );
+
+/**
+ * @fn     : DS1307_ReadRegisters
+ * @brief  : This Function Reads a Block of RTC Registers in One DMA Burst & Waits For it
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Read
+ * @param  : ReceiveArr => Caller Owned Array to Receive the Registers in it
+ * @param  : Size => Number of Registers to Read ( Up to DS1307_REGISTERS_SIZE )
+ * @return : Error State
+ * @note   : Blocks ( Bounded ) Till the Read is Done , Same Interrupts as ( DS1307_ReadRegisters_DMA ) Must be Enabled
  */
+Error_State_t DS1307_ReadRegisters( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size );
 
-DS1307_Config_t * DS1307_ReadDateTime( I2C_Configs_t * I2CConfig );
+/**
+ * @fn     : DS1307_EnableSquareWave
+ * @brief  : This Function Enables the Square Wave Output on SQW/OUT Pin
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Rate => Frequency of the Square Wave
+ * @return : Error State ( Result of the I2C Transfer )
+ * @note   : SQW/OUT is Open Drain & Needs a Pull Up , At 1 HZ the Falling Edge is Aligned With the Seconds Update
+ */
+Error_State_t DS1307_EnableSquareWave( I2C_Configs_t * I2CConfig , DS1307_SQW_RATE_t Rate );
+
+/**
+ * @fn     : DS1307_WriteNVRAM
+ * @brief  : This Function Writes a Block of Bytes Into the Battery Backed RAM
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => Offset of First Byte Inside the NVRAM ( 0 - DS1307_NVRAM_SIZE - 1 )
+ * @param  : Data => Bytes to Write
+ * @param  : Size => Number of Bytes to Write
+ * @return : Error State ( NOK if the Block Exceeds the NVRAM )
+ * @note   : Blocks ( Bounded ) Till the Write is Done , Only the Given Bytes Are Written
+ */
+Error_State_t DS1307_WriteNVRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , const uint8_t * Data , uint8_t Size );
+
+/**
+ * @fn     : DS1307_ReadNVRAM
+ * @brief  : This Function Reads a Block of Bytes From the Battery Backed RAM in One DMA Burst
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => Offset of First Byte Inside the NVRAM ( 0 - DS1307_NVRAM_SIZE - 1 )
+ * @param  : Data => Caller Owned Array to Receive the Bytes in it
+ * @param  : Size => Number of Bytes to Read
+ * @return : Error State ( NOK if the Block Exceeds the NVRAM )
+ * @note   : Blocks ( Bounded ) Till the Read is Done , Same Interrupts as ( DS1307_ReadRegisters_DMA ) Must be Enabled
+ */
+Error_State_t DS1307_ReadNVRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , uint8_t * Data , uint8_t Size );
+
+/**
+ * @fn     : DS1307_UpdateDateTime
+ * @brief  : This Function Writes Only the Date & Time Registers That Differ From the RTC
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @return : Error State
+ * @note   : Reads the Registers First & Writes the Smallest Contiguous Range of Changed Ones , Clock Halt Bit
+ *           & 12 / 24 Hours Mode Are Kept , the Seconds Are Not Restarted Unless They Change
+ */
+Error_State_t DS1307_UpdateDateTime( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime );
+
+/**
+ * @fn     : DS1307_WriteDateTime_IT
+ * @brief  : This Function Starts Writing Date & Time Into RTC Module Without Blocking ( I2C Interrupts )
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @param  : ConfigArr => Caller Owned Array of ( DS1307_WRITE_ARR_SIZE ) Bytes , Must Stay Valid Till the Call Back
+ * @param  : CallBack => Function Called From I2C Interrupt When Writing is Done ( NULL If Not Needed )
+ * @return : Error State ( I2C_TRANSFER_BUSY if Another Transfer is Running , ConfigArr is Not Changed Then )
+ * @note   : Safe to Call From Interrupts , Clears the Clock Halt Bit
+ */
+Error_State_t DS1307_WriteDateTime_IT( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime , uint8_t * ConfigArr , void (* CallBack)(void) );
+
+/**
+ * @fn     : DS1307_CheckReadings
+ * @brief  : This Function Checks the Timekeeping Registers Read From DS1307
+ * @param  : ReadingsArray => ( DS1307_RECEIVE_ARR_SIZE ) Registers Read From Address 0x00
+ * @return : OK , RTC_CLOCK_HALTED if the Oscillator is Stopped or RTC_INVALID_TIME if a Register is Not a Valid BCD Value in Range
+ */
+Error_State_t DS1307_CheckReadings( const uint8_t * ReadingsArray );
+
+/**
+ * @fn     : DS1307_StartOscillator
+ * @brief  : This Function Clears the Clock Halt Bit Keeping the Seconds Register Value
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @return : Error State
+ * @note   : Blocks ( Bounded ) Till the Write is Done
+ */
+Error_State_t DS1307_StartOscillator( I2C_Configs_t * I2CConfig );
 
 #endif /* DS1307_INCLUDE_DS1307_INTERFACE_H_ */
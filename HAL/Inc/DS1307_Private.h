@@ -25,6 +25,89 @@
 #define DS1307_DATE_ADD (0x04)  /* Address of date register */
 #define DS1307_MONTH_ADD (0x05) /* Address of month register */
 #define DS1307_YEAR_ADD (0x06)  /* Address of year register */
+#define DS1307_CONTROL_ADD (0x07) /* Address of control register */
+#define DS1307_NVRAM_ADD (0x08)   /* Address of first NVRAM byte */
 
+#define DS1307_SQWE_BIT (4)     /* Square Wave Enable Bit of Control Register */
+#define DS1307_SEC_MASK (0x7F)  /* Seconds Register Without Clock Halt ( CH ) Bit */
+#define DS1307_12H_MASK (0x40)  /* 12 Hours Mode Bit of Hours Register */
+#define DS1307_PM_MASK (0x20)   /* PM Bit of Hours Register in 12 Hours Mode */
+
+#define DS1307_12H_HOURS_MASK (0x1F) /* Hours Register Without Mode & PM Bits in 12 Hours Mode */
+#define DS1307_24H_HOURS_MASK (0x3F) /* Hours Register Without Mode Bit in 24 Hours Mode */
+
+/* Valid Ranges of the Timekeeping Registers */
+#define DS1307_MAX_SECONDS 59u
+#define DS1307_MAX_MINUTES 59u
+#define DS1307_MAX_HOURS 23u
+#define DS1307_MAX_12H_HOURS 12u
+#define DS1307_MAX_DAY 7u
+#define DS1307_MAX_DATE 31u
+#define DS1307_MAX_MONTH 12u
+#define DS1307_MAX_YEAR 99u
+
+/* Register Holds Two Valid BCD Digits */
+#define DS1307_IS_BCD(REG) ( ( ( ( REG ) & 0x0F ) <= 9 ) && ( ( ( REG ) >> 4 ) <= 9 ) )
+
+#define DS1307_HOURS_PER_HALF_DAY 12u
+
+/* 0 - 23 Hours to 1 - 12 */
+#define DS1307_TO_12H(HOURS) ( ( 0 == ( ( HOURS ) % 12 ) ) ? 12 : ( ( HOURS ) % 12 ) )
+
+/* Two BCD Digits to Decimal */
+#define DS1307_BCD_TO_DEC(BCD) ( ( ( ( BCD ) >> 4 ) * 10 ) + ( ( BCD ) & 0x0F ) )
+
+/* Decimal to Two BCD Digits , Values Above 99 Keep Their Last Two Digits */
+#define DS1307_DEC_TO_BCD(DEC) ( ( ( ( ( DEC ) % 100 ) / 10 ) << 4 ) | ( ( DEC ) % 10 ) )
+
+/* Expand a Conversion Macro For 16 / 256 Consecutive Byte Values to Fill the Codec Tables at Compile Time */
+#define DS1307_TABLE_ROW(CONV, BASE)                                                                     \
+	CONV( ( BASE ) + 0x0 ) , CONV( ( BASE ) + 0x1 ) , CONV( ( BASE ) + 0x2 ) , CONV( ( BASE ) + 0x3 ) ,  \
+	CONV( ( BASE ) + 0x4 ) , CONV( ( BASE ) + 0x5 ) , CONV( ( BASE ) + 0x6 ) , CONV( ( BASE ) + 0x7 ) ,  \
+	CONV( ( BASE ) + 0x8 ) , CONV( ( BASE ) + 0x9 ) , CONV( ( BASE ) + 0xA ) , CONV( ( BASE ) + 0xB ) ,  \
+	CONV( ( BASE ) + 0xC ) , CONV( ( BASE ) + 0xD ) , CONV( ( BASE ) + 0xE ) , CONV( ( BASE ) + 0xF )
+
+#define DS1307_TABLE_256(CONV)                                                                           \
+	DS1307_TABLE_ROW( CONV , 0x00 ) , DS1307_TABLE_ROW( CONV , 0x10 ) , DS1307_TABLE_ROW( CONV , 0x20 ) , \
+	DS1307_TABLE_ROW( CONV , 0x30 ) , DS1307_TABLE_ROW( CONV , 0x40 ) , DS1307_TABLE_ROW( CONV , 0x50 ) , \
+	DS1307_TABLE_ROW( CONV , 0x60 ) , DS1307_TABLE_ROW( CONV , 0x70 ) , DS1307_TABLE_ROW( CONV , 0x80 ) , \
+	DS1307_TABLE_ROW( CONV , 0x90 ) , DS1307_TABLE_ROW( CONV , 0xA0 ) , DS1307_TABLE_ROW( CONV , 0xB0 ) , \
+	DS1307_TABLE_ROW( CONV , 0xC0 ) , DS1307_TABLE_ROW( CONV , 0xD0 ) , DS1307_TABLE_ROW( CONV , 0xE0 ) , \
+	DS1307_TABLE_ROW( CONV , 0xF0 )
+
+/* Registers Holding Two BCD Digits Are Decoded Through the Table , Day Register Holds 1 - 7 in Both Forms */
+#define DS1307_ENCODE(DEC) ( DS1307_DecToBCD_Table[ ( uint8_t )( DEC ) ] )
+#define DS1307_DECODE(BCD) ( DS1307_BCDToDec_Table[ ( uint8_t )( BCD ) ] )
+
+#define DS1307_I2C_TIMEOUT_MS (20) /* Maximum Time of a Register Read ( 8 Bytes at 100 KHz Take Less Than 1 ms ) */
+
+
+/**
+ * @fn     : DS1307_WriteRegisters
+ * @brief  : This Function Writes a Block of Contiguous RTC Registers in One Transfer
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Write
+ * @param  : Data => Register Values
+ * @param  : Size => Number of Registers ( Up to DS1307_NVRAM_SIZE )
+ * @return : Error State
+ */
+static Error_State_t DS1307_WriteRegisters( I2C_Configs_t * I2CConfig , uint8_t StartAddress , const uint8_t * Data , uint8_t Size );
+
+/**
+ * @fn     : DS1307_EncodeHours
+ * @brief  : This Function Encodes the Hours Register in the Given Format
+ * @param  : Hours => Hours ( 0 - 23 )
+ * @param  : Mode => Format of the Register
+ * @return : Hours Register Value
+ */
+static uint8_t DS1307_EncodeHours( uint8_t Hours , DS1307_HOUR_MODE_t Mode );
+
+/**
+ * @fn     : DS1307_DecodeHours
+ * @brief  : This Function Decodes the Hours Register in Either Format
+ * @param  : Register => Hours Register Value
+ * @return : Hours ( 0 - 23 )
+ */
+static uint8_t DS1307_DecodeHours( uint8_t Register );
 
 #endif /* DS1307_INCLUDE_DS1307_PRIVATE_H_ */
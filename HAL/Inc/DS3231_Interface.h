@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Filename              :   DS3231_Interface.h
+ * Author                :   Mohamemd Waleed Gad
+ * Origin Date           :   Aug 30, 2023
+ * Version               :   1.0.0
+ * Compiler              :   GCC ARM Embedded Toolchain
+ * Target                :
+ * Notes                 :   Timekeeping Registers ( 0x00 - 0x06 ) Have the DS1307 Layout , DS1307_Config_t is Used For Date & Time
+ **
+ *******************************************************************************/
+/************************ SOURCE REVISION LOG *********************************
+ *
+ *    Date    Version   Author             Description
+ *  30/08/23   1.0.0   Mohamemd Waleed   Initial Release.
+ *
+ *******************************************************************************/
+#ifndef DS3231_INCLUDE_DS3231_INTERFACE_H_
+#define DS3231_INCLUDE_DS3231_INTERFACE_H_
+
+/* =================================================================================== *
+ *                                   PRIVATE MACROS                                    *
+ * =================================================================================== */
+#define DS3231_REGISTERS_SIZE 0x13 /* Timekeeping , Alarms , Control , Status , Aging & Temperature ( 0x00 - 0x12 ) */
+#define DS3231_TEMP_LSB_ADD 0x12   /* Last Register , a Read Past it Wraps to 0x00 */
+#define DS3231_TEMP_LSB_MASK 0x3F  /* Unused Bits of Temperature LSB Register , Always Read as 0 */
+
+#define DS3231_SLAVE_ADDRESS_WRITE 0b11010000
+
+/* =================================================================================== *
+ *                                   PROTOTYPES                                        *
+ * =================================================================================== */
+
+/**
+ * @fn     : DS3231_BCDToDateTime
+ * @brief  : This Function Converts the BCD Registers Read From DS3231 to Normal Date & Time Values
+ * @param  : ReadingsArray => ( DS1307_RECEIVE_ARR_SIZE ) Registers Read From Address 0x00
+ * @param  : DateTime => Caller Owned Structure to Fill
+ * @return : void
+ * @note   : Century Bit of the Month Register is Ignored , Reentrant
+ */
+void DS3231_BCDToDateTime( const uint8_t * ReadingsArray , DS1307_Config_t * DateTime );
+
+/**
+ * @fn     : DS3231_CheckReadings
+ * @brief  : This Function Checks the Timekeeping Registers Read From DS3231
+ * @param  : ReadingsArray => ( DS1307_RECEIVE_ARR_SIZE ) Registers Read From Address 0x00
+ * @return : OK or RTC_INVALID_TIME if a Register is Not a Valid BCD Value in Range
+ * @note   : A Stopped Oscillator is Reported By the Status Register , See ( DS3231_ReadOscillatorStop )
+ */
+Error_State_t DS3231_CheckReadings( const uint8_t * ReadingsArray );
+
+/**
+ * @fn     : DS3231_ReadRegisters_DMA
+ * @brief  : This Function Starts Reading a Block of RTC Registers in One I2C Transaction Using DMA
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Read
+ * @param  : ReceiveArr => Caller Owned Array to Receive the Registers in it
+ * @param  : Size => Number of Registers to Read ( Up to DS3231_REGISTERS_SIZE )
+ * @param  : CallBack => Function Called From Interrupt When Reading is Done
+ * @return : Error State ( NOK if the Block Exceeds the Register Space )
+ * @note   : Same Interrupts as ( DS1307_ReadRegisters_DMA ) Must be Enabled
+ */
+Error_State_t DS3231_ReadRegisters_DMA( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size , void (* CallBack)(void) );
+
+/**
+ * @fn     : DS3231_ReadRegisters
+ * @brief  : This Function Reads a Block of RTC Registers in One DMA Burst & Waits For it
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Read
+ * @param  : ReceiveArr => Caller Owned Array to Receive the Registers in it
+ * @param  : Size => Number of Registers to Read ( Up to DS3231_REGISTERS_SIZE )
+ * @return : Error State
+ * @note   : Blocks ( Bounded ) Till the Read is Done
+ */
+Error_State_t DS3231_ReadRegisters( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size );
+
+/**
+ * @fn     : DS3231_ReadDateTime
+ * @brief  : This Function Reads Date & Time From RTC Module
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => Caller Owned Structure to Return Current Date & Time in
+ * @return : Error State ( DateTime is Not Changed on Failure )
+ * @note   : Blocks ( Bounded ) Till the DMA Read is Done
+ */
+Error_State_t DS3231_ReadDateTime( I2C_Configs_t * I2CConfig , DS1307_Config_t * DateTime );
+
+/**
+ * @fn     : DS3231_WriteDateTime
+ * @brief  : This Function Writes Date & Time Into RTC Module & Clears the Oscillator Stop Flag
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @return : Error State
+ * @note   : Blocks ( Bounded ) Till Both Writes Are Done
+ */
+Error_State_t DS3231_WriteDateTime( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime );
+
+/**
+ * @fn     : DS3231_ReadOscillatorStop
+ * @brief  : This Function Reads the Oscillator Stop Flag ( OSF ) of the Status Register
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Stopped => Returns 1 If the Oscillator Stopped Since the Flag Was Cleared , 0 If Not
+ * @return : Error State
+ * @note   : Blocks ( Bounded ) Till the Read is Done
+ */
+Error_State_t DS3231_ReadOscillatorStop( I2C_Configs_t * I2CConfig , uint8_t * Stopped );
+
+/**
+ * @fn     : DS3231_StartOscillator
+ * @brief  : This Function Keeps the Oscillator Running on Battery ( EOSC = 0 ) & Clears the Oscillator Stop Flag
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @return : Error State
+ * @note   : Blocks ( Bounded ) Till the Write is Done , Alarm Flags Are Kept
+ */
+Error_State_t DS3231_StartOscillator( I2C_Configs_t * I2CConfig );
+
+/**
+ * @fn     : DS3231_EnableSquareWave
+ * @brief  : This Function Routes the Square Wave to INT/SQW Pin
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Rate => Frequency of the Square Wave ( DS1307_SQW_32768HZ is Not Available on INT/SQW )
+ * @return : Error State ( NOK if the Rate is Not Available )
+ * @note   : INT/SQW Carries Either the Square Wave or the Alarm Interrupt , Alarm Interrupts Are Disabled
+ */
+Error_State_t DS3231_EnableSquareWave( I2C_Configs_t * I2CConfig , DS1307_SQW_RATE_t Rate );
+
+/**
+ * @fn     : DS3231_SetAlarm_IT
+ * @brief  : This Function Starts Programming Alarm 1 to Match a Date & Time & Drive INT/SQW Low on the Match
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Time => Date , Hours , Minutes & Seconds of the Alarm , NULL to Disable the Alarm Interrupt
+ * @return : Error State ( I2C_TRANSFER_BUSY if the Previous Alarm Write is Still Queued )
+ * @note   : Safe to Call From Interrupts , the Write is Queued & Does Not Wait For the Bus ,
+ *           Both Alarm Flags Are Cleared Which Releases INT/SQW ,
+ *           Month is Not Matched So a Deadline Over a Month Away Fires Early on the Same Date
+ */
+Error_State_t DS3231_SetAlarm_IT( I2C_Configs_t * I2CConfig , const DS1307_Config_t * Time );
+
+#endif /* DS3231_INCLUDE_DS3231_INTERFACE_H_ */
@@ -0,0 +1,71 @@
+/*******************************************************************************
+ * Filename              :   DS3231_Private.h
+ * Author                :   Mohamemd Waleed Gad
+ * Origin Date           :   Aug 30, 2023
+ * Version               :   1.0.0
+ * Compiler              :   GCC ARM Embedded Toolchain
+ * Target                :
+ * Notes                 :   None
+ **
+ *******************************************************************************/
+/************************ SOURCE REVISION LOG *********************************
+ *
+ *    Date    Version   Author             Description
+ *  30/08/23   1.0.0   Mohamemd Waleed   Initial Release.
+ *
+ *******************************************************************************/
+#ifndef DS3231_INCLUDE_DS3231_PRIVATE_H_
+#define DS3231_INCLUDE_DS3231_PRIVATE_H_
+
+
+#define DS3231_SEC_ADD (0x00)      /* Address of seconds register */
+#define DS3231_MONTH_ADD (0x05)    /* Address of month / century register */
+#define DS3231_ALARM1_ADD (0x07)   /* Address of alarm 1 seconds register */
+#define DS3231_CONTROL_ADD (0x0E)  /* Address of control register */
+#define DS3231_STATUS_ADD (0x0F)   /* Address of status register */
+
+#define DS3231_CENTURY_MASK (0x80) /* Century Bit of Month Register */
+#define DS3231_AxMx_MASK (0x80)    /* Alarm Mask Bit , Set = Register Ignored in the Match */
+
+/* Control Register Bits */
+#define DS3231_EOSC_MASK (0x80)    /* Set = Oscillator Stops on Battery */
+#define DS3231_RS_MASK (0x18)      /* Square Wave Rate Select ( RS2 : RS1 ) */
+#define DS3231_RS_SHIFT (3)
+#define DS3231_INTCN_MASK (0x04)   /* Set = INT/SQW is the Alarm Interrupt , Cleared = Square Wave */
+#define DS3231_A2IE_MASK (0x02)
+#define DS3231_A1IE_MASK (0x01)
+
+/* Status Register Bits , Flags Can Only be Cleared , Writing 1 Keeps Them as They Are */
+#define DS3231_OSF_MASK (0x80)     /* Oscillator Stopped Since This Flag Was Cleared */
+#define DS3231_EN32KHZ_MASK (0x08) /* 32 KHZ Output Enable , Set By Default */
+#define DS3231_A2F_MASK (0x02)
+#define DS3231_A1F_MASK (0x01)
+
+/* Alarm Write : Word Address , Alarm 1 ( 4 ) , Alarm 2 ( 3 ) , Control & Status */
+#define DS3231_ALARM_ARR_SIZE (10)
+#define DS3231_A1_DAY_INDEX (4)
+#define DS3231_ENCODED_DATE_INDEX (5)  /* Date in the DS1307_DateTimetoBCD Output */
+#define DS3231_CONTROL_INDEX (8)
+#define DS3231_STATUS_INDEX (9)
+
+/* RS2 : RS1 For Each DS1307_SQW_RATE_t , 0xFF = Not Available */
+#define DS3231_RS_1HZ (0x00)
+#define DS3231_RS_4096HZ (0x02)
+#define DS3231_RS_8192HZ (0x03)
+#define DS3231_RS_NONE (0xFF)
+
+#define DS3231_I2C_TIMEOUT_MS (20) /* Maximum Time of a Register Access ( 10 Bytes at 100 KHz Take About 1 ms ) */
+
+
+/**
+ * @fn     : DS3231_WriteRegisters
+ * @brief  : This Function Writes a Block of Contiguous RTC Registers in One Transfer
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Write
+ * @param  : Data => Register Values
+ * @param  : Size => Number of Registers ( Up to DS3231_REGISTERS_SIZE )
+ * @return : Error State
+ */
+static Error_State_t DS3231_WriteRegisters( I2C_Configs_t * I2CConfig , uint8_t StartAddress , const uint8_t * Data , uint8_t Size );
+
+#endif /* DS3231_INCLUDE_DS3231_PRIVATE_H_ */
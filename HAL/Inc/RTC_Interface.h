@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Filename              :   RTC_Interface.h
+ * Author                :   Mohamemd Waleed Gad
+ * Origin Date           :   Aug 30, 2023
+ * Version               :   1.0.0
+ * Compiler              :   GCC ARM Embedded Toolchain
+ * Target                :
+ * Notes                 :   Common Interface of DS1307 & DS3231 , the Chip is Selected at Init By Probing the Bus
+ **
+ *******************************************************************************/
+/************************ SOURCE REVISION LOG *********************************
+ *
+ *    Date    Version   Author             Description
+ *  30/08/23   1.0.0   Mohamemd Waleed   Initial Release.
+ *
+ *******************************************************************************/
+#ifndef RTC_INCLUDE_RTC_INTERFACE_H_
+#define RTC_INCLUDE_RTC_INTERFACE_H_
+
+/* =================================================================================== *
+ *                                   PRIVATE ENUMS                                     *
+ * =================================================================================== */
+typedef enum
+{
+	RTC_DS1307 = 0 , RTC_DS3231
+}RTC_TYPE_t;
+
+/* Operations of an RTC Chip , Date & Time Are Exchanged as DS1307_Config_t ( Same Registers on Both Chips ) */
+typedef struct
+{
+	RTC_TYPE_t Type ;
+	uint8_t NVRAM_Size ;	/* Bytes of Battery Backed RAM , 0 If None */
+
+	Error_State_t (* ReadDateTime)( I2C_Configs_t * I2CConfig , DS1307_Config_t * DateTime ) ;
+	Error_State_t (* WriteDateTime)( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime ) ;
+	Error_State_t (* UpdateDateTime)( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime ) ;
+	Error_State_t (* WriteDateTime_IT)( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime , uint8_t * ConfigArr , void (* CallBack)(void) ) ;
+	Error_State_t (* ReadRegisters_DMA)( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size , void (* CallBack)(void) ) ;
+	void (* BCDToDateTime)( const uint8_t * ReadingsArray , DS1307_Config_t * DateTime ) ;
+	Error_State_t (* CheckReadings)( const uint8_t * ReadingsArray ) ;
+	Error_State_t (* GetHealth)( I2C_Configs_t * I2CConfig , uint8_t * Health ) ;
+	Error_State_t (* StartOscillator)( I2C_Configs_t * I2CConfig ) ;
+	Error_State_t (* EnableSquareWave)( I2C_Configs_t * I2CConfig , DS1307_SQW_RATE_t Rate ) ;
+	Error_State_t (* SetAlarm_IT)( I2C_Configs_t * I2CConfig , const DS1307_Config_t * Time ) ;			/* NULL If No Hardware Alarm */
+	Error_State_t (* WriteNVRAM)( I2C_Configs_t * I2CConfig , uint8_t Offset , const uint8_t * Data , uint8_t Size ) ;	/* NULL If No NVRAM */
+	Error_State_t (* ReadNVRAM)( I2C_Configs_t * I2CConfig , uint8_t Offset , uint8_t * Data , uint8_t Size ) ;		/* NULL If No NVRAM */
+
+}RTC_Driver_t;
+
+/* =================================================================================== *
+ *                                   PRIVATE MACROS                                    *
+ * =================================================================================== */
+
+/* Health Flags Returned By ( RTC_GetHealth ) */
+#define RTC_HEALTH_OK 0x00u
+#define RTC_HEALTH_HALTED 0x01u  /* Oscillator Was Stopped ( DS1307 CH Bit , DS3231 OSF Flag ) */
+#define RTC_HEALTH_INVALID 0x02u /* Registers Do Not Hold a Valid Date & Time */
+
+/* =================================================================================== *
+ *                                   PROTOTYPES                                        *
+ * =================================================================================== */
+
+/**
+ * @fn     : RTC_Init
+ * @brief  : This Function Probes the Bus & Selects the Driver of the Found RTC Chip
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @return : Error State ( DS1307 Driver is Kept If the Probe Failed )
+ * @note   : Blocking , Call After ( I2C_Init ) & Before Any Other RTC Function , DS1307 is Used Till Then
+ */
+Error_State_t RTC_Init( I2C_Configs_t * I2CConfig );
+
+/**
+ * @fn     : RTC_GetDriver
+ * @brief  : This Function Returns the Driver Selected at Init
+ * @return : Selected Driver
+ */
+const RTC_Driver_t * RTC_GetDriver( void );
+
+/**
+ * @fn     : RTC_HasHardwareAlarm
+ * @brief  : This Function Tells If the Selected RTC Can Signal an Alarm on its INT Pin
+ * @return : 1 If ( RTC_SetAlarm_IT ) is Available , 0 If Not
+ */
+uint8_t RTC_HasHardwareAlarm( void );
+
+/**
+ * @fn     : RTC_ReadDateTime
+ * @brief  : This Function Reads Date & Time From the RTC
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => Caller Owned Structure to Return Current Date & Time in
+ * @return : Error State ( DateTime is Not Changed on Failure )
+ * @note   : Blocks ( Bounded ) Till the Read is Done
+ */
+Error_State_t RTC_ReadDateTime( I2C_Configs_t * I2CConfig , DS1307_Config_t * DateTime );
+
+/**
+ * @fn     : RTC_WriteDateTime
+ * @brief  : This Function Writes All Date & Time Registers & Restarts a Stopped Oscillator
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @return : Error State
+ * @note   : Blocks ( Bounded ) Till the Write is Done
+ */
+Error_State_t RTC_WriteDateTime( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime );
+
+/**
+ * @fn     : RTC_UpdateDateTime
+ * @brief  : This Function Writes Only the Date & Time Registers That Differ From the RTC
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @return : Error State
+ * @note   : Blocks ( Bounded ) Till the Write is Done
+ */
+Error_State_t RTC_UpdateDateTime( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime );
+
+/**
+ * @fn     : RTC_WriteDateTime_IT
+ * @brief  : This Function Starts Writing Date & Time Without Blocking
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @param  : ConfigArr => Caller Owned Array of ( DS1307_WRITE_ARR_SIZE ) Bytes , Must Stay Valid Till the Call Back
+ * @param  : CallBack => Function Called From I2C Interrupt When Writing is Done ( NULL If Not Needed )
+ * @return : Error State ( I2C_TRANSFER_BUSY if Another Transfer is Running , ConfigArr is Not Changed Then )
+ * @note   : Safe to Call From Interrupts
+ */
+Error_State_t RTC_WriteDateTime_IT( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime , uint8_t * ConfigArr , void (* CallBack)(void) );
+
+/**
+ * @fn     : RTC_ReadRegisters_DMA
+ * @brief  : This Function Starts Reading a Block of RTC Registers in One I2C Transaction Using DMA
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Read
+ * @param  : ReceiveArr => Caller Owned Array to Receive the Registers in it
+ * @param  : Size => Number of Registers to Read
+ * @param  : CallBack => Function Called From Interrupt When Reading is Done
+ * @return : Error State ( NOK if the Block Exceeds the Register Space of the Chip )
+ */
+Error_State_t RTC_ReadRegisters_DMA( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size , void (* CallBack)(void) );
+
+/**
+ * @fn     : RTC_BCDToDateTime
+ * @brief  : This Function Converts the Timekeeping Registers to Date & Time
+ * @param  : ReadingsArray => ( DS1307_RECEIVE_ARR_SIZE ) Registers Read From Address 0x00
+ * @param  : DateTime => Caller Owned Structure to Fill
+ * @return : void
+ * @note   : Reentrant
+ */
+void RTC_BCDToDateTime( const uint8_t * ReadingsArray , DS1307_Config_t * DateTime );
+
+/**
+ * @fn     : RTC_CheckReadings
+ * @brief  : This Function Checks the Timekeeping Registers
+ * @param  : ReadingsArray => ( DS1307_RECEIVE_ARR_SIZE ) Registers Read From Address 0x00
+ * @return : OK , RTC_CLOCK_HALTED ( DS1307 Only ) or RTC_INVALID_TIME
+ */
+Error_State_t RTC_CheckReadings( const uint8_t * ReadingsArray );
+
+/**
+ * @fn     : RTC_GetHealth
+ * @brief  : This Function Checks If the Oscillator Was Stopped & If the Registers Hold a Valid Date & Time
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Health => Returns Health Flags ( RTC_HEALTH_HALTED , RTC_HEALTH_INVALID )
+ * @return : Error State
+ * @note   : Blocks ( Bounded ) Till the Reads Are Done
+ */
+Error_State_t RTC_GetHealth( I2C_Configs_t * I2CConfig , uint8_t * Health );
+
+/**
+ * @fn     : RTC_StartOscillator
+ * @brief  : This Function Restarts a Stopped Oscillator Keeping the Time Registers
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @return : Error State
+ * @note   : Blocks ( Bounded ) Till the Write is Done
+ */
+Error_State_t RTC_StartOscillator( I2C_Configs_t * I2CConfig );
+
+/**
+ * @fn     : RTC_EnableSquareWave
+ * @brief  : This Function Enables the Square Wave Output
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Rate => Frequency of the Square Wave
+ * @return : Error State ( NOK if the Rate is Not Available on the Chip )
+ * @note   : On DS3231 the Pin is Shared With the Alarm Interrupt , Which is Disabled
+ */
+Error_State_t RTC_EnableSquareWave( I2C_Configs_t * I2CConfig , DS1307_SQW_RATE_t Rate );
+
+/**
+ * @fn     : RTC_SetAlarm_IT
+ * @brief  : This Function Starts Programming the Hardware Alarm
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Time => Date , Hours , Minutes & Seconds of the Alarm , NULL to Disable it
+ * @return : Error State ( NOK if the Chip Has No Hardware Alarm )
+ * @note   : Safe to Call From Interrupts , Also Releases the INT Pin of the Previous Alarm ,
+ *           The Month is Not Matched , the Caller Must Check the Time When the Pin Fires
+ */
+Error_State_t RTC_SetAlarm_IT( I2C_Configs_t * I2CConfig , const DS1307_Config_t * Time );
+
+/**
+ * @fn     : RTC_WriteNVRAM
+ * @brief  : This Function Writes a Block of Bytes Into the Battery Backed RAM
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => Offset of First Byte Inside the NVRAM
+ * @param  : Data => Bytes to Write
+ * @param  : Size => Number of Bytes to Write
+ * @return : Error State ( NOK if the Chip Has No NVRAM or the Block Exceeds it )
+ */
+Error_State_t RTC_WriteNVRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , const uint8_t * Data , uint8_t Size );
+
+/**
+ * @fn     : RTC_ReadNVRAM
+ * @brief  : This Function Reads a Block of Bytes From the Battery Backed RAM
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => Offset of First Byte Inside the NVRAM
+ * @param  : Data => Caller Owned Array to Receive the Bytes in it
+ * @param  : Size => Number of Bytes to Read
+ * @return : Error State ( NOK if the Chip Has No NVRAM or the Block Exceeds it )
+ */
+Error_State_t RTC_ReadNVRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , uint8_t * Data , uint8_t Size );
+
+#endif /* RTC_INCLUDE_RTC_INTERFACE_H_ */
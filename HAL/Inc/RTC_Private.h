@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Filename              :   RTC_Private.h
+ * Author                :   Mohamemd Waleed Gad
+ * Origin Date           :   Aug 30, 2023
+ * Version               :   1.0.0
+ * Compiler              :   GCC ARM Embedded Toolchain
+ * Target                :
+ * Notes                 :   None
+ **
+ *******************************************************************************/
+/************************ SOURCE REVISION LOG *********************************
+ *
+ *    Date    Version   Author             Description
+ *  30/08/23   1.0.0   Mohamemd Waleed   Initial Release.
+ *
+ *******************************************************************************/
+#ifndef RTC_INCLUDE_RTC_PRIVATE_H_
+#define RTC_INCLUDE_RTC_PRIVATE_H_
+
+
+/* Probe : A Read From the DS3231 Last Register Wraps to Seconds & Minutes , on DS1307 it Reads NVRAM */
+#define RTC_PROBE_SIZE (3)
+#define RTC_PROBE_TEMP_INDEX (0)
+#define RTC_PROBE_SEC_INDEX (1)
+#define RTC_PROBE_MIN_INDEX (2)
+
+/* A Seconds Update Between the Two Probe Reads Fails One Try Only */
+#define RTC_PROBE_TRIES (2)
+
+
+/**
+ * @fn     : RTC_ProbeDS3231
+ * @brief  : This Function Checks If the Chip at the RTC Address is a DS3231
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : IsDS3231 => Returns 1 If a DS3231 Answered , 0 If Not
+ * @return : Error State
+ */
+static Error_State_t RTC_ProbeDS3231( I2C_Configs_t * I2CConfig , uint8_t * IsDS3231 );
+
+/**
+ * @fn     : RTC_DS1307_GetHealth
+ * @brief  : This Function Checks the Clock Halt Bit & the Timekeeping Registers of DS1307
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Health => Returns Health Flags
+ * @return : Error State
+ */
+static Error_State_t RTC_DS1307_GetHealth( I2C_Configs_t * I2CConfig , uint8_t * Health );
+
+/**
+ * @fn     : RTC_DS3231_GetHealth
+ * @brief  : This Function Checks the Oscillator Stop Flag & the Timekeeping Registers of DS3231
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Health => Returns Health Flags
+ * @return : Error State
+ */
+static Error_State_t RTC_DS3231_GetHealth( I2C_Configs_t * I2CConfig , uint8_t * Health );
+
+#endif /* RTC_INCLUDE_RTC_PRIVATE_H_ */
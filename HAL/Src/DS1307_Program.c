@@ -33,233 +33,571 @@
  * ================================================================= */
 
 
-extern I2C_REG_t *I2Cs[3];
-/**
- * @fn     : RTC_DateTimetoBCD
- * @brief  : This Function Returns Array of Values to Be Set inside the DS1307 Registers
- * @param  : Config => Pointer to Config Structure of DS1307 Config in it Time & Date
- * @return : Array of Values Needs to be Passed to DS1307 to Set Time
- */
-uint8_t * DS1307_DateTimetoBCD( DS1307_Config_t * Config )
+/* Word Address of Each Register , Sent From Here So No Transfer Shares a Mutable Buffer */
+static const uint8_t DS1307_WordAddresses[ DS1307_REGISTERS_SIZE ] =
 {
-	/* Array to Send to RTC DS1307 via I2C */
-	static uint8_t ConfigArr[ DS1307_WRITE_ARR_SIZE ]={0};
+	0x00 , 0x01 , 0x02 , 0x03 , 0x04 , 0x05 , 0x06 , 0x07 , 0x08 , 0x09 , 0x0A , 0x0B , 0x0C , 0x0D , 0x0E , 0x0F ,
+	0x10 , 0x11 , 0x12 , 0x13 , 0x14 , 0x15 , 0x16 , 0x17 , 0x18 , 0x19 , 0x1A , 0x1B , 0x1C , 0x1D , 0x1E , 0x1F ,
+	0x20 , 0x21 , 0x22 , 0x23 , 0x24 , 0x25 , 0x26 , 0x27 , 0x28 , 0x29 , 0x2A , 0x2B , 0x2C , 0x2D , 0x2E , 0x2F ,
+	0x30 , 0x31 , 0x32 , 0x33 , 0x34 , 0x35 , 0x36 , 0x37 , 0x38 , 0x39 , 0x3A , 0x3B , 0x3C , 0x3D , 0x3E , 0x3F
+} ;
 
-	uint8_t Local_u8Variable = 0 ;
+/* BCD Codec Tables , Every Byte Value is a Valid Index So No Range Check is Needed on the Conversion Path */
+static const uint8_t DS1307_DecToBCD_Table[ 256 ] = { DS1307_TABLE_256( DS1307_DEC_TO_BCD ) } ;
+static const uint8_t DS1307_BCDToDec_Table[ 256 ] = { DS1307_TABLE_256( DS1307_BCD_TO_DEC ) } ;
 
-	uint8_t Local_u8Digit = 0 ;
+/**
+ * @fn     : DS1307_HoursTo12
+ * @brief  : This Function Converts 0 - 23 Hours to 12 Hours Format
+ * @param  : Hours24 => Hours ( 0 - 23 )
+ * @param  : PM => Returns 1 For PM , 0 For AM ( Can be NULL )
+ * @return : Hours ( 1 - 12 )
+ */
+uint8_t DS1307_HoursTo12( uint8_t Hours24 , uint8_t * PM )
+{
+	if( NULL != PM )
+	{
+		*PM = ( Hours24 >= DS1307_HOURS_PER_HALF_DAY ) ? 1 : 0 ;
+	}
+	return DS1307_TO_12H( Hours24 ) ;
+}
 
-	uint8_t Local_u8Counter = 0 ;
+/**
+ * @fn     : DS1307_HoursTo24
+ * @brief  : This Function Converts 12 Hours Format to 0 - 23 Hours
+ * @param  : Hours12 => Hours ( 1 - 12 )
+ * @param  : PM => 1 For PM , 0 For AM
+ * @return : Hours ( 0 - 23 )
+ */
+uint8_t DS1307_HoursTo24( uint8_t Hours12 , uint8_t PM )
+{
+	/* 12 AM is 0 & 12 PM is 12 */
+	return ( Hours12 % DS1307_HOURS_PER_HALF_DAY ) + ( PM ? DS1307_HOURS_PER_HALF_DAY : 0 ) ;
+}
 
+/**
+ * @fn     : RTC_DateTimetoBCD
+ * @brief  : This Function Fills Array of Values to Be Set inside the DS1307 Registers
+ * @param  : Config => Pointer to Config Structure of DS1307 Config in it Time & Date
+ * @param  : ConfigArr => Caller Owned Array of ( DS1307_WRITE_ARR_SIZE ) Bytes to Fill ( Word Address + Registers )
+ * @return : void
+ * @note   : One Table Load Per Register , No Division or Branches
+ */
+void DS1307_DateTimetoBCD( const DS1307_Config_t * Config , uint8_t * ConfigArr )
+{
 	/* To Set Pointer to The First Location */
 	ConfigArr[ DS1307_FIRST_LOC ] = 0x00 ;
 
-	/* Calculate Seconds */
-	Local_u8Variable = Config->Seconds ;
+	ConfigArr[ DS1307_SEC_ADD + 1 ]   = DS1307_ENCODE( Config->Seconds ) ;
+	ConfigArr[ DS1307_MIN_ADD + 1 ]   = DS1307_ENCODE( Config->Minutes ) ;
+	ConfigArr[ DS1307_HR_ADD + 1 ]    = DS1307_EncodeHours( Config->Hours , Config->Mode ) ;
+	ConfigArr[ DS1307_DAY_ADD + 1 ]   = DS1307_ENCODE( Config->Day ) ;
+	ConfigArr[ DS1307_DATE_ADD + 1 ]  = DS1307_ENCODE( Config->Date ) ;
+	ConfigArr[ DS1307_MONTH_ADD + 1 ] = DS1307_ENCODE( Config->Month ) ;
+	ConfigArr[ DS1307_YEAR_ADD + 1 ]  = DS1307_ENCODE( Config->Year ) ;
+}
 
-	for( Local_u8Counter = 0 ; Local_u8Counter < 2  ; Local_u8Counter++)
-	{
-		Local_u8Digit = Local_u8Variable % 10 ;
-		Local_u8Variable = Local_u8Variable / 10 ;
 
-		ConfigArr[ DS1307_SEC_ADD+1 ] |= Local_u8Digit << ( Local_u8Counter * 4 ) ;
-	}
+/**
+ * @fn     : RTC_BCDToDateTime
+ * @brief  : This Function Converts the BCD Registers Read From DS1307 to Normal Date & Time Values
+ * @param  : ReadingsArray => Pointer to Readings Array Read From DS1307 in BCD & Needed to Be Converted to Normal Integers
+ * @param  : DateTime => Caller Owned Structure to Fill
+ * @return : void
+ * @note   : One Table Load Per Register , No Multiplication
+ */
+void DS1307_BCDToDateTime( const uint8_t * ReadingsArray , DS1307_Config_t * DateTime )
+{
+	/* Seconds Readings ( CH Bit Masked ) */
+	DateTime->Seconds = DS1307_DECODE( ReadingsArray[ DS1307_SEC_ADD ] & DS1307_SEC_MASK ) ;
+
+	DateTime->Minutes = DS1307_DECODE( ReadingsArray[ DS1307_MIN_ADD ] ) ;
+	DateTime->Hours   = DS1307_DecodeHours( ReadingsArray[ DS1307_HR_ADD ] ) ;
+	DateTime->Mode    = ( ReadingsArray[ DS1307_HR_ADD ] & DS1307_12H_MASK ) ? DS1307_12H_MODE : DS1307_24H_MODE ;
+	DateTime->Day     = DS1307_DECODE( ReadingsArray[ DS1307_DAY_ADD ] ) ;
+	DateTime->Date    = DS1307_DECODE( ReadingsArray[ DS1307_DATE_ADD ] ) ;
+	DateTime->Month   = DS1307_DECODE( ReadingsArray[ DS1307_MONTH_ADD ] ) ;
+	DateTime->Year    = DS1307_DECODE( ReadingsArray[ DS1307_YEAR_ADD ] ) ;
+}
 
-	/* Calculate Minutes */
-	Local_u8Variable = Config->Minutes ;
+/**
+ * @fn     : DS1307_WriteDateTime
+ * @brief  : This Function Writes Data Into RTC Module to Set Date & Time
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Config => Pointer to Structure of DS1307 Configuration of Setting Date & Time
+ * @return : Error State ( I2C_TRANSFER_BUSY if Another Transfer Took the Bus Meanwhile )
+ * @note   : Before Calling This Function You Should Initialize I2C Pins as ( AF , Open Drain , Pull Up ) Through GPIO
+ *           & Initialize a Certain I2C By Using ( I2C_Init )
+ */
+Error_State_t DS1307_WriteDateTime( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DS1307_Config )
+{
+	Error_State_t Error_State = OK ;
 
-	for( Local_u8Counter = 0 ; Local_u8Counter < 2 ; Local_u8Counter++ )
-	{
-		Local_u8Digit = Local_u8Variable % 10 ;
-		Local_u8Variable = Local_u8Variable / 10 ;
+	/* BCD Values to Be Transferred to DS1307 RTC , Valid Till the Transfer Ends as This Function Waits For it */
+	uint8_t ConfigArr[ DS1307_WRITE_ARR_SIZE ] ;
 
-		ConfigArr[ DS1307_MIN_ADD+1 ] |= Local_u8Digit << (Local_u8Counter * 4) ;
-	}
+	DS1307_DateTimetoBCD( DS1307_Config , ConfigArr ) ;
 
-	/* Calculating Hours : By Default 24 Hours Mode */
+	/* Wait ( Bounded ) For a Transfer That Still Owns the Bus */
+	I2C_Wait_Transfer( I2CConfig->I2C_Num , DS1307_I2C_TIMEOUT_MS ) ;
 
-	Local_u8Variable = Config->Hours ;
+	/* Send the RTC Values Through the I2C Queue So it Does Not Collide With Interrupt Started Readings */
+	Error_State = I2C_Master_Transmit_IT( I2CConfig , DS1307_SLAVE_ADDRESS_WRITE , ConfigArr , DS1307_WRITE_ARR_SIZE , NULL ) ;
 
-	for( Local_u8Counter = 0 ; Local_u8Counter < 2 ; Local_u8Counter++ )
+	if( OK == Error_State )
 	{
-		Local_u8Digit = Local_u8Variable %10 ;
-
-		Local_u8Variable = Local_u8Variable / 10 ;
-
-		ConfigArr[ DS1307_HR_ADD+1 ] |= Local_u8Digit <<(Local_u8Counter*4);
+		Error_State = I2C_Wait_Transfer( I2CConfig->I2C_Num , DS1307_I2C_TIMEOUT_MS ) ;
 	}
+	return Error_State ;
+}
 
-	/* Day Calcultion */
-
-	ConfigArr[ DS1307_DAY_ADD+1 ] = Config->Day ;
+/**
+ * @fn     : DS1307_ReadDateTime
+ * @brief  : This Function Reads Data From RTC Module
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => Caller Owned Structure to Return Current Date & Time in
+ * @return : Error State ( DateTime is Not Changed on Failure )
+ */
+Error_State_t DS1307_ReadDateTime( I2C_Configs_t * I2CConfig , DS1307_Config_t * DateTime )
+{
+	Error_State_t Error_State = OK ;
 
-	/* Date Calculation */
+	/* Valid Till the Transfer Ends as This Function Waits For it */
+	uint8_t ReceiveArr[ DS1307_RECEIVE_ARR_SIZE ] ;
 
-	Local_u8Variable = Config->Date ;
+	/* Read All Time Registers in One Burst */
+	Error_State = DS1307_ReadRegisters( I2CConfig , DS1307_FIRST_LOC , ReceiveArr , DS1307_RECEIVE_ARR_SIZE ) ;
 
-	for( Local_u8Counter = 0 ; Local_u8Counter < 2 ; Local_u8Counter ++ )
+	if( OK == Error_State )
 	{
-		Local_u8Digit = Local_u8Variable %10 ;
-
-		Local_u8Variable = Local_u8Variable / 10 ;
-
-		ConfigArr[ DS1307_DATE_ADD+1 ] |= Local_u8Digit <<(Local_u8Counter *4);
+		DS1307_BCDToDateTime( ReceiveArr , DateTime ) ;
 	}
+	return Error_State ;
+}
 
-	/* Month Calculation */
+/**
+ * @fn     : DS1307_ReadDateTime_IT
+ * @brief  : This Function Starts Reading Data From RTC Module Without Blocking ( I2C Interrupts )
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : ReceiveArr => Array of ( DS1307_RECEIVE_ARR_SIZE ) Bytes to Receive the BCD Registers in it
+ * @param  : CallBack => Function Called From I2C Interrupt When Reading is Done
+ * @return : Error State ( I2C_TRANSFER_BUSY if Another Transfer is Running on the Bus )
+ */
+Error_State_t DS1307_ReadDateTime_IT( I2C_Configs_t * I2CConfig , uint8_t * ReceiveArr , void (* CallBack)(void) )
+{
+	/* Write Word Address , Repeated Start & Read All Time Registers in One Transfer */
+	return I2C_Master_Transfer_IT( I2CConfig , DS1307_SLAVE_ADDRESS_WRITE , &DS1307_WordAddresses[ DS1307_FIRST_LOC ] , 1 , ReceiveArr , DS1307_RECEIVE_ARR_SIZE , CallBack ) ;
+}
 
-	Local_u8Variable = Config->Month ;
+/**
+ * @fn     : DS1307_ReadRegisters_DMA
+ * @brief  : This Function Starts Reading a Block of RTC Registers in One I2C Transaction Using DMA
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Read
+ * @param  : ReceiveArr => Caller Owned Array to Receive the Registers in it
+ * @param  : Size => Number of Registers to Read ( Up to DS1307_REGISTERS_SIZE )
+ * @param  : CallBack => Function Called From Interrupt When Reading is Done
+ * @return : Error State ( NOK if the Block Exceeds the Register Space )
+ */
+Error_State_t DS1307_ReadRegisters_DMA( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size , void (* CallBack)(void) )
+{
+	Error_State_t Error_State = OK ;
 
-	for( Local_u8Counter = 0 ; Local_u8Counter < 2 ; Local_u8Counter++ )
+	if( ( 0 == Size ) || ( ( StartAddress + Size ) > DS1307_REGISTERS_SIZE ) )
 	{
-		Local_u8Digit = Local_u8Variable % 10 ;
-
-		Local_u8Variable = Local_u8Variable / 10 ;
-
-		ConfigArr[ DS1307_MONTH_ADD+1 ] |= Local_u8Digit <<(Local_u8Counter*4);
+		Error_State = NOK ;
 	}
+	else
+	{
+		/* Write Word Address , Repeated Start & Let DMA Read the Whole Block */
+		Error_State = I2C_Master_Transfer_DMA( I2CConfig , DS1307_SLAVE_ADDRESS_WRITE , &DS1307_WordAddresses[ StartAddress ] , 1 , ReceiveArr , Size , CallBack ) ;
+	}
+	return Error_State ;
+}
 
-	/* Year */
+/**
+ * @fn     : DS1307_ReadRegisters
+ * @brief  : This Function Reads a Block of RTC Registers in One DMA Burst & Waits For it
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Read
+ * @param  : ReceiveArr => Caller Owned Array to Receive the Registers in it
+ * @param  : Size => Number of Registers to Read ( Up to DS1307_REGISTERS_SIZE )
+ * @return : Error State
+ */
+Error_State_t DS1307_ReadRegisters( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size )
+{
+	Error_State_t Error_State = OK ;
 
-	Local_u8Variable = Config->Year ;
+	/* Wait ( Bounded ) For a Transfer That Still Owns the Bus */
+	I2C_Wait_Transfer( I2CConfig->I2C_Num , DS1307_I2C_TIMEOUT_MS ) ;
 
-	for( Local_u8Counter = 0 ; Local_u8Counter < 2 ; Local_u8Counter++ )
-	{
-		Local_u8Digit = Local_u8Variable % 10 ;
+	Error_State = DS1307_ReadRegisters_DMA( I2CConfig , StartAddress , ReceiveArr , Size , NULL ) ;
 
-		Local_u8Variable = Local_u8Variable / 10 ;
-
-		ConfigArr[ DS1307_YEAR_ADD+1 ] |= Local_u8Digit <<(Local_u8Counter*4);
+	/* ReceiveArr is Valid Only After the Transfer Ended */
+	if( OK == Error_State )
+	{
+		Error_State = I2C_Wait_Transfer( I2CConfig->I2C_Num , DS1307_I2C_TIMEOUT_MS ) ;
 	}
-	return ConfigArr ;
+	return Error_State ;
 }
 
-
 /**
- * @fn     : RTC_BCDToDateTime
- * @brief  : This Function Returns A Pointer to Structure that Holds Date & Time Values Normal
- * @param  : ReadingsArray => Pointer to Readings Array Read From DS1307 in BCD & Needed to Be Converted to Normal Integers
- * @return : Pointer to Structure of Type DS1307_Config_t
+ * @fn     : DS1307_EnableSquareWave
+ * @brief  : This Function Enables the Square Wave Output on SQW/OUT Pin
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Rate => Frequency of the Square Wave
+ * @return : Error State ( Result of the I2C Transfer )
  */
-DS1307_Config_t * DS1307_BCDToDateTime( uint8_t * ReadingsArray )
+Error_State_t DS1307_EnableSquareWave( I2C_Configs_t * I2CConfig , DS1307_SQW_RATE_t Rate )
 {
-	static DS1307_Config_t DS1307Readings ;
+	Error_State_t Error_State = OK ;
 
-	uint8_t Local_u8Variable = 0 ;
-	uint8_t LSB = 0 ;
-	uint8_t MSB = 0 ;
+	/* Control Register Address Followed By its Value , Valid Till the Transfer Ends as This Function Waits For it */
+	uint8_t ControlArr[ 2 ] = { DS1307_CONTROL_ADD , 0 } ;
 
-	/* Seconds Readings */
-	Local_u8Variable = ReadingsArray[ DS1307_SEC_ADD ] ;
+	/* Wait ( Bounded ) For a Transfer That Still Owns the Bus */
+	I2C_Wait_Transfer( I2CConfig->I2C_Num , DS1307_I2C_TIMEOUT_MS ) ;
 
-	LSB = Local_u8Variable & ( 0x0F ) ;
-	MSB = ( Local_u8Variable & ( 0xF0 ) ) >> 4 ;
+	ControlArr[ 1 ] = ( 1 << DS1307_SQWE_BIT ) | Rate ;
 
-	DS1307Readings.Seconds = ( MSB * 10 ) + LSB ;
+	Error_State = I2C_Master_Transmit_IT( I2CConfig , DS1307_SLAVE_ADDRESS_WRITE , ControlArr , 2 , NULL ) ;
 
-	/* Minutes */
-	Local_u8Variable = ReadingsArray[ DS1307_MIN_ADD ] ;
+	if( OK == Error_State )
+	{
+		Error_State = I2C_Wait_Transfer( I2CConfig->I2C_Num , DS1307_I2C_TIMEOUT_MS ) ;
+	}
+	return Error_State ;
+}
 
-	LSB = Local_u8Variable & ( 0x0F ) ;
-	MSB = ( Local_u8Variable & ( 0xF0 ) ) >> 4 ;
+/**
+ * @fn     : DS1307_WriteNVRAM
+ * @brief  : This Function Writes a Block of Bytes Into the Battery Backed RAM
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => Offset of First Byte Inside the NVRAM ( 0 - DS1307_NVRAM_SIZE - 1 )
+ * @param  : Data => Bytes to Write
+ * @param  : Size => Number of Bytes to Write
+ * @return : Error State ( NOK if the Block Exceeds the NVRAM )
+ */
+Error_State_t DS1307_WriteNVRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , const uint8_t * Data , uint8_t Size )
+{
+	Error_State_t Error_State = OK ;
 
-	DS1307Readings.Minutes = ( MSB * 10 ) + LSB ;
+	if( NULL == Data )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else if( ( 0 == Size ) || ( ( Offset + Size ) > DS1307_NVRAM_SIZE ) )
+	{
+		Error_State = NOK ;
+	}
+	else
+	{
+		Error_State = DS1307_WriteRegisters( I2CConfig , DS1307_NVRAM_ADD + Offset , Data , Size ) ;
+	}
+	return Error_State ;
+}
 
-	/* HOurs */
+/**
+ * @fn     : DS1307_ReadNVRAM
+ * @brief  : This Function Reads a Block of Bytes From the Battery Backed RAM in One DMA Burst
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => Offset of First Byte Inside the NVRAM ( 0 - DS1307_NVRAM_SIZE - 1 )
+ * @param  : Data => Caller Owned Array to Receive the Bytes in it
+ * @param  : Size => Number of Bytes to Read
+ * @return : Error State ( NOK if the Block Exceeds the NVRAM )
+ */
+Error_State_t DS1307_ReadNVRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , uint8_t * Data , uint8_t Size )
+{
+	Error_State_t Error_State = OK ;
 
-	Local_u8Variable = ReadingsArray[ DS1307_HR_ADD ] ;
+	if( NULL == Data )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else if( ( 0 == Size ) || ( ( Offset + Size ) > DS1307_NVRAM_SIZE ) )
+	{
+		Error_State = NOK ;
+	}
+	else
+	{
+		Error_State = DS1307_ReadRegisters( I2CConfig , DS1307_NVRAM_ADD + Offset , Data , Size ) ;
+	}
+	return Error_State ;
+}
 
-	LSB = Local_u8Variable & ( 0x0F ) ;
-	MSB = ( Local_u8Variable & ( 0xF0 ) ) >>4 ;
+/**
+ * @fn     : DS1307_UpdateDateTime
+ * @brief  : This Function Writes Only the Date & Time Registers That Differ From the RTC
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @return : Error State
+ */
+Error_State_t DS1307_UpdateDateTime( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime )
+{
+	Error_State_t Error_State = OK ;
 
-	DS1307Readings.Hours = ( MSB * 10 ) + LSB ;
+	/* Current Registers ( Read ) & New Registers ( Word Address Not Included ) */
+	uint8_t Current[ DS1307_RECEIVE_ARR_SIZE ] ;
+	uint8_t New[ DS1307_WRITE_ARR_SIZE ] ;
 
-	/* Day */
+	/* New Date & Time in the Hours Format of the RTC */
+	DS1307_Config_t Local_DateTime ;
 
-	DS1307Readings.Day = ReadingsArray[ DS1307_DAY_ADD ] ;
+	uint8_t First = DS1307_RECEIVE_ARR_SIZE ;
+	uint8_t Last = 0 ;
 
-	/* Date */
+	uint8_t Local_u8Register = 0 ;
 
-	Local_u8Variable = ReadingsArray[ DS1307_DATE_ADD ] ;
+	if( NULL == DateTime )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else
+	{
+		/* Read Modify Write , Register Image is Read in One Burst Just Before the Write */
+		Error_State = DS1307_ReadRegisters( I2CConfig , DS1307_FIRST_LOC , Current , DS1307_RECEIVE_ARR_SIZE ) ;
+	}
 
-	LSB = Local_u8Variable & ( 0x0F ) ;
-	MSB = ( Local_u8Variable & ( 0xF0 ) )>>4 ;
+	if( OK == Error_State )
+	{
+		/* Keep the 12 / 24 Hours Mode of the RTC */
+		Local_DateTime = *DateTime ;
+		Local_DateTime.Mode = ( Current[ DS1307_HR_ADD ] & DS1307_12H_MASK ) ? DS1307_12H_MODE : DS1307_24H_MODE ;
+
+		/* New[ 0 ] is the Word Address , Registers Start at New[ 1 ] */
+		DS1307_DateTimetoBCD( &Local_DateTime , New ) ;
+
+		/* Keep the Clock Halt Bit as it is */
+		New[ DS1307_SEC_ADD + 1 ] |= Current[ DS1307_SEC_ADD ] & DS1307_CH_MASK ;
+
+		/* Smallest Contiguous Range of Changed Registers */
+		for( Local_u8Register = DS1307_SEC_ADD ; Local_u8Register <= DS1307_YEAR_ADD ; Local_u8Register++ )
+		{
+			if( New[ Local_u8Register + 1 ] != Current[ Local_u8Register ] )
+			{
+				if( First == DS1307_RECEIVE_ARR_SIZE )
+				{
+					First = Local_u8Register ;
+				}
+				Last = Local_u8Register ;
+			}
+		}
+
+		/* Nothing Written If Nothing Changed , Seconds Are Not Restarted If Not in the Range */
+		if( First != DS1307_RECEIVE_ARR_SIZE )
+		{
+			Error_State = DS1307_WriteRegisters( I2CConfig , First , &New[ First + 1 ] , ( Last - First ) + 1 ) ;
+		}
+	}
+	return Error_State ;
+}
 
-	DS1307Readings.Date = ( MSB * 10 ) + LSB ;
+/**
+ * @fn     : DS1307_WriteDateTime_IT
+ * @brief  : This Function Starts Writing Date & Time Into RTC Module Without Blocking ( I2C Interrupts )
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @param  : ConfigArr => Caller Owned Array of ( DS1307_WRITE_ARR_SIZE ) Bytes , Must Stay Valid Till the Call Back
+ * @param  : CallBack => Function Called From I2C Interrupt When Writing is Done ( NULL If Not Needed )
+ * @return : Error State ( I2C_TRANSFER_BUSY if Another Transfer is Running , ConfigArr is Not Changed Then )
+ */
+Error_State_t DS1307_WriteDateTime_IT( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime , uint8_t * ConfigArr , void (* CallBack)(void) )
+{
+	Error_State_t Error_State = OK ;
 
-	/* Month */
-	Local_u8Variable = ReadingsArray[ DS1307_MONTH_ADD ] ;
+	if( ( NULL == DateTime ) || ( NULL == ConfigArr ) )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else if( I2C_TRANSFER_BUSY == I2C_Get_Transfer_Status( I2CConfig->I2C_Num ) )
+	{
+		/* ConfigArr May Still be Sent By the Running Transfer */
+		Error_State = I2C_TRANSFER_BUSY ;
+	}
+	else
+	{
+		DS1307_DateTimetoBCD( DateTime , ConfigArr ) ;
 
-	LSB = Local_u8Variable & ( 0x0F ) ;
-	MSB = ( Local_u8Variable & ( 0xF0 ) )>>4 ;
+		Error_State = I2C_Master_Transmit_IT( I2CConfig , DS1307_SLAVE_ADDRESS_WRITE , ConfigArr , DS1307_WRITE_ARR_SIZE , CallBack ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS1307_CheckReadings
+ * @brief  : This Function Checks the Timekeeping Registers Read From DS1307
+ * @param  : ReadingsArray => ( DS1307_RECEIVE_ARR_SIZE ) Registers Read From Address 0x00
+ * @return : OK , RTC_CLOCK_HALTED or RTC_INVALID_TIME
+ */
+Error_State_t DS1307_CheckReadings( const uint8_t * ReadingsArray )
+{
+	Error_State_t Error_State = OK ;
+
+	uint8_t Local_u8Register = 0 ;
 
-	DS1307Readings.Month = ( MSB * 10 ) + LSB ;
+	uint8_t Local_u8Hours = 0 ;
 
-	/* Year */
-	Local_u8Variable = ReadingsArray[ DS1307_YEAR_ADD ] ;
+	uint8_t Local_u8MaxHours = DS1307_MAX_HOURS ;
 
-	LSB = Local_u8Variable & ( 0x0F ) ;
-	MSB = ( Local_u8Variable & ( 0xF0 ) ) >> 4 ;
+	uint8_t Local_u8MinHours = 0 ;
 
-	DS1307Readings.Year = ( MSB * 10 ) + LSB ;
+	/* Registers Without Control Bits */
+	uint8_t Registers[ DS1307_RECEIVE_ARR_SIZE ] ;
 
-	return &DS1307Readings ;
+	if( NULL == ReadingsArray )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else
+	{
+		for( Local_u8Register = DS1307_SEC_ADD ; Local_u8Register <= DS1307_YEAR_ADD ; Local_u8Register++ )
+		{
+			Registers[ Local_u8Register ] = ReadingsArray[ Local_u8Register ] ;
+		}
+
+		Registers[ DS1307_SEC_ADD ] &= DS1307_SEC_MASK ;
+
+		if( ReadingsArray[ DS1307_HR_ADD ] & DS1307_12H_MASK )
+		{
+			Registers[ DS1307_HR_ADD ] &= DS1307_12H_HOURS_MASK ;
+			Local_u8MaxHours = DS1307_MAX_12H_HOURS ;
+			Local_u8MinHours = 1 ;
+		}
+		else
+		{
+			Registers[ DS1307_HR_ADD ] &= DS1307_24H_HOURS_MASK ;
+		}
+
+		for( Local_u8Register = DS1307_SEC_ADD ; Local_u8Register <= DS1307_YEAR_ADD ; Local_u8Register++ )
+		{
+			if( !DS1307_IS_BCD( Registers[ Local_u8Register ] ) )
+			{
+				Error_State = RTC_INVALID_TIME ;
+			}
+		}
+
+		if( OK == Error_State )
+		{
+			Local_u8Hours = DS1307_DECODE( Registers[ DS1307_HR_ADD ] ) ;
+
+			if( ( DS1307_DECODE( Registers[ DS1307_SEC_ADD ] ) > DS1307_MAX_SECONDS ) ||
+				( DS1307_DECODE( Registers[ DS1307_MIN_ADD ] ) > DS1307_MAX_MINUTES ) ||
+				( Local_u8Hours < Local_u8MinHours ) || ( Local_u8Hours > Local_u8MaxHours ) ||
+				( Registers[ DS1307_DAY_ADD ] < 1 ) || ( Registers[ DS1307_DAY_ADD ] > DS1307_MAX_DAY ) ||
+				( Registers[ DS1307_DATE_ADD ] < 1 ) || ( DS1307_DECODE( Registers[ DS1307_DATE_ADD ] ) > DS1307_MAX_DATE ) ||
+				( Registers[ DS1307_MONTH_ADD ] < 1 ) || ( DS1307_DECODE( Registers[ DS1307_MONTH_ADD ] ) > DS1307_MAX_MONTH ) ||
+				( DS1307_DECODE( Registers[ DS1307_YEAR_ADD ] ) > DS1307_MAX_YEAR ) )
+			{
+				Error_State = RTC_INVALID_TIME ;
+			}
+		}
+
+		/* A Halted Clock is Reported Before Invalid Values as Restarting it is the First Action */
+		if( ReadingsArray[ DS1307_SEC_ADD ] & DS1307_CH_MASK )
+		{
+			Error_State = RTC_CLOCK_HALTED ;
+		}
+	}
+	return Error_State ;
 }
 
 /**
- * @fn     : DS1307_WriteDateTime
- * @brief  : This Function Writes Data Into RTC Module to Set Date & Time
+ * @fn     : DS1307_StartOscillator
+ * @brief  : This Function Clears the Clock Halt Bit Keeping the Seconds Register Value
  * @param  : I2CConfig => Pointer to Structure of I2C Initialization
- * @param  : Config => Pointer to Structure of DS1307 Configuration of Setting Date & Time
- * @return : void
- * @note   : Before Calling This Function You Should Initialize I2C Pins as ( AF , Open Drain , Pull Up ) Through GPIO
- *           & Initialize a Certain I2C By Using ( I2C_Init )
+ * @return : Error State
  */
-void DS1307_WriteDateTime(I2C_Configs_t * I2CConfig , DS1307_Config_t * DS1307_Config  )
+Error_State_t DS1307_StartOscillator( I2C_Configs_t * I2CConfig )
 {
-	/* To Store In it BCD Values to Be Written to DS1307 Registers */
-	static uint8_t *  PTR = NULL ;
+	Error_State_t Error_State = OK ;
 
-	/* BCD Values Prepare them to Be Transferred to DS1307 RTC */
-	PTR = 	DS1307_DateTimetoBCD(DS1307_Config);
+	uint8_t Seconds = 0 ;
 
-	/*Send the RTC Values*/
-	I2C_Master_Transmit(I2CConfig, DS1307_SLAVE_ADDRESS_WRITE, PTR ,8) ;
+	/* Read Modify Write of the Seconds Register */
+	Error_State = DS1307_ReadRegisters( I2CConfig , DS1307_SEC_ADD , &Seconds , 1 ) ;
 
+	if( ( OK == Error_State ) && ( Seconds & DS1307_CH_MASK ) )
+	{
+		Seconds &= DS1307_SEC_MASK ;
+
+		Error_State = DS1307_WriteRegisters( I2CConfig , DS1307_SEC_ADD , &Seconds , 1 ) ;
+	}
+	return Error_State ;
 }
 
 /**
- * @fn     : DS1307_ReadDateTime
- * @brief  : This Function Reads Data From RTC Module
+ * @fn     : DS1307_WriteRegisters
+ * @brief  : This Function Writes a Block of Contiguous RTC Registers in One Transfer
  * @param  : I2CConfig => Pointer to Structure of I2C Initialization
- * @param  : ReturnDateTime => Pointer to Structure of DS1307 Configuration of to Return Current Date & Time
- * @return : DS_Config_t Pointer
+ * @param  : StartAddress => Address of First Register to Write
+ * @param  : Data => Register Values
+ * @param  : Size => Number of Registers ( Up to DS1307_NVRAM_SIZE )
+ * @return : Error State
  */
-
-DS1307_Config_t * DS1307_ReadDateTime( I2C_Configs_t * I2CConfig )
+static Error_State_t DS1307_WriteRegisters( I2C_Configs_t * I2CConfig , uint8_t StartAddress , const uint8_t * Data , uint8_t Size )
 {
+	Error_State_t Error_State = OK ;
+
+	/* Word Address Followed By the Data , Valid Till the Transfer Ends as This Function Waits For it */
+	uint8_t WriteArr[ DS1307_NVRAM_SIZE + 1 ] ;
+
 	uint8_t Local_u8Counter = 0 ;
 
-	static uint8_t ReceiveArr[ DS1307_RECEIVE_ARR_SIZE ] = { 0 } ;
+	WriteArr[ 0 ] = StartAddress ;
 
-	/* Send Address Packet with Write */
-	I2C_SendAddressPacketMTransmitter(I2CConfig, DS1307_SLAVE_ADDRESS_WRITE) ;
+	for( Local_u8Counter = 0 ; Local_u8Counter < Size ; Local_u8Counter++ )
+	{
+		WriteArr[ Local_u8Counter + 1 ] = Data[ Local_u8Counter ] ;
+	}
 
-	/* Send Word Address To Reset the Pointer */
-	I2C_SendDataPacket(I2CConfig, DS1307_FIRST_LOC) ;
+	/* Wait ( Bounded ) For a Transfer That Still Owns the Bus */
+	I2C_Wait_Transfer( I2CConfig->I2C_Num , DS1307_I2C_TIMEOUT_MS ) ;
 
-	/* Repeated Start & Send Address Packet with Read */
-	I2C_SendAddressPacketMReceiver( I2CConfig , DS1307_SLAVE_ADDRESS_READ ) ;
+	Error_State = I2C_Master_Transmit_IT( I2CConfig , DS1307_SLAVE_ADDRESS_WRITE , WriteArr , Size + 1 , NULL ) ;
 
-	for( Local_u8Counter = 0 ; Local_u8Counter < DS1307_RECEIVE_ARR_SIZE ; Local_u8Counter++ )
+	if( OK == Error_State )
 	{
-		I2C_Master_Receive(I2CConfig, &ReceiveArr[ Local_u8Counter ] ) ;
-
+		Error_State = I2C_Wait_Transfer( I2CConfig->I2C_Num , DS1307_I2C_TIMEOUT_MS ) ;
 	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS1307_EncodeHours
+ * @brief  : This Function Encodes the Hours Register in the Given Format
+ * @param  : Hours => Hours ( 0 - 23 )
+ * @param  : Mode => Format of the Register
+ * @return : Hours Register Value
+ */
+static uint8_t DS1307_EncodeHours( uint8_t Hours , DS1307_HOUR_MODE_t Mode )
+{
+	uint8_t Register = DS1307_ENCODE( Hours ) ;
+
+	uint8_t PM = 0 ;
 
-	I2C_Send_Stop_Condition(I2CConfig->I2C_Num) ;
+	if( DS1307_12H_MODE == Mode )
+	{
+		Register = DS1307_ENCODE( DS1307_HoursTo12( Hours , &PM ) ) ;
 
+		Register |= DS1307_12H_MASK | ( PM ? DS1307_PM_MASK : 0 ) ;
+	}
+	return Register ;
+}
 
-	return  DS1307_BCDToDateTime(ReceiveArr) ;
+/**
+ * @fn     : DS1307_DecodeHours
+ * @brief  : This Function Decodes the Hours Register in Either Format
+ * @param  : Register => Hours Register Value
+ * @return : Hours ( 0 - 23 )
+ */
+static uint8_t DS1307_DecodeHours( uint8_t Register )
+{
+	uint8_t Hours = DS1307_DECODE( Register & DS1307_24H_HOURS_MASK ) ;
 
+	if( Register & DS1307_12H_MASK )
+	{
+		/* Bit 5 is the PM Bit Not a Tens Digit */
+		Hours = DS1307_HoursTo24( DS1307_DECODE( Register & DS1307_12H_HOURS_MASK ) , Register & DS1307_PM_MASK ) ;
+	}
+	return Hours ;
 }
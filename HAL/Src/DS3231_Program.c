@@ -0,0 +1,413 @@
+/*******************************************************************************
+ * Filename              :   DS3231_Program.c
+ * Author                :   Mohamemd Waleed Gad
+ * Origin Date           :   Aug 30, 2023
+ * Version               :   1.0.0
+ * Compiler              :   GCC ARM Embedded Toolchain
+ * Target                :
+ * Notes                 :   None
+ **
+ *******************************************************************************/
+/************************ SOURCE REVISION LOG *********************************
+ *
+ *    Date    Version   Author             Description
+ *  30/08/23   1.0.0   Mohamemd Waleed   Initial Release.
+ *
+ *******************************************************************************/
+
+/* ================================================================= *
+ *                            INCLUDES                               *
+ * ================================================================= */
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/I2C_Interface.h"
+
+#include "../Inc/DS1307_Interface.h"
+#include "../Inc/DS3231_Interface.h"
+#include "../Inc/DS3231_Private.h"
+
+/* ================================================================= *
+ *                            IMPLEMENTATION                         *
+ * ================================================================= */
+
+
+/* Word Address of Each Register , Sent From Here So No Transfer Shares a Mutable Buffer */
+static const uint8_t DS3231_WordAddresses[ DS3231_REGISTERS_SIZE ] =
+{
+	0x00 , 0x01 , 0x02 , 0x03 , 0x04 , 0x05 , 0x06 , 0x07 , 0x08 , 0x09 , 0x0A , 0x0B , 0x0C , 0x0D , 0x0E , 0x0F ,
+	0x10 , 0x11 , 0x12
+} ;
+
+/* RS2 : RS1 Bits Indexed By DS1307_SQW_RATE_t */
+static const uint8_t DS3231_SquareWaveRS[ 4 ] = { DS3231_RS_1HZ , DS3231_RS_4096HZ , DS3231_RS_8192HZ , DS3231_RS_NONE } ;
+
+/* Alarm Write is Queued From Interrupts , Descriptor & Registers Must Stay Valid Till it Ends */
+static I2C_Transaction_t DS3231_AlarmTransaction ;
+static uint8_t DS3231_AlarmArr[ DS3231_ALARM_ARR_SIZE ] ;
+
+/**
+ * @fn     : DS3231_BCDToDateTime
+ * @brief  : This Function Converts the BCD Registers Read From DS3231 to Normal Date & Time Values
+ * @param  : ReadingsArray => ( DS1307_RECEIVE_ARR_SIZE ) Registers Read From Address 0x00
+ * @param  : DateTime => Caller Owned Structure to Fill
+ * @return : void
+ */
+void DS3231_BCDToDateTime( const uint8_t * ReadingsArray , DS1307_Config_t * DateTime )
+{
+	uint8_t Registers[ DS1307_RECEIVE_ARR_SIZE ] ;
+
+	uint8_t Local_u8Register = 0 ;
+
+	for( Local_u8Register = 0 ; Local_u8Register < DS1307_RECEIVE_ARR_SIZE ; Local_u8Register++ )
+	{
+		Registers[ Local_u8Register ] = ReadingsArray[ Local_u8Register ] ;
+	}
+
+	/* Year Register Holds Only Two Digits , the Century Bit is Not Part of the Month */
+	Registers[ DS3231_MONTH_ADD ] &= ( uint8_t )~DS3231_CENTURY_MASK ;
+
+	DS1307_BCDToDateTime( Registers , DateTime ) ;
+}
+
+/**
+ * @fn     : DS3231_CheckReadings
+ * @brief  : This Function Checks the Timekeeping Registers Read From DS3231
+ * @param  : ReadingsArray => ( DS1307_RECEIVE_ARR_SIZE ) Registers Read From Address 0x00
+ * @return : OK or RTC_INVALID_TIME if a Register is Not a Valid BCD Value in Range
+ */
+Error_State_t DS3231_CheckReadings( const uint8_t * ReadingsArray )
+{
+	Error_State_t Error_State = OK ;
+
+	uint8_t Registers[ DS1307_RECEIVE_ARR_SIZE ] ;
+
+	uint8_t Local_u8Register = 0 ;
+
+	if( NULL == ReadingsArray )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else
+	{
+		for( Local_u8Register = 0 ; Local_u8Register < DS1307_RECEIVE_ARR_SIZE ; Local_u8Register++ )
+		{
+			Registers[ Local_u8Register ] = ReadingsArray[ Local_u8Register ] ;
+		}
+
+		Registers[ DS3231_MONTH_ADD ] &= ( uint8_t )~DS3231_CENTURY_MASK ;
+
+		/* Same Ranges as DS1307 , Bit 7 of the Seconds Register is Always 0 Here So No Halt is Reported */
+		Error_State = DS1307_CheckReadings( Registers ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS3231_ReadRegisters_DMA
+ * @brief  : This Function Starts Reading a Block of RTC Registers in One I2C Transaction Using DMA
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Read
+ * @param  : ReceiveArr => Caller Owned Array to Receive the Registers in it
+ * @param  : Size => Number of Registers to Read ( Up to DS3231_REGISTERS_SIZE )
+ * @param  : CallBack => Function Called From Interrupt When Reading is Done
+ * @return : Error State ( NOK if the Block Exceeds the Register Space )
+ */
+Error_State_t DS3231_ReadRegisters_DMA( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size , void (* CallBack)(void) )
+{
+	Error_State_t Error_State = OK ;
+
+	if( ( 0 == Size ) || ( ( StartAddress + Size ) > DS3231_REGISTERS_SIZE ) )
+	{
+		Error_State = NOK ;
+	}
+	else
+	{
+		/* Write Word Address , Repeated Start & Let DMA Read the Whole Block */
+		Error_State = I2C_Master_Transfer_DMA( I2CConfig , DS3231_SLAVE_ADDRESS_WRITE , &DS3231_WordAddresses[ StartAddress ] , 1 , ReceiveArr , Size , CallBack ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS3231_ReadRegisters
+ * @brief  : This Function Reads a Block of RTC Registers in One DMA Burst & Waits For it
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Read
+ * @param  : ReceiveArr => Caller Owned Array to Receive the Registers in it
+ * @param  : Size => Number of Registers to Read ( Up to DS3231_REGISTERS_SIZE )
+ * @return : Error State
+ */
+Error_State_t DS3231_ReadRegisters( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size )
+{
+	Error_State_t Error_State = OK ;
+
+	/* Wait ( Bounded ) For a Transfer That Still Owns the Bus */
+	I2C_Wait_Transfer( I2CConfig->I2C_Num , DS3231_I2C_TIMEOUT_MS ) ;
+
+	Error_State = DS3231_ReadRegisters_DMA( I2CConfig , StartAddress , ReceiveArr , Size , NULL ) ;
+
+	/* ReceiveArr is Valid Only After the Transfer Ended */
+	if( OK == Error_State )
+	{
+		Error_State = I2C_Wait_Transfer( I2CConfig->I2C_Num , DS3231_I2C_TIMEOUT_MS ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS3231_ReadDateTime
+ * @brief  : This Function Reads Date & Time From RTC Module
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => Caller Owned Structure to Return Current Date & Time in
+ * @return : Error State ( DateTime is Not Changed on Failure )
+ */
+Error_State_t DS3231_ReadDateTime( I2C_Configs_t * I2CConfig , DS1307_Config_t * DateTime )
+{
+	Error_State_t Error_State = OK ;
+
+	/* Valid Till the Transfer Ends as This Function Waits For it */
+	uint8_t ReceiveArr[ DS1307_RECEIVE_ARR_SIZE ] ;
+
+	/* Read All Time Registers in One Burst */
+	Error_State = DS3231_ReadRegisters( I2CConfig , DS3231_SEC_ADD , ReceiveArr , DS1307_RECEIVE_ARR_SIZE ) ;
+
+	if( OK == Error_State )
+	{
+		DS3231_BCDToDateTime( ReceiveArr , DateTime ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS3231_WriteDateTime
+ * @brief  : This Function Writes Date & Time Into RTC Module & Clears the Oscillator Stop Flag
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @return : Error State
+ */
+Error_State_t DS3231_WriteDateTime( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime )
+{
+	Error_State_t Error_State = OK ;
+
+	/* Word Address + Registers , Same Encoding as DS1307 With the Century Bit Cleared */
+	uint8_t ConfigArr[ DS1307_WRITE_ARR_SIZE ] ;
+
+	/* Alarm Flags Are Written as 1 So They Are Kept , Only OSF is Cleared */
+	uint8_t Status = DS3231_EN32KHZ_MASK | DS3231_A2F_MASK | DS3231_A1F_MASK ;
+
+	if( NULL == DateTime )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else
+	{
+		DS1307_DateTimetoBCD( DateTime , ConfigArr ) ;
+
+		Error_State = DS3231_WriteRegisters( I2CConfig , DS3231_SEC_ADD , &ConfigArr[ 1 ] , DS1307_RECEIVE_ARR_SIZE ) ;
+	}
+
+	/* Time is Valid Again */
+	if( OK == Error_State )
+	{
+		Error_State = DS3231_WriteRegisters( I2CConfig , DS3231_STATUS_ADD , &Status , 1 ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS3231_ReadOscillatorStop
+ * @brief  : This Function Reads the Oscillator Stop Flag ( OSF ) of the Status Register
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Stopped => Returns 1 If the Oscillator Stopped Since the Flag Was Cleared , 0 If Not
+ * @return : Error State
+ */
+Error_State_t DS3231_ReadOscillatorStop( I2C_Configs_t * I2CConfig , uint8_t * Stopped )
+{
+	Error_State_t Error_State = OK ;
+
+	uint8_t Status = 0 ;
+
+	if( NULL == Stopped )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else
+	{
+		Error_State = DS3231_ReadRegisters( I2CConfig , DS3231_STATUS_ADD , &Status , 1 ) ;
+	}
+
+	if( OK == Error_State )
+	{
+		*Stopped = ( Status & DS3231_OSF_MASK ) ? 1 : 0 ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS3231_StartOscillator
+ * @brief  : This Function Keeps the Oscillator Running on Battery ( EOSC = 0 ) & Clears the Oscillator Stop Flag
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @return : Error State
+ */
+Error_State_t DS3231_StartOscillator( I2C_Configs_t * I2CConfig )
+{
+	Error_State_t Error_State = OK ;
+
+	/* Control & Status Registers */
+	uint8_t Registers[ 2 ] = { 0 } ;
+
+	/* Read Modify Write of Both Registers in One Burst Each */
+	Error_State = DS3231_ReadRegisters( I2CConfig , DS3231_CONTROL_ADD , Registers , 2 ) ;
+
+	if( OK == Error_State )
+	{
+		Registers[ 0 ] &= ( uint8_t )~DS3231_EOSC_MASK ;
+
+		/* Alarm Flags Written as 1 Are Kept */
+		Registers[ 1 ] = ( Registers[ 1 ] & ( uint8_t )~DS3231_OSF_MASK ) | DS3231_A2F_MASK | DS3231_A1F_MASK ;
+
+		Error_State = DS3231_WriteRegisters( I2CConfig , DS3231_CONTROL_ADD , Registers , 2 ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS3231_EnableSquareWave
+ * @brief  : This Function Routes the Square Wave to INT/SQW Pin
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Rate => Frequency of the Square Wave ( DS1307_SQW_32768HZ is Not Available on INT/SQW )
+ * @return : Error State ( NOK if the Rate is Not Available )
+ */
+Error_State_t DS3231_EnableSquareWave( I2C_Configs_t * I2CConfig , DS1307_SQW_RATE_t Rate )
+{
+	Error_State_t Error_State = OK ;
+
+	uint8_t Control = 0 ;
+
+	if( ( Rate > DS1307_SQW_32768HZ ) || ( DS3231_RS_NONE == DS3231_SquareWaveRS[ Rate ] ) )
+	{
+		Error_State = NOK ;
+	}
+	else
+	{
+		Error_State = DS3231_ReadRegisters( I2CConfig , DS3231_CONTROL_ADD , &Control , 1 ) ;
+	}
+
+	if( OK == Error_State )
+	{
+		/* INTCN Cleared Gives the Pin to the Square Wave , Alarm Interrupts Would Not Reach it */
+		Control &= ( uint8_t )~( DS3231_RS_MASK | DS3231_INTCN_MASK | DS3231_A2IE_MASK | DS3231_A1IE_MASK ) ;
+		Control |= ( uint8_t )( DS3231_SquareWaveRS[ Rate ] << DS3231_RS_SHIFT ) ;
+
+		Error_State = DS3231_WriteRegisters( I2CConfig , DS3231_CONTROL_ADD , &Control , 1 ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS3231_SetAlarm_IT
+ * @brief  : This Function Starts Programming Alarm 1 to Match a Date & Time & Drive INT/SQW Low on the Match
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Time => Date , Hours , Minutes & Seconds of the Alarm , NULL to Disable the Alarm Interrupt
+ * @return : Error State ( I2C_TRANSFER_BUSY if the Previous Alarm Write is Still Queued )
+ */
+Error_State_t DS3231_SetAlarm_IT( I2C_Configs_t * I2CConfig , const DS1307_Config_t * Time )
+{
+	Error_State_t Error_State = OK ;
+
+	/* Word Address + Time Registers , Only Seconds , Minutes , Hours & Date Are Used */
+	uint8_t Encoded[ DS1307_WRITE_ARR_SIZE ] = { 0 } ;
+
+	uint8_t Local_u8Counter = 0 ;
+
+	if( NULL == I2CConfig )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else if( I2C_TRANSFER_BUSY == DS3231_AlarmTransaction.Status )
+	{
+		/* Registers May Still be Sent By the Queued Write */
+		Error_State = I2C_TRANSFER_BUSY ;
+	}
+	else
+	{
+		if( NULL != Time )
+		{
+			DS1307_DateTimetoBCD( Time , Encoded ) ;
+		}
+
+		/* One Write From Alarm 1 Seconds to Status : Alarm 2 is Cleared & Left Disabled */
+		for( Local_u8Counter = 0 ; Local_u8Counter < DS3231_ALARM_ARR_SIZE ; Local_u8Counter++ )
+		{
+			DS3231_AlarmArr[ Local_u8Counter ] = 0 ;
+		}
+
+		DS3231_AlarmArr[ 0 ] = DS3231_ALARM1_ADD ;
+		DS3231_AlarmArr[ 1 ] = Encoded[ 1 ] ;		/* Seconds */
+		DS3231_AlarmArr[ 2 ] = Encoded[ 2 ] ;		/* Minutes */
+		DS3231_AlarmArr[ 3 ] = Encoded[ 3 ] ;		/* Hours ( 24 Hours Mode ) */
+
+		/* A1M4 & DY/DT Cleared : Matches Date , Hours , Minutes & Seconds ( Once a Month at Most ) */
+		DS3231_AlarmArr[ DS3231_A1_DAY_INDEX ] = Encoded[ DS3231_ENCODED_DATE_INDEX ] ;
+
+		DS3231_AlarmArr[ DS3231_CONTROL_INDEX ] = DS3231_INTCN_MASK | ( ( NULL != Time ) ? DS3231_A1IE_MASK : 0 ) ;
+
+		/* Alarm Flags Cleared So INT/SQW is Released , OSF Written as 1 is Kept */
+		DS3231_AlarmArr[ DS3231_STATUS_INDEX ] = DS3231_OSF_MASK | DS3231_EN32KHZ_MASK ;
+
+		DS3231_AlarmTransaction.Device        = I2CConfig ;
+		DS3231_AlarmTransaction.SlaveADD      = DS3231_SLAVE_ADDRESS_WRITE ;
+		DS3231_AlarmTransaction.TxData        = DS3231_AlarmArr ;
+		DS3231_AlarmTransaction.TxSize        = DS3231_ALARM_ARR_SIZE ;
+		DS3231_AlarmTransaction.RxData        = NULL ;
+		DS3231_AlarmTransaction.RxSize        = 0 ;
+		DS3231_AlarmTransaction.RepeatedStart = DISABLED ;
+		DS3231_AlarmTransaction.UseDMA        = DISABLED ;
+		DS3231_AlarmTransaction.Timeout_ms    = DS3231_I2C_TIMEOUT_MS ;
+		DS3231_AlarmTransaction.CallBackFunc  = NULL ;
+
+		/* Queued Behind Any Running Transfer , Nothing Here Waits For the Bus */
+		Error_State = I2C_Submit_Transaction( &DS3231_AlarmTransaction ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : DS3231_WriteRegisters
+ * @brief  : This Function Writes a Block of Contiguous RTC Registers in One Transfer
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Write
+ * @param  : Data => Register Values
+ * @param  : Size => Number of Registers ( Up to DS3231_REGISTERS_SIZE )
+ * @return : Error State
+ */
+static Error_State_t DS3231_WriteRegisters( I2C_Configs_t * I2CConfig , uint8_t StartAddress , const uint8_t * Data , uint8_t Size )
+{
+	Error_State_t Error_State = OK ;
+
+	/* Word Address Followed By the Data , Valid Till the Transfer Ends as This Function Waits For it */
+	uint8_t WriteArr[ DS3231_REGISTERS_SIZE + 1 ] ;
+
+	uint8_t Local_u8Counter = 0 ;
+
+	WriteArr[ 0 ] = StartAddress ;
+
+	for( Local_u8Counter = 0 ; Local_u8Counter < Size ; Local_u8Counter++ )
+	{
+		WriteArr[ Local_u8Counter + 1 ] = Data[ Local_u8Counter ] ;
+	}
+
+	/* Wait ( Bounded ) For a Transfer That Still Owns the Bus */
+	I2C_Wait_Transfer( I2CConfig->I2C_Num , DS3231_I2C_TIMEOUT_MS ) ;
+
+	Error_State = I2C_Master_Transmit_IT( I2CConfig , DS3231_SLAVE_ADDRESS_WRITE , WriteArr , Size + 1 , NULL ) ;
+
+	if( OK == Error_State )
+	{
+		Error_State = I2C_Wait_Transfer( I2CConfig->I2C_Num , DS3231_I2C_TIMEOUT_MS ) ;
+	}
+	return Error_State ;
+}
@@ -0,0 +1,432 @@
+/*******************************************************************************
+ * Filename              :   RTC_Program.c
+ * Author                :   Mohamemd Waleed Gad
+ * Origin Date           :   Aug 30, 2023
+ * Version               :   1.0.0
+ * Compiler              :   GCC ARM Embedded Toolchain
+ * Target                :
+ * Notes                 :   None
+ **
+ *******************************************************************************/
+/************************ SOURCE REVISION LOG *********************************
+ *
+ *    Date    Version   Author             Description
+ *  30/08/23   1.0.0   Mohamemd Waleed   Initial Release.
+ *
+ *******************************************************************************/
+
+/* ================================================================= *
+ *                            INCLUDES                               *
+ * ================================================================= */
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/I2C_Interface.h"
+
+#include "../Inc/DS1307_Interface.h"
+#include "../Inc/DS3231_Interface.h"
+#include "../Inc/RTC_Interface.h"
+#include "../Inc/RTC_Private.h"
+
+/* ================================================================= *
+ *                            IMPLEMENTATION                         *
+ * ================================================================= */
+
+
+static const RTC_Driver_t RTC_DS1307_Driver =
+{
+	.Type              = RTC_DS1307 ,
+	.NVRAM_Size        = DS1307_NVRAM_SIZE ,
+	.ReadDateTime      = &DS1307_ReadDateTime ,
+	.WriteDateTime     = &DS1307_WriteDateTime ,
+	.UpdateDateTime    = &DS1307_UpdateDateTime ,
+	.WriteDateTime_IT  = &DS1307_WriteDateTime_IT ,
+	.ReadRegisters_DMA = &DS1307_ReadRegisters_DMA ,
+	.BCDToDateTime     = &DS1307_BCDToDateTime ,
+	.CheckReadings     = &DS1307_CheckReadings ,
+	.GetHealth         = &RTC_DS1307_GetHealth ,
+	.StartOscillator   = &DS1307_StartOscillator ,
+	.EnableSquareWave  = &DS1307_EnableSquareWave ,
+	.SetAlarm_IT       = NULL ,
+	.WriteNVRAM        = &DS1307_WriteNVRAM ,
+	.ReadNVRAM         = &DS1307_ReadNVRAM
+} ;
+
+/* Timekeeping Registers Are the Same as DS1307 , the Changed Only & Non Blocking Writes Are Shared */
+static const RTC_Driver_t RTC_DS3231_Driver =
+{
+	.Type              = RTC_DS3231 ,
+	.NVRAM_Size        = 0 ,
+	.ReadDateTime      = &DS3231_ReadDateTime ,
+	.WriteDateTime     = &DS3231_WriteDateTime ,
+	.UpdateDateTime    = &DS1307_UpdateDateTime ,
+	.WriteDateTime_IT  = &DS1307_WriteDateTime_IT ,
+	.ReadRegisters_DMA = &DS3231_ReadRegisters_DMA ,
+	.BCDToDateTime     = &DS3231_BCDToDateTime ,
+	.CheckReadings     = &DS3231_CheckReadings ,
+	.GetHealth         = &RTC_DS3231_GetHealth ,
+	.StartOscillator   = &DS3231_StartOscillator ,
+	.EnableSquareWave  = &DS3231_EnableSquareWave ,
+	.SetAlarm_IT       = &DS3231_SetAlarm_IT ,
+	.WriteNVRAM        = NULL ,
+	.ReadNVRAM         = NULL
+} ;
+
+/* Driver Selected By ( RTC_Init ) */
+static const RTC_Driver_t * RTC_Driver = &RTC_DS1307_Driver ;
+
+/**
+ * @fn     : RTC_Init
+ * @brief  : This Function Probes the Bus & Selects the Driver of the Found RTC Chip
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @return : Error State ( DS1307 Driver is Kept If the Probe Failed )
+ */
+Error_State_t RTC_Init( I2C_Configs_t * I2CConfig )
+{
+	Error_State_t Error_State = OK ;
+
+	uint8_t IsDS3231 = 0 ;
+
+	if( NULL == I2CConfig )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else
+	{
+		Error_State = RTC_ProbeDS3231( I2CConfig , &IsDS3231 ) ;
+
+		RTC_Driver = ( ( OK == Error_State ) && IsDS3231 ) ? &RTC_DS3231_Driver : &RTC_DS1307_Driver ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : RTC_GetDriver
+ * @brief  : This Function Returns the Driver Selected at Init
+ * @return : Selected Driver
+ */
+const RTC_Driver_t * RTC_GetDriver( void )
+{
+	return RTC_Driver ;
+}
+
+/**
+ * @fn     : RTC_HasHardwareAlarm
+ * @brief  : This Function Tells If the Selected RTC Can Signal an Alarm on its INT Pin
+ * @return : 1 If ( RTC_SetAlarm_IT ) is Available , 0 If Not
+ */
+uint8_t RTC_HasHardwareAlarm( void )
+{
+	return ( NULL != RTC_Driver->SetAlarm_IT ) ? 1 : 0 ;
+}
+
+/**
+ * @fn     : RTC_ReadDateTime
+ * @brief  : This Function Reads Date & Time From the RTC
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => Caller Owned Structure to Return Current Date & Time in
+ * @return : Error State ( DateTime is Not Changed on Failure )
+ */
+Error_State_t RTC_ReadDateTime( I2C_Configs_t * I2CConfig , DS1307_Config_t * DateTime )
+{
+	return RTC_Driver->ReadDateTime( I2CConfig , DateTime ) ;
+}
+
+/**
+ * @fn     : RTC_WriteDateTime
+ * @brief  : This Function Writes All Date & Time Registers & Restarts a Stopped Oscillator
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @return : Error State
+ */
+Error_State_t RTC_WriteDateTime( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime )
+{
+	return RTC_Driver->WriteDateTime( I2CConfig , DateTime ) ;
+}
+
+/**
+ * @fn     : RTC_UpdateDateTime
+ * @brief  : This Function Writes Only the Date & Time Registers That Differ From the RTC
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @return : Error State
+ */
+Error_State_t RTC_UpdateDateTime( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime )
+{
+	return RTC_Driver->UpdateDateTime( I2CConfig , DateTime ) ;
+}
+
+/**
+ * @fn     : RTC_WriteDateTime_IT
+ * @brief  : This Function Starts Writing Date & Time Without Blocking
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : DateTime => New Date & Time
+ * @param  : ConfigArr => Caller Owned Array of ( DS1307_WRITE_ARR_SIZE ) Bytes , Must Stay Valid Till the Call Back
+ * @param  : CallBack => Function Called From I2C Interrupt When Writing is Done ( NULL If Not Needed )
+ * @return : Error State ( I2C_TRANSFER_BUSY if Another Transfer is Running , ConfigArr is Not Changed Then )
+ */
+Error_State_t RTC_WriteDateTime_IT( I2C_Configs_t * I2CConfig , const DS1307_Config_t * DateTime , uint8_t * ConfigArr , void (* CallBack)(void) )
+{
+	return RTC_Driver->WriteDateTime_IT( I2CConfig , DateTime , ConfigArr , CallBack ) ;
+}
+
+/**
+ * @fn     : RTC_ReadRegisters_DMA
+ * @brief  : This Function Starts Reading a Block of RTC Registers in One I2C Transaction Using DMA
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : StartAddress => Address of First Register to Read
+ * @param  : ReceiveArr => Caller Owned Array to Receive the Registers in it
+ * @param  : Size => Number of Registers to Read
+ * @param  : CallBack => Function Called From Interrupt When Reading is Done
+ * @return : Error State ( NOK if the Block Exceeds the Register Space of the Chip )
+ */
+Error_State_t RTC_ReadRegisters_DMA( I2C_Configs_t * I2CConfig , uint8_t StartAddress , uint8_t * ReceiveArr , uint8_t Size , void (* CallBack)(void) )
+{
+	return RTC_Driver->ReadRegisters_DMA( I2CConfig , StartAddress , ReceiveArr , Size , CallBack ) ;
+}
+
+/**
+ * @fn     : RTC_BCDToDateTime
+ * @brief  : This Function Converts the Timekeeping Registers to Date & Time
+ * @param  : ReadingsArray => ( DS1307_RECEIVE_ARR_SIZE ) Registers Read From Address 0x00
+ * @param  : DateTime => Caller Owned Structure to Fill
+ * @return : void
+ */
+void RTC_BCDToDateTime( const uint8_t * ReadingsArray , DS1307_Config_t * DateTime )
+{
+	RTC_Driver->BCDToDateTime( ReadingsArray , DateTime ) ;
+}
+
+/**
+ * @fn     : RTC_CheckReadings
+ * @brief  : This Function Checks the Timekeeping Registers
+ * @param  : ReadingsArray => ( DS1307_RECEIVE_ARR_SIZE ) Registers Read From Address 0x00
+ * @return : OK , RTC_CLOCK_HALTED ( DS1307 Only ) or RTC_INVALID_TIME
+ */
+Error_State_t RTC_CheckReadings( const uint8_t * ReadingsArray )
+{
+	return RTC_Driver->CheckReadings( ReadingsArray ) ;
+}
+
+/**
+ * @fn     : RTC_GetHealth
+ * @brief  : This Function Checks If the Oscillator Was Stopped & If the Registers Hold a Valid Date & Time
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Health => Returns Health Flags ( RTC_HEALTH_HALTED , RTC_HEALTH_INVALID )
+ * @return : Error State
+ */
+Error_State_t RTC_GetHealth( I2C_Configs_t * I2CConfig , uint8_t * Health )
+{
+	Error_State_t Error_State = OK ;
+
+	if( ( NULL == I2CConfig ) || ( NULL == Health ) )
+	{
+		Error_State = Null_Pointer ;
+	}
+	else
+	{
+		*Health = RTC_HEALTH_OK ;
+
+		Error_State = RTC_Driver->GetHealth( I2CConfig , Health ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : RTC_StartOscillator
+ * @brief  : This Function Restarts a Stopped Oscillator Keeping the Time Registers
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @return : Error State
+ */
+Error_State_t RTC_StartOscillator( I2C_Configs_t * I2CConfig )
+{
+	return RTC_Driver->StartOscillator( I2CConfig ) ;
+}
+
+/**
+ * @fn     : RTC_EnableSquareWave
+ * @brief  : This Function Enables the Square Wave Output
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Rate => Frequency of the Square Wave
+ * @return : Error State ( NOK if the Rate is Not Available on the Chip )
+ */
+Error_State_t RTC_EnableSquareWave( I2C_Configs_t * I2CConfig , DS1307_SQW_RATE_t Rate )
+{
+	return RTC_Driver->EnableSquareWave( I2CConfig , Rate ) ;
+}
+
+/**
+ * @fn     : RTC_SetAlarm_IT
+ * @brief  : This Function Starts Programming the Hardware Alarm
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Time => Date , Hours , Minutes & Seconds of the Alarm , NULL to Disable it
+ * @return : Error State ( NOK if the Chip Has No Hardware Alarm )
+ */
+Error_State_t RTC_SetAlarm_IT( I2C_Configs_t * I2CConfig , const DS1307_Config_t * Time )
+{
+	Error_State_t Error_State = NOK ;
+
+	if( NULL != RTC_Driver->SetAlarm_IT )
+	{
+		Error_State = RTC_Driver->SetAlarm_IT( I2CConfig , Time ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : RTC_WriteNVRAM
+ * @brief  : This Function Writes a Block of Bytes Into the Battery Backed RAM
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => Offset of First Byte Inside the NVRAM
+ * @param  : Data => Bytes to Write
+ * @param  : Size => Number of Bytes to Write
+ * @return : Error State ( NOK if the Chip Has No NVRAM or the Block Exceeds it )
+ */
+Error_State_t RTC_WriteNVRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , const uint8_t * Data , uint8_t Size )
+{
+	Error_State_t Error_State = NOK ;
+
+	if( NULL != RTC_Driver->WriteNVRAM )
+	{
+		Error_State = RTC_Driver->WriteNVRAM( I2CConfig , Offset , Data , Size ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : RTC_ReadNVRAM
+ * @brief  : This Function Reads a Block of Bytes From the Battery Backed RAM
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Offset => Offset of First Byte Inside the NVRAM
+ * @param  : Data => Caller Owned Array to Receive the Bytes in it
+ * @param  : Size => Number of Bytes to Read
+ * @return : Error State ( NOK if the Chip Has No NVRAM or the Block Exceeds it )
+ */
+Error_State_t RTC_ReadNVRAM( I2C_Configs_t * I2CConfig , uint8_t Offset , uint8_t * Data , uint8_t Size )
+{
+	Error_State_t Error_State = NOK ;
+
+	if( NULL != RTC_Driver->ReadNVRAM )
+	{
+		Error_State = RTC_Driver->ReadNVRAM( I2CConfig , Offset , Data , Size ) ;
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : RTC_ProbeDS3231
+ * @brief  : This Function Checks If the Chip at the RTC Address is a DS3231
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : IsDS3231 => Returns 1 If a DS3231 Answered , 0 If Not
+ * @return : Error State
+ * @note   : Both Chips Answer at 0x68 , a DS3231 Read Starting at its Last Register ( Temperature LSB , Low Six Bits 0 )
+ *           Wraps to Seconds & Minutes , the Same Read on DS1307 Returns NVRAM Bytes
+ */
+static Error_State_t RTC_ProbeDS3231( I2C_Configs_t * I2CConfig , uint8_t * IsDS3231 )
+{
+	Error_State_t Error_State = OK ;
+
+	uint8_t Wrapped[ RTC_PROBE_SIZE ] ;
+	uint8_t Direct[ 2 ] ;
+
+	uint8_t Local_u8Try = 0 ;
+
+	*IsDS3231 = 0 ;
+
+	for( Local_u8Try = 0 ; ( Local_u8Try < RTC_PROBE_TRIES ) && ( OK == Error_State ) && !( *IsDS3231 ) ; Local_u8Try++ )
+	{
+		/* DS1307 Register Space Covers the Whole Block So the Read is Valid on Both Chips */
+		Error_State = DS1307_ReadRegisters( I2CConfig , DS3231_TEMP_LSB_ADD , Wrapped , RTC_PROBE_SIZE ) ;
+
+		if( OK == Error_State )
+		{
+			Error_State = DS1307_ReadRegisters( I2CConfig , DS1307_FIRST_LOC , Direct , 2 ) ;
+		}
+
+		if( OK == Error_State )
+		{
+			*IsDS3231 = ( 0 == ( Wrapped[ RTC_PROBE_TEMP_INDEX ] & DS3231_TEMP_LSB_MASK ) ) &&
+						( Wrapped[ RTC_PROBE_SEC_INDEX ] == Direct[ 0 ] ) &&
+						( Wrapped[ RTC_PROBE_MIN_INDEX ] == Direct[ 1 ] ) ;
+		}
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : RTC_DS1307_GetHealth
+ * @brief  : This Function Checks the Clock Halt Bit & the Timekeeping Registers of DS1307
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Health => Returns Health Flags
+ * @return : Error State
+ */
+static Error_State_t RTC_DS1307_GetHealth( I2C_Configs_t * I2CConfig , uint8_t * Health )
+{
+	Error_State_t Error_State = OK ;
+
+	Error_State_t Readings_State = OK ;
+
+	uint8_t Readings[ DS1307_RECEIVE_ARR_SIZE ] ;
+
+	/* All Timekeeping Registers in One Burst */
+	Error_State = DS1307_ReadRegisters( I2CConfig , DS1307_FIRST_LOC , Readings , DS1307_RECEIVE_ARR_SIZE ) ;
+
+	if( OK == Error_State )
+	{
+		Readings_State = DS1307_CheckReadings( Readings ) ;
+
+		if( RTC_CLOCK_HALTED == Readings_State )
+		{
+			/* Time Did Not Advance While Halted , Check the Registers Without the CH Bit Too */
+			*Health |= RTC_HEALTH_HALTED ;
+
+			Readings[ DS1307_FIRST_LOC ] &= ( uint8_t )~DS1307_CH_MASK ;
+			Readings_State = DS1307_CheckReadings( Readings ) ;
+		}
+
+		if( RTC_INVALID_TIME == Readings_State )
+		{
+			*Health |= RTC_HEALTH_INVALID ;
+		}
+	}
+	return Error_State ;
+}
+
+/**
+ * @fn     : RTC_DS3231_GetHealth
+ * @brief  : This Function Checks the Oscillator Stop Flag & the Timekeeping Registers of DS3231
+ * @param  : I2CConfig => Pointer to Structure of I2C Initialization
+ * @param  : Health => Returns Health Flags
+ * @return : Error State
+ */
+static Error_State_t RTC_DS3231_GetHealth( I2C_Configs_t * I2CConfig , uint8_t * Health )
+{
+	Error_State_t Error_State = OK ;
+
+	uint8_t Readings[ DS1307_RECEIVE_ARR_SIZE ] ;
+
+	uint8_t Stopped = 0 ;
+
+	Error_State = DS3231_ReadOscillatorStop( I2CConfig , &Stopped ) ;
+
+	if( OK == Error_State )
+	{
+		Error_State = DS3231_ReadRegisters( I2CConfig , DS1307_FIRST_LOC , Readings , DS1307_RECEIVE_ARR_SIZE ) ;
+	}
+
+	if( OK == Error_State )
+	{
+		if( Stopped )
+		{
+			*Health |= RTC_HEALTH_HALTED ;
+		}
+
+		if( RTC_INVALID_TIME == DS3231_CheckReadings( Readings ) )
+		{
+			*Health |= RTC_HEALTH_INVALID ;
+		}
+	}
+	return Error_State ;
+}
@@ -71,6 +71,15 @@ typedef enum  {  NOK , OK ,Null_Pointer,InvalidPORTPIN,DMA_OK,DMA_NOK,DMA_WRONG_
 	,I2C_WRONG_ADDRESS_VALUE
 	,I2C_WRONG_ADDRESS_MODE_STATE
 	,I2C_WRONG_ACK_STATE
+	,I2C_TRANSFER_BUSY
+	,I2C_ACK_FAILURE
+	,I2C_BUS_ERROR
+	,I2C_ARBITRATION_LOST
+	,I2C_OVERRUN
+	,I2C_DMA_ERROR
+	,I2C_QUEUE_FULL
+	,RTC_CLOCK_HALTED
+	,RTC_INVALID_TIME
 
 
 }Error_State_t;
@@ -31,6 +31,19 @@
 /* ------------------------------------------------------------------------------------------------ */
 #define ALIAS_ADDRESS(BIT_BAND_ADDRESS, BIT_NO) (ALIAS_BASE_ADDRESS + (BIT_NO * 4UL) + (32UL * ((uint32_t)BIT_BAND_ADDRESS - BIT_BAND_BASE_ADDRESS)))
 
+/* ------------------------------------------------------------------------------------------- */
+/* ------------------------------- CRITICAL SECTION MACROS ----------------------------------- */
+/* ------------------------------------------------------------------------------------------- */
+/* Save PRIMASK in a uint32_t Variable & Disable Interrupts , Restoring it Allows Nesting */
+#define ENTER_CRITICAL_SECTION(PRIMASK_COPY) __asm volatile("MRS %0, PRIMASK\n\tCPSID I" : "=r"(PRIMASK_COPY) : : "memory")
+#define EXIT_CRITICAL_SECTION(PRIMASK_COPY) __asm volatile("MSR PRIMASK, %0" : : "r"(PRIMASK_COPY) : "memory")
+
+/* ------------------------------------------------------------------------------------------- */
+/* ------------------------------- SYSTEM CLOCK MACROS --------------------------------------- */
+/* ------------------------------------------------------------------------------------------- */
+/* HCLK in MHz : The Reset HSI Clock , AHB , APB1 & APB2 Prescalers Left at 1 So PCLK1 & PCLK2 Equal HCLK */
+#define SYSTEM_HCLK_MHZ 16u
+
 /* ------------------------------------------------------------------------------------------------------- */
 /* ------------------------------- VARIOUS MEMORIES BASE ADDRESSES SECTION ------------------------------- */
 /* ------------------------------------------------------------------------------------------------------- */
@@ -96,6 +109,8 @@
 #define SYSTICK_BASE_ADDRESS 0xE000E010UL
 #define NVIC_BASE_ADDRESS 0xE000E100UL
 #define SCB_BASE_ADDRESS 0xE000E008UL
+#define DWT_BASE_ADDRESS 0xE0001000UL
+#define DEMCR_ADDRESS 0xE000EDFCUL
 
 /* -------------------------------------------------------------------------------------------------- */
 /* ------------------------------- RCC REGISTERS Definition Structure ------------------------------- */
@@ -241,6 +256,29 @@ typedef struct
 #define CSR_TICKINT 1
 #define CSR_ENABLE 0
 
+/* -------------------------------------------------------------------------------------------------- */
+/* ------------------------------- DWT REGISTERS Definition Structure ------------------------------- */
+/* -------------------------------------------------------------------------------------------------- */
+typedef struct
+{
+	volatile uint32_t CTRL;	  /*<! DWT Control Register                 >!*/
+	volatile uint32_t CYCCNT; /*<! DWT Cycle Count Register (Counts HCLK Cycles) >!*/
+} DWT_RegDef_t;
+
+/* ----------------------------------------------------------------------------------------- */
+/* ------------------------------- DWT Peripheral Definition ------------------------------- */
+/* ----------------------------------------------------------------------------------------- */
+#define DWT ((DWT_RegDef_t *)DWT_BASE_ADDRESS)
+
+/* Debug Exception & Monitor Control Register , TRCENA Must be Set Before Using DWT */
+#define DEMCR (*((volatile uint32_t *)DEMCR_ADDRESS))
+
+/* ---------------------------------------------------------------------------------- */
+/* ------------------------------- DWT REGISTERS Bits ------------------------------- */
+/* ---------------------------------------------------------------------------------- */
+#define DWT_CTRL_CYCCNTENA 0
+#define DEMCR_TRCENA 24
+
 /* -------------------------------------------------------------------------------------------------- */
 /* ------------------------------- NVIC REGISTERS Definition Structure ------------------------------ */
 /* -------------------------------------------------------------------------------------------------- */
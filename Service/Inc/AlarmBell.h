@@ -0,0 +1,43 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmBell.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Timer Driven Alarm Bell Pattern Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_ALARMBELL_H_
+#define INC_ALARMBELL_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Length of Each Pulse & Each Gap Between Pulses in ms , The Blue Pill Beeps While The Pin is High */
+#define ALARMBELL_STEP_MS 500u
+
+/* Most Pulses in One Pattern */
+#define ALARMBELL_MAX_BEEPS 8u
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmBell_Ring
+ * @brief			:	Start a Pattern of Pulses on The Bell Pin , a Pattern Already Playing is Restarted
+ * @param			:	Number of Pulses ( 1 - ALARMBELL_MAX_BEEPS ) , Larger Numbers Are Limited
+ * @retval			:	void
+ * @note			:	Returns at Once , The Pattern is Timed By The Bell Timer ( TIMERS_BELL_ID ) , Safe From Any Context
+ * ======================================================================================*/
+void AlarmBell_Ring(uint8_t Beeps);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmBell_Stop
+ * @brief			:	Stop The Pattern Playing & Release The Bell Pin
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void AlarmBell_Stop(void);
+
+#endif /* INC_ALARMBELL_H_ */
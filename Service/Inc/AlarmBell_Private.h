@@ -0,0 +1,32 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmBell_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Timer Driven Alarm Bell Pattern Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _ALARMBELL_PRIVATE_H_
+#define _ALARMBELL_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* PB6 is Read by The Blue Pill as The Alarm Signal */
+#define ALARMBELL_PORT PORTB
+#define ALARMBELL_PIN PIN6
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmBell_Step
+ * @brief			:	Bell Timer Call Back , Ends The Current Pulse or Gap & Times The Next Step Till The Last Pulse Ends
+ * @param			:	Timer Id , Not Used
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmBell_Step(uint16_t TimerId);
+
+#endif /* _ALARMBELL_PRIVATE_H_ */
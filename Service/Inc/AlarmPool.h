@@ -0,0 +1,122 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmPool.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Alarm Records Pool Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_ALARMPOOL_H_
+#define INC_ALARMPOOL_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Number of Alarm Records , Alarm Ids Are ( 0 - ALARMPOOL_MAX_ALARMS - 1 ) ,
+ * The Alarm Frame Carries The Alarm Number ( 1 - ALARMPOOL_MAX_ALARMS ) in Two Bytes */
+#define ALARMPOOL_MAX_ALARMS 300u
+
+/* Id of No Alarm */
+#define ALARMPOOL_NO_ALARM 0xFFFFu
+
+/* Bytes of The Alarm Time ( Hours , Minutes , Seconds ) */
+#define ALARMPOOL_TIME_SIZE 3u
+
+/* Longest Alarm Name , Names Are Kept in The String Arena */
+#define ALARMPOOL_NAME_MAX 27u
+
+/* Alarm Flags , a One Shot Alarm is Disabled Once it Fires */
+#define ALARMPOOL_FLAG_ENABLED (1u << 0)
+#define ALARMPOOL_FLAG_ONCE (1u << 1)
+
+/* Alarm States , an Alarm Rings From Its Deadline Till it is Acknowledged , The Queue Deadline is Then The Next Ring or
+ * The Snooze End , an Acknowledged Alarm Goes Back to Idle With its Next Deadline When That Deadline Comes */
+#define ALARMPOOL_STATE_IDLE 0u
+#define ALARMPOOL_STATE_ACTIVE 1u
+#define ALARMPOOL_STATE_SNOOZED 2u
+#define ALARMPOOL_STATE_ACKNOWLEDGED 3u
+
+/* ========================================================================= *
+ *                          TYPES SECTION                                    *
+ * ========================================================================= */
+
+typedef struct
+{
+	/* Days The Alarm Fires on , Every Day After Allocation */
+	Recurrence_Rule_t Rule;
+
+	uint8_t Time[ALARMPOOL_TIME_SIZE];
+
+	/* ( ALARMPOOL_FLAG_x ) , The Alarm is Scheduled Only When Enabled */
+	uint8_t Flags;
+
+	/* ( ALARMPOOL_STATE_x ) */
+	uint8_t State;
+
+	/* Rings Since The Alarm Fired Without Being Acknowledged */
+	uint8_t Rings;
+
+	/* String Arena Handle or ( STRINGARENA_NO_STRING ) */
+	uint16_t Name;
+
+} AlarmPool_Record_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_Init
+ * @brief			:	Free All Alarm Records & Their Names
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Ids Are Then Allocated in Increasing Order Starting From 0
+ * ======================================================================================*/
+void AlarmPool_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_Alloc
+ * @brief			:	Take a Free Alarm Record , Disabled , Idle & Unnamed With an Empty Time & a Daily Rule
+ * @param			:	Returns Alarm Id
+ * @retval			:	Error State ( NOK If All Records Are Used )
+ * @note			:	O( 1 ) , The Last Freed Id is Taken First
+ * ======================================================================================*/
+Error_State_t AlarmPool_Alloc(uint16_t *AlarmId);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_Free
+ * @brief			:	Return an Alarm Record to The Pool & Release its Name
+ * @param			:	Alarm Id
+ * @retval			:	Error State ( NOK If The Id is Not Allocated )
+ * @note			:	O( 1 ) , The Alarm Must be Removed From The Scheduler Before
+ * ======================================================================================*/
+Error_State_t AlarmPool_Free(uint16_t AlarmId);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_Get
+ * @brief			:	Get an Allocated Alarm Record
+ * @param			:	Alarm Id
+ * @retval			:	Pointer to The Record , NULL If The Id is Not Allocated
+ * ======================================================================================*/
+AlarmPool_Record_t *AlarmPool_Get(uint16_t AlarmId);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_SetName
+ * @brief			:	Replace The Name of an Alarm
+ * @param			:	Alarm Id
+ * @param			:	Name Bytes ( Not Terminated )
+ * @param			:	Length of The Name ( 0 - ALARMPOOL_NAME_MAX ) , 0 Removes The Name
+ * @retval			:	Error State ( NOK If The Id is Not Allocated or The String Arena is Full , The Old Name is Kept )
+ * ======================================================================================*/
+Error_State_t AlarmPool_SetName(uint16_t AlarmId, const uint8_t *Name, uint8_t Length);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_Count
+ * @brief			:	Number of Allocated Alarm Records
+ * @param			:	void
+ * @retval			:	Count
+ * ======================================================================================*/
+uint16_t AlarmPool_Count(void);
+
+#endif /* INC_ALARMPOOL_H_ */
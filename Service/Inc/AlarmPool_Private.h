@@ -0,0 +1,25 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmPool_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Alarm Records Pool Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _ALARMPOOL_PRIVATE_H_
+#define _ALARMPOOL_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* Free List Link of an Allocated Record */
+#define ALARMPOOL_ALLOCATED 0xFFFEu
+
+/* Free List Link of The Last Free Record */
+#define ALARMPOOL_LIST_END ALARMPOOL_NO_ALARM
+
+/* Value of Each Byte of an Empty Alarm Time */
+#define ALARMPOOL_EMPTY_TIME 0xFFu
+
+#endif /* _ALARMPOOL_PRIVATE_H_ */
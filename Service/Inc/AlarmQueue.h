@@ -0,0 +1,124 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmQueue.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Deadlines Min Heap Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_ALARMQUEUE_H_
+#define INC_ALARMQUEUE_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Number of Alarm Ids of The Alarm Engine Queue , Add & Remove Take log2 of This Steps at Most */
+#define ALARMQUEUE_MAX_ALARMS 300u
+
+/* Define an Empty Queue of Ids ( 0 - CAPACITY - 1 ) With its Own Storage */
+#define ALARMQUEUE_DEFINE(NAME, CAPACITY)               \
+	static AlarmQueue_Entry_t NAME##_Heap[(CAPACITY)];  \
+	static uint16_t NAME##_Position[(CAPACITY)];        \
+	static AlarmQueue_t NAME = {NAME##_Heap, NAME##_Position, (CAPACITY), 0}
+
+/* ========================================================================= *
+ *                          TYPES SECTION                                    *
+ * ========================================================================= */
+
+typedef struct
+{
+	uint32_t Deadline;
+	uint16_t AlarmId;
+
+} AlarmQueue_Entry_t;
+
+/* Binary Min Heap Ordered By Deadline , The Nearest Entry is at Index 0 . Deadlines Are Compared By Their Difference
+ * So a Queue May Hold Any Time Unit That Wraps , as Long as All Its Deadlines Are Within 2^31 Units of Each Other */
+typedef struct
+{
+	AlarmQueue_Entry_t *Heap;
+
+	/* Heap Index + 1 of Each Id So Remove & Move Do Not Search , 0 While Not Queued */
+	uint16_t *Position;
+
+	uint16_t Capacity;
+	uint16_t Size;
+
+} AlarmQueue_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Clear
+ * @brief			:	Remove All Entries From The Queue
+ * @param			:	Queue
+ * @retval			:	void
+ * ======================================================================================*/
+void AlarmQueue_Clear(AlarmQueue_t *Queue);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Add
+ * @brief			:	Queue an Alarm or Move an Already Queued One to a New Deadline
+ * @param			:	Queue
+ * @param			:	Alarm Id ( 0 - Capacity - 1 )
+ * @param			:	Deadline in The Queue Time Unit
+ * @retval			:	Error State ( NOK If The Id is Out of Range )
+ * @note			:	O( log n ) , Not Reentrant , Callers in Main & Interrupt Context Must Lock
+ * ======================================================================================*/
+Error_State_t AlarmQueue_Add(AlarmQueue_t *Queue, uint16_t AlarmId, uint32_t Deadline);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Remove
+ * @brief			:	Remove an Alarm From The Queue
+ * @param			:	Queue
+ * @param			:	Alarm Id
+ * @retval			:	Error State ( NOK If The Alarm is Not Queued )
+ * @note			:	O( log n )
+ * ======================================================================================*/
+Error_State_t AlarmQueue_Remove(AlarmQueue_t *Queue, uint16_t AlarmId);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Peek
+ * @brief			:	Get The Alarm With The Nearest Deadline Without Removing it
+ * @param			:	Queue
+ * @param			:	Returns Alarm Id
+ * @param			:	Returns Deadline in The Queue Time Unit
+ * @retval			:	Error State ( NOK If The Queue is Empty )
+ * @note			:	O( 1 )
+ * ======================================================================================*/
+Error_State_t AlarmQueue_Peek(const AlarmQueue_t *Queue, uint16_t *AlarmId, uint32_t *Deadline);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Get
+ * @brief			:	Get The Deadline of a Queued Id
+ * @param			:	Queue
+ * @param			:	Alarm Id
+ * @param			:	Returns Deadline in The Queue Time Unit
+ * @retval			:	Error State ( NOK If The Id is Not Queued )
+ * @note			:	O( 1 )
+ * ======================================================================================*/
+Error_State_t AlarmQueue_Get(const AlarmQueue_t *Queue, uint16_t AlarmId, uint32_t *Deadline);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Pop
+ * @brief			:	Remove & Return The Alarm With The Nearest Deadline
+ * @param			:	Queue
+ * @param			:	Returns Alarm Id
+ * @param			:	Returns Deadline in The Queue Time Unit
+ * @retval			:	Error State ( NOK If The Queue is Empty )
+ * @note			:	O( log n )
+ * ======================================================================================*/
+Error_State_t AlarmQueue_Pop(AlarmQueue_t *Queue, uint16_t *AlarmId, uint32_t *Deadline);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Count
+ * @brief			:	Number of Queued Entries
+ * @param			:	Queue
+ * @retval			:	Count
+ * ======================================================================================*/
+uint16_t AlarmQueue_Count(const AlarmQueue_t *Queue);
+
+#endif /* INC_ALARMQUEUE_H_ */
@@ -0,0 +1,56 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmQueue_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Deadlines Min Heap Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _ALARMQUEUE_PRIVATE_H_
+#define _ALARMQUEUE_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* Heap Links of Node Index */
+#define ALARMQUEUE_PARENT(INDEX) (((INDEX) - 1u) / 2u)
+#define ALARMQUEUE_LEFT(INDEX) ((2u * (INDEX)) + 1u)
+
+/* Position Table Holds Heap Index + 1 , 0 Means Not Queued , a Defined Queue Starts Zeroed */
+#define ALARMQUEUE_NOT_QUEUED 0u
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_IsBefore
+ * @brief			:	Order of Two Entries , Equal Deadlines Are Ordered By Id
+ * @param			:	Queue
+ * @param			:	Heap Index of First Entry
+ * @param			:	Heap Index of Second Entry
+ * @retval			:	1 If The First is Due Before The Second , 0 If Not
+ * ======================================================================================*/
+static uint8_t AlarmQueue_IsBefore(const AlarmQueue_t *Queue, uint16_t First, uint16_t Second);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Swap
+ * @brief			:	Swap Two Heap Entries & Update Their Positions
+ * @param			:	Queue
+ * @param			:	Heap Index of First Entry
+ * @param			:	Heap Index of Second Entry
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmQueue_Swap(AlarmQueue_t *Queue, uint16_t First, uint16_t Second);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Restore
+ * @brief			:	Move an Entry Up or Down Till The Heap Order Holds Again
+ * @param			:	Queue
+ * @param			:	Heap Index of The Changed Entry
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmQueue_Restore(AlarmQueue_t *Queue, uint16_t Index);
+
+#endif /* _ALARMQUEUE_PRIVATE_H_ */
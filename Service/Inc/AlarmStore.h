@@ -0,0 +1,72 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmStore.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Alarms Storage in The RTC Battery Backed RAM Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_ALARMSTORE_H_
+#define INC_ALARMSTORE_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Number of Stored Alarms & Bytes of Each Alarm Time ( Hours , Minutes , Seconds ) */
+#define ALARMSTORE_MAX_ALARMS 5u
+#define ALARMSTORE_TIME_SIZE 3u
+
+/* Value of Each Byte of an Empty Alarm */
+#define ALARMSTORE_EMPTY 0xFFu
+
+/* ========================================================================= *
+ *                          TYPES SECTION                                    *
+ * ========================================================================= */
+
+/* What is Kept of an Alarm Over Resets , The Other Rule Masks Are Always All Set */
+typedef struct
+{
+	/* Hours , Minutes , Seconds or ( ALARMSTORE_EMPTY ) Bytes For No Alarm */
+	uint8_t Time[ALARMSTORE_TIME_SIZE];
+
+	/* Recurrence Rule Days of Week Mask */
+	uint8_t Weekdays;
+
+	/* Recurrence Rule Interval ( 0 - RECURRENCE_MAX_INTERVAL ) */
+	uint16_t IntervalMinutes;
+
+	/* Alarm Flags */
+	uint8_t Flags;
+
+} AlarmStore_Record_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_Restore
+ * @brief			:	Read All Alarm Records in One Burst & Fill The Alarms Array With The Valid Ones
+ * @param			:	I2C Configurations of The RTC
+ * @param			:	Alarms Array to Fill ( ALARMSTORE_MAX_ALARMS ) , Corrupted or Empty Records Are Filled With
+ * 						( ALARMSTORE_EMPTY ) Bytes
+ * @param			:	Returns Number of Restored Alarms
+ * @retval			:	Error State
+ * @note			:	NVRAM Read But Not Holding a Valid Store ( First Boot or Lost Battery ) is Formatted With Empty Alarms ,
+ * 						On an RTC Without NVRAM ( DS3231 ) NOK is Returned & All Alarms Are Empty
+ * ======================================================================================*/
+Error_State_t AlarmStore_Restore(I2C_Configs_t *I2CConfig, AlarmStore_Record_t *Alarms, uint8_t *RestoredCount);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_Save
+ * @brief			:	Write One Alarm Record to NVRAM , Only If it Differs From The Stored One
+ * @param			:	Alarm Index ( 0 - ALARMSTORE_MAX_ALARMS - 1 )
+ * @param			:	Alarm to Store , a Time of ( ALARMSTORE_EMPTY ) Bytes Clears it
+ * @retval			:	Error State
+ * @note			:	( AlarmStore_Restore ) Must be Called Before , If its Reading Failed The NVRAM is Read Again First
+ * 						& Nothing is Written Till a Reading Succeeds
+ * ======================================================================================*/
+Error_State_t AlarmStore_Save(uint8_t AlarmIndex, const AlarmStore_Record_t *Alarm);
+
+#endif /* INC_ALARMSTORE_H_ */
@@ -0,0 +1,102 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmStore_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Alarms Storage Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _ALARMSTORE_PRIVATE_H_
+#define _ALARMSTORE_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* NVRAM Layout :
+ *   [ 0 ] Magic , [ 1 ] Version , Then One Record Per Alarm
+ *   Record : Hours , Minutes , Seconds , Weekdays , Interval Low , Interval High , Flags ,
+ *            CRC-8 of ( Index , All Previous Record Bytes )
+ */
+#define ALARMSTORE_MAGIC 0xA5u
+#define ALARMSTORE_VERSION 0x02u
+
+#define ALARMSTORE_MAGIC_OFFSET 0u
+#define ALARMSTORE_VERSION_OFFSET 1u
+#define ALARMSTORE_HEADER_SIZE 2u
+
+#define ALARMSTORE_WEEKDAYS_INDEX 3u
+#define ALARMSTORE_INTERVAL_INDEX 4u
+#define ALARMSTORE_FLAGS_INDEX 6u
+#define ALARMSTORE_CRC_INDEX 7u
+#define ALARMSTORE_RECORD_SIZE 8u
+
+#define ALARMSTORE_RECORD_OFFSET(INDEX) (ALARMSTORE_HEADER_SIZE + ((INDEX) * ALARMSTORE_RECORD_SIZE))
+
+#define ALARMSTORE_IMAGE_SIZE ALARMSTORE_RECORD_OFFSET(ALARMSTORE_MAX_ALARMS)
+
+#if ALARMSTORE_IMAGE_SIZE > DS1307_NVRAM_SIZE
+#error "All Alarm Records Must Fit The RTC NVRAM"
+#endif
+
+/* CRC-8 Polynomial ( x^8 + x^2 + x + 1 ) */
+#define ALARMSTORE_CRC_POLY 0x07u
+
+#define ALARMSTORE_MAX_HOURS 23u
+#define ALARMSTORE_MAX_MINUTES 59u
+#define ALARMSTORE_MAX_SECONDS 59u
+#define ALARMSTORE_MAX_WEEKDAYS RECURRENCE_ALL_WEEKDAYS
+#define ALARMSTORE_MAX_INTERVAL RECURRENCE_MAX_INTERVAL
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_ReadImage
+ * @brief			:	Read The Header & All Records in One Burst , Records Not Holding a Valid Alarm Are Replaced in The
+ * 						Copy With Empty Ones
+ * @param			:	void
+ * @retval			:	Error State of The Reading
+ * @note			:	The Copy is Used Only After a Successful Reading , a Failed One Leaves The NVRAM Content Unknown
+ * ======================================================================================*/
+static Error_State_t AlarmStore_ReadImage(void);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_CRC8
+ * @brief			:	CRC-8 of a Block of Bytes
+ * @param			:	Bytes
+ * @param			:	Number of Bytes
+ * @param			:	Initial CRC Value
+ * @retval			:	CRC
+ * ======================================================================================*/
+static uint8_t AlarmStore_CRC8(const uint8_t *Data, uint8_t Size, uint8_t CRC);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_EncodeRecord
+ * @brief			:	Build The NVRAM Record of an Alarm
+ * @param			:	Alarm Index
+ * @param			:	Alarm
+ * @param			:	Record to Fill ( ALARMSTORE_RECORD_SIZE ) Bytes
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmStore_EncodeRecord(uint8_t AlarmIndex, const AlarmStore_Record_t *Alarm, uint8_t *Record);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_DecodeRecord
+ * @brief			:	Get The Alarm Held in an NVRAM Record , The CRC is Not Checked
+ * @param			:	Record ( ALARMSTORE_RECORD_SIZE ) Bytes
+ * @param			:	Alarm to Fill
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmStore_DecodeRecord(const uint8_t *Record, AlarmStore_Record_t *Alarm);
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_IsValidAlarm
+ * @brief			:	Check That an Alarm Read From NVRAM Holds a Real Time of Day & a Rule That Can Match
+ * @param			:	Alarm
+ * @retval			:	1 If Valid , 0 If Not
+ * ======================================================================================*/
+static uint8_t AlarmStore_IsValidAlarm(const AlarmStore_Record_t *Alarm);
+
+#endif /* _ALARMSTORE_PRIVATE_H_ */
@@ -0,0 +1,88 @@
+/*
+ ******************************************************************************
+ * @file           : Calendar.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Epoch Seconds & Calendar Arithmetic Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_CALENDAR_H_
+#define INC_CALENDAR_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+#define CALENDAR_SECONDS_PER_MINUTE 60u
+#define CALENDAR_SECONDS_PER_HOUR 3600u
+#define CALENDAR_SECONDS_PER_DAY 86400u
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_ToEpoch
+ * @brief			:	Convert Date & Time to Seconds Since 01 / 01 / 1970 00:00:00 ( Unix Epoch )
+ * @param			:	Date & Time , Year is ( 2000 + Year ) , Day of Week is Not Used
+ * @retval			:	Epoch Seconds
+ * @note			:	Constant Time , No Loops Over Years or Months
+ * ======================================================================================*/
+uint32_t Calendar_ToEpoch(const DS1307_Config_t *Time);
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_FromEpoch
+ * @brief			:	Convert Seconds Since The Unix Epoch to Date & Time Including Day of Week
+ * @param			:	Epoch Seconds ( 2000 - 2099 )
+ * @param			:	Structure to Fill
+ * @retval			:	void
+ * ======================================================================================*/
+void Calendar_FromEpoch(uint32_t Epoch, DS1307_Config_t *Time);
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_DayOfWeek
+ * @brief			:	Day of Week of a Date
+ * @param			:	Date ( 1 - 31 )
+ * @param			:	Month ( 1 - 12 )
+ * @param			:	Year ( 0 - 99 )
+ * @retval			:	Day of Week ( DS1307_SUNDAY - DS1307_SATURDAY )
+ * ======================================================================================*/
+DS1307_DAYS_t Calendar_DayOfWeek(uint8_t Date, uint8_t Month, uint8_t Year);
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_DaysInMonth
+ * @brief			:	Number of Days in a Month , February Has 29 Days in Leap Years
+ * @param			:	Month ( 1 - 12 )
+ * @param			:	Year ( 0 - 99 )
+ * @retval			:	Days , 0 If The Month is Not Valid
+ * ======================================================================================*/
+uint8_t Calendar_DaysInMonth(uint8_t Month, uint8_t Year);
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_AddSeconds
+ * @brief			:	Move Date & Time Forward or Backward
+ * @param			:	Date & Time to Change , Day of Week is Updated
+ * @param			:	Seconds to Add ( Negative to Subtract )
+ * @retval			:	void
+ * ======================================================================================*/
+void Calendar_AddSeconds(DS1307_Config_t *Time, int32_t Seconds);
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_Diff
+ * @brief			:	Seconds From One Date & Time to Another
+ * @param			:	Later Date & Time
+ * @param			:	Earlier Date & Time
+ * @retval			:	( Later - Earlier ) in Seconds , Negative If Later is Before Earlier
+ * ======================================================================================*/
+int32_t Calendar_Diff(const DS1307_Config_t *Later, const DS1307_Config_t *Earlier);
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_Compare
+ * @brief			:	Order of Two Dates & Times
+ * @param			:	First Date & Time
+ * @param			:	Second Date & Time
+ * @retval			:	-1 If First is Before , 0 If Equal , 1 If First is After
+ * ======================================================================================*/
+int8_t Calendar_Compare(const DS1307_Config_t *First, const DS1307_Config_t *Second);
+
+#endif /* INC_CALENDAR_H_ */
@@ -0,0 +1,50 @@
+/*
+ ******************************************************************************
+ * @file           : Calendar_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Epoch Seconds & Calendar Arithmetic Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _CALENDAR_PRIVATE_H_
+#define _CALENDAR_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* RTC Year 0 is 2000 */
+#define CALENDAR_BASE_YEAR 2000u
+
+/* Days From 01 / 03 / 0000 to 01 / 01 / 1970 in The Proleptic Gregorian Calendar */
+#define CALENDAR_EPOCH_DAYS 719468u
+
+/* Days in a 400 Years Era & in a Year Starting From March */
+#define CALENDAR_DAYS_PER_ERA 146097u
+#define CALENDAR_YEARS_PER_ERA 400u
+
+#define CALENDAR_FEBRUARY 2u
+#define CALENDAR_MAX_MONTH 12u
+
+/* Gregorian Leap Year Rule */
+#define CALENDAR_IS_LEAP(YEAR) (((0u == ((YEAR) % 4u)) && (0u != ((YEAR) % 100u))) || (0u == ((YEAR) % 400u)))
+
+/* 01 / 01 / 1970 Was a Thursday ( 4 Days After Sunday ) */
+#define CALENDAR_EPOCH_WEEKDAY 4u
+#define CALENDAR_DAYS_PER_WEEK 7u
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_DaysFromCivil
+ * @brief			:	Days Since The Unix Epoch of a Date
+ * @param			:	Full Year ( 1970 and Later )
+ * @param			:	Month ( 1 - 12 )
+ * @param			:	Date ( 1 - 31 )
+ * @retval			:	Days
+ * ======================================================================================*/
+static uint32_t Calendar_DaysFromCivil(uint32_t Year, uint32_t Month, uint32_t Date);
+
+#endif /* _CALENDAR_PRIVATE_H_ */
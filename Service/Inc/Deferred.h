@@ -0,0 +1,46 @@
+/*
+ ******************************************************************************
+ * @file           : Deferred.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Work Deferred From Interrupts to PendSV Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_DEFERRED_H_
+#define INC_DEFERRED_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Number of Posted Works Waiting at Once , a Power of 2 */
+#define DEFERRED_QUEUE_SIZE 16u
+
+/* PendSV Priority , The Lowest So Every Interrupt Preempts The Deferred Work */
+#define DEFERRED_PRIORITY 15u
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Deferred_Init
+ * @brief			:	Empty The Work Queue & Set The PendSV Handler With The Lowest Priority
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called After The Priority Group is Set & Before Any Work is Posted
+ * ======================================================================================*/
+void Deferred_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	Deferred_Post
+ * @brief			:	Queue a Work to Run From PendSV After All Active Interrupts Return
+ * @param			:	Work Function
+ * @param			:	Argument Passed to The Work
+ * @retval			:	Error State ( NOK If The Queue is Full , The Work is Dropped )
+ * @note			:	Safe From Any Interrupt & From The Main Loop , Works Run in Posting Order ,
+ * 						a Work May Post Other Works
+ * ======================================================================================*/
+Error_State_t Deferred_Post(void (*Work)(uint32_t Arg), uint32_t Arg);
+
+#endif /* INC_DEFERRED_H_ */
@@ -0,0 +1,42 @@
+/*
+ ******************************************************************************
+ * @file           : Deferred_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Work Deferred From Interrupts to PendSV Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _DEFERRED_PRIVATE_H_
+#define _DEFERRED_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* Index Wrap of The Work Queue */
+#define DEFERRED_INDEX_MASK (DEFERRED_QUEUE_SIZE - 1u)
+
+/* ========================================================================= *
+ *                         PRIVATE TYPES SECTION                             *
+ * ========================================================================= */
+
+typedef struct
+{
+	void (*Work)(uint32_t Arg);
+	uint32_t Arg;
+
+} Deferred_Item_t;
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Deferred_Run
+ * @brief			:	PendSV Call Back , Run Posted Works Till The Queue is Empty
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void Deferred_Run(void);
+
+#endif /* _DEFERRED_PRIVATE_H_ */
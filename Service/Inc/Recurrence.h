@@ -0,0 +1,73 @@
+/*
+ ******************************************************************************
+ * @file           : Recurrence.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Alarm Recurrence Rules Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_RECURRENCE_H_
+#define INC_RECURRENCE_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Rule Masks Bits of a Day of Week ( DS1307_SUNDAY - DS1307_SATURDAY ) , a Date ( 1 - 31 ) & a Month ( 1 - 12 ) */
+#define RECURRENCE_WEEKDAY(DAY) (1u << ((DAY) - DS1307_SUNDAY))
+#define RECURRENCE_MONTHDAY(DATE) (1ul << ((DATE) - 1u))
+#define RECURRENCE_MONTH(MONTH) (1u << ((MONTH) - 1u))
+
+#define RECURRENCE_ALL_WEEKDAYS 0x7Fu
+#define RECURRENCE_ALL_MONTHDAYS 0x7FFFFFFFul
+#define RECURRENCE_ALL_MONTHS 0x0FFFu
+
+/* Longest Interval , Once a Day */
+#define RECURRENCE_MAX_INTERVAL 1440u
+
+/* ========================================================================= *
+ *                          TYPES SECTION                                    *
+ * ========================================================================= */
+
+/* A Day Matches If its Day of Week , Date & Month Bits Are All Set ,
+ * e.g. Week Days Only : Weekdays = Monday - Friday Bits , Other Masks All Set
+ *      Every 25 / 12  : MonthDays = RECURRENCE_MONTHDAY(25) , Months = RECURRENCE_MONTH(12) , Weekdays All Set */
+typedef struct
+{
+	uint32_t MonthDays;
+
+	uint16_t Months;
+
+	/* 0 : Once at The Alarm Time , N : Every N Minutes From The Alarm Time Till Midnight */
+	uint16_t IntervalMinutes;
+
+	uint8_t Weekdays;
+
+} Recurrence_Rule_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Recurrence_SetDaily
+ * @brief			:	Set a Rule Matching Every Day Once
+ * @param			:	Rule to Set
+ * @retval			:	void
+ * ======================================================================================*/
+void Recurrence_SetDaily(Recurrence_Rule_t *Rule);
+
+/*=======================================================================================
+ * @fn		 		:	Recurrence_Next
+ * @brief			:	First Occurrence of a Rule After a Time
+ * @param			:	Rule
+ * @param			:	Alarm Time as Second of The Day
+ * @param			:	Time to Search After in Epoch Seconds , an Occurrence at This Second is Not Returned
+ * @param			:	Returns The Occurrence in Epoch Seconds
+ * @retval			:	Error State ( NOK If The Rule Never Matches Before The End of 2099 )
+ * @note			:	The Matching Days of a Whole Month Are Found at Once With Bit Masks , So The Cost
+ * 						Depends on The Months Skipped , Not on The Days or The Rule
+ * ======================================================================================*/
+Error_State_t Recurrence_Next(const Recurrence_Rule_t *Rule, uint32_t SecondOfDay, uint32_t After, uint32_t *Next);
+
+#endif /* INC_RECURRENCE_H_ */
@@ -0,0 +1,43 @@
+/*
+ ******************************************************************************
+ * @file           : Recurrence_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Alarm Recurrence Rules Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _RECURRENCE_PRIVATE_H_
+#define _RECURRENCE_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+#define RECURRENCE_DAYS_PER_WEEK 7u
+#define RECURRENCE_MAX_MONTH 12u
+
+/* The RTC Holds Years 00 - 99 */
+#define RECURRENCE_MAX_YEAR 99u
+
+/* Repeats a 7 Bits Week Mask at Bits 0 , 7 , 14 , 21 & 28 , The Copies Never Overlap So There is No Carry */
+#define RECURRENCE_WEEK_REPEAT 0x10204081ul
+
+/* Mask of Dates ( 1 - DAYS ) & of Dates Before DATE */
+#define RECURRENCE_DAYS_MASK(DAYS) ((uint32_t)(((uint64_t)1u << (DAYS)) - 1u))
+#define RECURRENCE_BEFORE_MASK(DATE) ((uint32_t)((1ul << ((DATE) - 1u)) - 1u))
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Recurrence_MonthMatches
+ * @brief			:	Dates of a Month Matching a Rule
+ * @param			:	Rule
+ * @param			:	Month ( 1 - 12 )
+ * @param			:	Year ( 0 - 99 )
+ * @retval			:	Mask of Matching Dates , Bit ( Date - 1 )
+ * ======================================================================================*/
+static uint32_t Recurrence_MonthMatches(const Recurrence_Rule_t *Rule, uint8_t Month, uint8_t Year);
+
+#endif /* _RECURRENCE_PRIVATE_H_ */
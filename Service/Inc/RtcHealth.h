@@ -0,0 +1,53 @@
+/*
+ ******************************************************************************
+ * @file           : RtcHealth.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : RTC Oscillator & Registers Health Monitoring Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_RTCHEALTH_H_
+#define INC_RTCHEALTH_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Health Status Flags , Same as The RTC Driver Flags */
+#define RTCHEALTH_OK RTC_HEALTH_OK
+#define RTCHEALTH_HALTED RTC_HEALTH_HALTED   /* Oscillator Was Stopped ( Usually a Dead Backup Battery ) */
+#define RTCHEALTH_INVALID RTC_HEALTH_INVALID /* Registers Did Not Hold a Valid Date & Time */
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	RtcHealth_Check
+ * @brief			:	Read The RTC Registers , Restart a Halted Oscillator & Replace Invalid Registers
+ * @param			:	I2C Configurations of The RTC
+ * @param			:	Time to Write If The RTC Time is Lost , NULL to Restart From The Halted Registers
+ * 						or From ( 01 / 01 / 2000 00:00:00 ) If They Are Invalid
+ * @param			:	Returns Health Status Flags
+ * @retval			:	Error State
+ * @note			:	Blocking , Call at Boot Before ( SoftClock_Init ) & Periodically From The Main Loop
+ * ======================================================================================*/
+Error_State_t RtcHealth_Check(I2C_Configs_t *I2CConfig, const DS1307_Config_t *Fallback, uint8_t *Status);
+
+/*=======================================================================================
+ * @fn		 		:	RtcHealth_IsTimeStale
+ * @brief			:	Check If The RTC Time Was Lost & Not Set Since
+ * @param			:	void
+ * @retval			:	1 If Stale , 0 If Not
+ * ======================================================================================*/
+uint8_t RtcHealth_IsTimeStale(void);
+
+/*=======================================================================================
+ * @fn		 		:	RtcHealth_ClearStale
+ * @brief			:	Mark The RTC Time as Correct , Called When The Time is Set
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void RtcHealth_ClearStale(void);
+
+#endif /* INC_RTCHEALTH_H_ */
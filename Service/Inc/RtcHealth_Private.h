@@ -0,0 +1,22 @@
+/*
+ ******************************************************************************
+ * @file           : RtcHealth_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : RTC Health Monitoring Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _RTCHEALTH_PRIVATE_H_
+#define _RTCHEALTH_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* Time Written When The RTC Registers Are Invalid & No Fallback is Given : Saturday 01 / 01 / 2000 */
+#define RTCHEALTH_DEFAULT_DAY DS1307_SATURDAY
+#define RTCHEALTH_DEFAULT_DATE 1u
+#define RTCHEALTH_DEFAULT_MONTH 1u
+#define RTCHEALTH_DEFAULT_YEAR 0u
+
+#endif /* _RTCHEALTH_PRIVATE_H_ */
@@ -0,0 +1,111 @@
+/*
+ ******************************************************************************
+ * @file           : Scheduler.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Run to Completion Event Scheduler Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_SCHEDULER_H_
+#define INC_SCHEDULER_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Events , Each Has One Task & One Queue , a Lower Number Runs First */
+#define SCHEDULER_EVENT_ALARM_DUE 0u	/* Alarm Deadline Reached , Argument is The Epoch Second */
+#define SCHEDULER_EVENT_BUTTON 1u		/* User Button Pressed */
+#define SCHEDULER_EVENT_SECOND 2u		/* Clock Second Tick */
+#define SCHEDULER_EVENT_SPI_DONE 3u		/* SPI Frame Sent , Argument is The Frame Kind */
+#define SCHEDULER_EVENT_UART_RX 4u		/* Console Input Ready */
+#define SCHEDULER_EVENT_I2C_RECOVERY 5u	/* I2C Transfer Aborted , The Bus Needs Recovery */
+
+/* Number of Events */
+#define SCHEDULER_EVENTS 6u
+
+/* Events Waiting in Each Queue at Once , a Power of 2 */
+#define SCHEDULER_QUEUE_SIZE 8u
+
+/* ========================================================================= *
+ *                          TYPES SECTION                                    *
+ * ========================================================================= */
+
+typedef struct
+{
+	/* Finished Runs of The Task */
+	uint32_t Runs;
+
+	/* Posts Lost on a Full Queue */
+	uint32_t Dropped;
+
+	/* Run Time in us Not Counting Other Tasks Run or Sleep While The Task Yields , The Total Wraps */
+	uint32_t LastTime;
+	uint32_t MaxTime;
+	uint32_t TotalTime;
+
+	/* Events Waiting in The Queue Now & The Most Ever Waiting */
+	uint8_t Depth;
+	uint8_t MaxDepth;
+
+} Scheduler_Stats_t;
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Init
+ * @brief			:	Remove All Tasks , Empty The Queues & Clear The Statistics
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called Before Any Interrupt That Posts Events is Enabled
+ * ======================================================================================*/
+void Scheduler_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_SetTask
+ * @brief			:	Set The Task Run For Each Event Posted
+ * @param			:	Event ( 0 - SCHEDULER_EVENTS - 1 )
+ * @param			:	Task , Called From Thread Mode With The Posted Argument , NULL Stops Accepting The Event
+ * @retval			:	Error State ( NOK If The Event is Out of Range )
+ * ======================================================================================*/
+Error_State_t Scheduler_SetTask(uint8_t Event, void (*Task)(uint32_t Arg));
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Post
+ * @brief			:	Queue an Event For its Task
+ * @param			:	Event
+ * @param			:	Argument Passed to The Task
+ * @retval			:	Error State ( NOK If The Event Has No Task or its Queue is Full , The Event is Dropped )
+ * @note			:	Safe From Any Interrupt & From Tasks , Events of One Kind Run in Posting Order
+ * ======================================================================================*/
+Error_State_t Scheduler_Post(uint8_t Event, uint32_t Arg);
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Yield
+ * @brief			:	Run The Highest Priority Waiting Event , or Sleep Till The Next Interrupt If None is Waiting
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Tasks Waiting For Input Call it in Their Wait Loop , a Task is Never Run Again While it Yields
+ * ======================================================================================*/
+void Scheduler_Yield(void);
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Run
+ * @brief			:	Run The Posted Events Forever
+ * @param			:	void
+ * @retval			:	Never Returns
+ * ======================================================================================*/
+void Scheduler_Run(void);
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_GetStats
+ * @brief			:	Read The Statistics of an Event & its Task
+ * @param			:	Event
+ * @param			:	Returns Statistics
+ * @retval			:	Error State ( NOK If The Event is Out of Range )
+ * ======================================================================================*/
+Error_State_t Scheduler_GetStats(uint8_t Event, Scheduler_Stats_t *Stats);
+
+#endif /* INC_SCHEDULER_H_ */
@@ -0,0 +1,63 @@
+/*
+ ******************************************************************************
+ * @file           : Scheduler_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Run to Completion Event Scheduler Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _SCHEDULER_PRIVATE_H_
+#define _SCHEDULER_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* Index Wrap of The Event Queues */
+#define SCHEDULER_INDEX_MASK (SCHEDULER_QUEUE_SIZE - 1u)
+
+/* Returned When No Event Can Run */
+#define SCHEDULER_NO_EVENT SCHEDULER_EVENTS
+
+/* Sleep Till an Interrupt is Pending , Wakes Even With Interrupts Masked So The Check Before it Cannot Miss One */
+#define SCHEDULER_WAIT_FOR_INTERRUPT() __asm volatile("WFI" : : : "memory")
+
+/* ========================================================================= *
+ *                         PRIVATE TYPES SECTION                             *
+ * ========================================================================= */
+
+typedef struct
+{
+	void (*Task)(uint32_t Arg);
+
+	uint32_t Args[SCHEDULER_QUEUE_SIZE];
+
+	/* Free Running Indexes , Their Difference is The Number of Waiting Events */
+	uint8_t Head;
+	uint8_t Tail;
+
+} Scheduler_Queue_t;
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Take
+ * @brief			:	Remove The Highest Priority Waiting Event Whose Task is Not Yielding
+ * @param			:	Returns The Event Argument
+ * @retval			:	Event , SCHEDULER_NO_EVENT If None Can Run
+ * @note			:	Called With Interrupts Masked
+ * ======================================================================================*/
+static uint8_t Scheduler_Take(uint32_t *Arg);
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Dispatch
+ * @brief			:	Run The Task of an Event & Update its Statistics
+ * @param			:	Event
+ * @param			:	Event Argument
+ * @retval			:	void
+ * ======================================================================================*/
+static void Scheduler_Dispatch(uint8_t Event, uint32_t Arg);
+
+#endif /* _SCHEDULER_PRIVATE_H_ */
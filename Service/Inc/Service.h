@@ -23,6 +23,11 @@ typedef enum
 	DISPLAY_OPTION = (0x01 + ZERO_ASCII),
 	SET_ALARM_OPTION = (0x02 + ZERO_ASCII),
 	SET_DATE_TIME_OPTION = (0x03 + ZERO_ASCII),
+	ACKNOWLEDGE_ALARMS_OPTION = (0x04 + ZERO_ASCII),
+	SNOOZE_ALARMS_OPTION = (0x05 + ZERO_ASCII),
+	TIMERS_OPTION = (0x06 + ZERO_ASCII),
+	STATS_OPTION = (0x07 + ZERO_ASCII),
+	DELETE_ALARM_OPTION = (0x08 + ZERO_ASCII),
 
 } OPTIONS_t;
 
@@ -117,15 +122,33 @@ void Clear_Terminal(void);
  *                    1- Display Date & Time
  * 				      2- Set Alarm
  * 				      3- Set Date & Time
+ * 				      4- Acknowledge Alarms
+ * 				      5- Snooze Alarms
+ * 				      6- Timers & Stopwatch
+ * 				      7- Scheduler Statistics
+ * 				      8- Delete Alarm
  *
  * @param[in]		: void
  *
- * @return 			: OPTIONS_t > Option Choosen by User ( 1-3 )
+ * @return 			: void
+ *
+ * @note			: The Option is Read By Read_Option Once the User Types it
+ * ============================================================================
+ */
+void Display_Menu(void);
+
+/** ============================================================================
+ * @fn 				: Read_Option
+ *
+ * @brief 			: This Function is Used to Receive the Option Choosen by User From the Menu
+ *
+ * @param[in]		: void
+ *
+ * @return 			: OPTIONS_t > Option Choosen by User ( 1-8 )
  *
- * @note			: This Function is Called Only Once When User Enters the System ( ID & Password are Correct )
  * ============================================================================
  */
-OPTIONS_t Display_Menu(void);
+OPTIONS_t Read_Option(void);
 
 /** ============================================================================
  * @fn 				: SendNew_Line
@@ -222,7 +245,7 @@ void ShutDown_Sequence(void);
 
 /*=======================================================================================
  * @fn		 		:	Reading_Time
- * @brief			:	Reading data from RTC and store data in Reading Array
+ * @brief			:	Reading data from the Soft Clock ( RTC Time Kept in RAM ) and store data in Reading Array
  * @param			:	void
  * @retval			:	void
  * ======================================================================================*/
@@ -238,25 +261,77 @@ void Transmit_Time(void);
 
 /*==============================================================================================================================================
  *@fn      : void SetAlarm()
- *@brief  :  This Function Is Responsible For Setting The Alarm Time
+ *@brief  :  This Function Is Responsible For Creating a New Alarm Or Changing an Existing One , Its Name & Its Time
  *@retval void :
  *==============================================================================================================================================*/
 void SetAlarm();
 
 /*==============================================================================================================================================
- *@fn      : void CalcAlarm(uint8_t AlarmNumber)
- *@brief  :  This Function Is Responsible For Calculating The Alarm Time And Storing It In The Global Array
- *@paramter[in]  : uint8_t AlarmNumber : The Number Of The Alarm To Be Set
+ *@fn      : void DeleteAlarm(void)
+ *@brief  :  This Function Is Responsible For Deleting an Alarm Chosen By The User , It Is Removed From The Alarm Queue & Its Record Is
+ *			 Returned To The Alarm Pool
  *@retval void :
  *==============================================================================================================================================*/
-void CalcAlarm(uint8_t AlarmNumber);
+void DeleteAlarm(void);
+
+/*==============================================================================================================================================
+ *@fn      : Error_State_t CalcAlarm(uint16_t AlarmId)
+ *@brief  :  This Function Is Responsible For Calculating The Alarm Time And Storing It In The Alarm Record
+ *@paramter[in]  : uint16_t AlarmId : Id Of The Allocated Alarm To Be Set
+ *@retval Error_State_t : NOK If The Typed Time Is Not Two Digit Fields Of a Real Time Of Day , The Record Is Then Not Changed
+ *==============================================================================================================================================*/
+Error_State_t CalcAlarm(uint16_t AlarmId);
+
+/*==============================================================================================================================================
+ *@fn      : uint8_t RestoreAlarms(void)
+ *@brief  :  This Function Is Responsible For Emptying The Alarm Pool & Loading The Alarms Saved in the RTC Battery Backed RAM Into It
+ *@retval uint8_t : Number Of Restored Alarms
+ *@note    : Restored Alarms Keep Their Numbers , Repeat Days , Interval & Flags & Are Unnamed , The Names Are Not Saved
+ *==============================================================================================================================================*/
+uint8_t RestoreAlarms(void);
 
 /*==============================================================================================================================================
- *@fn      :  void CompTime()
- *@brief  :   This Function Is Responsible For Comparing The Current Time With The Alarm Time And Send The Alarm Number To The Blue Pill If They Are Equal
+ *@fn      : void StartAlarms(void)
+ *@brief  :  This Function Is Responsible For Queueing All Alarms By Their Next Deadline & Arming One Timer At The Nearest , The RTC
+ *			 Hardware Alarm Fired From its INT Pin If The RTC Has One ( DS3231 ) , Otherwise The Soft Clock Deadline
  *@retval void :
+ *@note    : The Time Is Changed By SetClockTime , a Changed Alarm Is Moved By CalcAlarm , RTC_Init & SoftClock_Init Must be Called Before
+ *==============================================================================================================================================*/
+void StartAlarms(void);
+
+/*==============================================================================================================================================
+ *@fn      : Error_State_t SetClockTime(const DS1307_Config_t *Time)
+ *@brief  :  This Function Is Responsible For Setting The Time Of The RTC & The Soft Clock And Rescheduling The Alarms From It ,
+ *			 Moving The Time Forward Fires The Alarms Skipped Within ( ALARM_LATE_TOLERANCE ) , Moving It Backward Lets
+ *			 The Alarms Of The Repeated Period Fire Again
+ *@paramter[in]  : const DS1307_Config_t *Time : New Date & Time
+ *@retval Error_State_t : Error State Of Writing The RTC
+ *==============================================================================================================================================*/
+Error_State_t SetClockTime(const DS1307_Config_t *Time);
+
+/*==============================================================================================================================================
+ *@fn      : uint16_t AcknowledgeAlarms(void)
+ *@brief  :  This Function Is Responsible For Acknowledging Every Ringing Or Snoozed Alarm & Silencing The Bell , Each Alarm Is Queued
+ *			 At Its Next Deadline When Its Pending Ring Or Snooze End Comes
+ *@retval uint16_t : Number Of Acknowledged Alarms
+ *@note    : Also Called From The User Button ( PC13 ) Deferred Work
+ *==============================================================================================================================================*/
+uint16_t AcknowledgeAlarms(void);
+
+/*==============================================================================================================================================
+ *@fn      : uint16_t SnoozeAlarms(void)
+ *@brief  :  This Function Is Responsible For Snoozing Every Ringing Alarm For ( ALARM_SNOOZE_TIME ) Seconds & Silencing The Bell
+ *@retval uint16_t : Number Of Snoozed Alarms
  *==============================================================================================================================================*/
-void CompTime();
+uint16_t SnoozeAlarms(void);
+
+/*==============================================================================================================================================
+ *@fn      : void TimersMenu(void)
+ *@brief  :  This Function Is Responsible For Starting & Stopping The Countdowns & The Stopwatch And Showing Them From The Terminal
+ *@retval void :
+ *@note    : Readings Are Also Sent To The LCD , ( Timers_Init ) Must be Called Before
+ *==============================================================================================================================================*/
+void TimersMenu(void);
 
 /*==============================================================================================================================================
  *@fn      :  void SendGreenSignal()
@@ -265,6 +340,43 @@ void CompTime();
  *==============================================================================================================================================*/
 void SendGreenSignal( void );
 
+/*==============================================================================================================================================
+ *@fn      : void StartTasks(void)
+ *@brief  :  This Function Is Responsible For Setting The Alarm , Button , Second & SPI Tasks Of The Scheduler & Starting The Second Tick
+ *@retval void :
+ *@note    : Called After Scheduler_Init & Before StartAlarms , The Interrupts Post Their Events From Then
+ *==============================================================================================================================================*/
+void StartTasks(void);
+
+/*==============================================================================================================================================
+ *@fn      : void Console_Start(void (*Handler)(void))
+ *@brief  :  This Function Is Responsible For Running The Console Task On Each Console Input
+ *@paramter[in]  : void (*Handler)(void) : Called While Input Is Waiting , Handles One Command Reading It By Console_Receive
+ *@retval void :
+ *==============================================================================================================================================*/
+void Console_Start(void (*Handler)(void));
+
+/*==============================================================================================================================================
+ *@fn      : uint8_t Console_Receive(void)
+ *@brief  :  This Function Is Responsible For Receiving One Byte From The Console , Other Tasks Run While The User Types
+ *@retval uint8_t : Received Byte
+ *==============================================================================================================================================*/
+uint8_t Console_Receive(void);
+
+/*==============================================================================================================================================
+ *@fn      : uint8_t Console_Pending(void)
+ *@brief  :  This Function Is Responsible For Checking The Console Input
+ *@retval uint8_t : Number Of Received Bytes Not Read Yet
+ *==============================================================================================================================================*/
+uint8_t Console_Pending(void);
+
+/*==============================================================================================================================================
+ *@fn      : void ShowStatistics(void)
+ *@brief  :  This Function Is Responsible For Sending The Run Count , Run Times & Queue Depths Of Each Scheduler Task To The Terminal
+ *@retval void :
+ *==============================================================================================================================================*/
+void ShowStatistics(void);
+
 /* ========================================================================= *
  *                                 HANDLERS			                         *
  * ========================================================================= */
@@ -278,23 +390,9 @@ void SPI_CallBackFunc(void);
 
 /*==============================================================================================================================================
  *@fn      :  void SPI_CALL_BACK()
- *@brief   :  Empty SPI Call Back Function in Case of User Choose Display Date & Time Option
+ *@brief   :  SPI Call Back Function of Every Queued Frame ( Date & Time , Alarm , Timer , Green Led Signal ) , Posts the SPI Done Event
  *@retval  :  void
  *==============================================================================================================================================*/
 void SPI_CALL_BACK(void);
 
-/*==============================================================================================================================================
- *@fn      :  void SPI1_ISR()
- *@brief   :  This Function Is ISR For SPI In Case Of Alarm is Triggered to Send Inside the Call Back , Pulse to the Blue Pill Board
- *@retval  :  void
- *==============================================================================================================================================*/
-void SPI1_ISR();
-
-/*==============================================================================================================================================
- *@fn      : void SysTickPeriodicISR()
- *@brief  :  This Function Is The ISR For The SYSTICK Interrupt , It Is Responsible For Calling The CompTime Function Every One Second
- *@retval void :
- *==============================================================================================================================================*/
-void SysTickPeriodicISR();
-
 #endif /* INC_SERVICE_H_ */
@@ -16,39 +16,119 @@
 #define FIRST_TIME 1u
 #define NOT_FIRST_TIME 0u
 
-#define CALENDER_FORMAT 23u
+#define CALENDER_FORMAT 17u
 
 #define CLEAR_TERMINAL "\033\143"
 
-#define DELAY_1s()                      \
-    for (uint16_t n = 1000; n > 0; n--) \
-        for (uint16_t y = 0; y < 3195; y++)
-
-#define DELAY_500ms()                  \
-    for (uint16_t n = 500; n > 0; n--) \
-        for (uint16_t i = 0; i < 3195; i++)
+/* Time a Message Stays on The Terminal Before it is Cleared or Followed */
+#define MESSAGE_DELAY_MS 500u
 
 #define RED_LED_CODE 0x39
 #define DISPLAY_CODE 0x41
 #define GREEN_LED_CODE 0x44
 #define ALARMCODE 100
+#define TIMER_CODE 0x54
+
+/* Positions of The Fields in The Calender Received From User ( yy-mm-dd HH:MM:SS ) */
+#define CALENDER_YEAR_POS 0u
+#define CALENDER_MONTH_POS 3u
+#define CALENDER_DATE_POS 6u
+#define CALENDER_HOURS_POS 9u
+#define CALENDER_MINUTES_POS 12u
+#define CALENDER_SECONDS_POS 15u
+#define CALENDER_FIELDS_NUM 6u
 
-#define FIRST_LETTER_OF_DAY 10u
-#define SECOND_LETTER_OF_DAY 11u
-#define THIRD_LETTER_OF_DAY 12u
-#define WRONG_DAY 8u
+/* Alarm Time Received From User ( HH:MM:SS ) , Size & Positions of The Fields */
+#define ALARM_TIME_FORMAT 8u
+#define ALARM_HOURS_POS 0u
+#define ALARM_MINUTES_POS 3u
+#define ALARM_SECONDS_POS 6u
+#define ALARM_FIELDS_NUM 3u
 
-#define MAX_DATE 31u
 #define MAX_HOURS 23u
 #define MAX_MINUTES 59u
 #define MAX_SECONDS 59u
 #define MAX_MONTH 12u
 #define MAX_YEAR 99u
 
-#define Filling                                                                                              \
-    {                                                                                                        \
-        {0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF}, { 0xFF, 0xFF, 0xFF } \
-    }
+/* RTC INT/SQW is Connected to PB0 , Driven Low By a Hardware Alarm Match */
+#define RTC_INT_PORT GPIO_PORTB
+#define RTC_INT_LINE EXTI0
+
+#define ALARM_EMPTY 0xFFu
+
+/* Seconds an Alarm May Fire Late , Deadlines Passed by More ( Stuck Bus , Clock Set Forward ) Are Skipped */
+#define ALARM_LATE_TOLERANCE 60u
+
+/* A Fired Alarm Rings Every ALARM_RING_PERIOD Seconds Till Acknowledged , Snoozes By Itself After ALARM_RINGS_PER_SNOOZE Rings
+ * With One More Beep Each Time it Rings Again , & Gives Up After ALARM_MAX_RINGS Rings */
+#define ALARM_RING_PERIOD 10u
+#define ALARM_RINGS_PER_SNOOZE 6u
+#define ALARM_SNOOZE_TIME 300u
+#define ALARM_MAX_RINGS 24u
+
+/* Nucleo User Button on PC13 Acknowledges The Ringing Alarms , Low While Pressed */
+#define ALARM_BUTTON_PORT GPIO_PORTC
+#define ALARM_BUTTON_LINE EXTI13
+
+/* Longest Recurrence Answer Typed By The User */
+#define REPEAT_LINE_SIZE 7u
+
+/* Alarm Frame : Code , Alarm Number High Byte , Alarm Number Low Byte , Name Ended With Enter */
+#define ALARM_FRAME_SIZE 30u
+#define ALARM_FRAME_NUMBER_POS 1u
+#define ALARM_FRAME_NAME_POS 3u
+
+/* Timer Frame Sent To The Blue Pill LCD : Code , Timer Number ( 0 For The Stopwatch ) , Hours , Minutes , Seconds ,
+ * Milliseconds High Byte , Milliseconds Low Byte */
+#define TIMER_FRAME_SIZE 30u
+#define TIMER_FRAME_NUMBER_POS 1u
+#define TIMER_FRAME_HOURS_POS 2u
+#define TIMER_FRAME_MINUTES_POS 3u
+#define TIMER_FRAME_SECONDS_POS 4u
+#define TIMER_FRAME_MS_HIGH_POS 5u
+#define TIMER_FRAME_MS_LOW_POS 6u
+
+/* Longest Answer Typed For a Countdown ( Seconds.Milliseconds ) , Longest Number of Whole Seconds */
+#define DURATION_LINE_SIZE 11u
+#define DURATION_MAX_SECONDS (TIMERS_MAX_DURATION / 1000u)
+
+/* Bell Pulses When a Countdown Ends */
+#define COUNTDOWN_BEEPS 3u
+
+/* Console Input Kept Till Read , a Power of 2 */
+#define CONSOLE_BUFFER_SIZE 64u
+#define CONSOLE_INDEX_MASK (CONSOLE_BUFFER_SIZE - 1u)
+
+/* Alarm Due Argument of The RTC INT Pin : The Nearest Queued Deadline Matched , Past Any Epoch Second The Calendar Holds */
+#define ALARM_DUE_RTC_MATCH 0xFFFFFFFFu
+
+/* Clock Second Task : Tick Period , Seconds Between RTC Health Checks & Seconds The LCD Keeps an Alarm or Timer Frame
+ * Before The Time is Shown Again */
+#define SECOND_TICK_MS 1000u
+#define RTC_CHECK_PERIOD 60u
+#define DISPLAY_HOLD_TIME 10u
+
+/* SPI Frames , One is Sent at a Time & Waiting Frames Are Sent in This Order */
+#define SPI_FRAME_ALARM 0u
+#define SPI_FRAME_TIMER 1u
+#define SPI_FRAME_TIME 2u
+#define SPI_FRAME_SIGNAL 3u
+#define SPI_FRAMES 4u
+#define SPI_FRAME_NONE 0xFFu
+
+/* Date & Time Frame & Login Signal Frame Size */
+#define DISPLAY_FRAME_SIZE 30u
+
+/* Longest Frame Of Any Kind , Size Of The Queued & Sent Copies */
+#define SPI_FRAME_MAX_SIZE 30u
+
+/* Period of The I2C Timeout Check in ms */
+#define I2C_POLL_MS 1u
+
+/* Second of The Day of an Alarm ( Hours , Minutes , Seconds ) */
+#define ALARM_SECOND_OF_DAY(ALARM) (((uint32_t)(ALARM)[0] * 3600u) + ((uint32_t)(ALARM)[1] * 60u) + (uint32_t)(ALARM)[2])
+
 
 /* ========================================================================= *
  *                         PRIVATE ENUMS SECTION                             *
@@ -131,14 +211,6 @@ static ID_PASS_EQUALITY_t ID_Equal_InvertedPass(uint8_t *ID, uint8_t *Pass, uint
  */
 static uint8_t *InvertPass(uint8_t *Arr, uint8_t ArrSize);
 
-/*=======================================================================================
- * @fn		 		:	FindDay
- * @brief			:	Find The Day given by the user
- * @param			:	Pointer to the Calender Array received from user
- * @retval			:	The Day received from the user
- * ======================================================================================*/
-static DS1307_DAYS_t FindDay(uint8_t *Calender);
-
 /*=======================================================================================
  * @fn		 		:	Calculate_Calender
  * @brief			:	Translate The Calender given by the user from ASCII to Decimal values
@@ -151,10 +223,312 @@ static void Calculate_Calender(DS1307_Config_t *Date_Time_To_RTC, uint8_t *Date_
 
 /*=======================================================================================
  * @fn		 		:	Check_Calender
- * @brief			:	Check The Calender given by the user
+ * @brief			:	Check The Calender given by the user Is a Real Date & Time ( Month Lengths & Leap Years )
  * @param			:	Pointer to the Calender struct which will be sent to RTC
  * @retval			:	Error State
  * ======================================================================================*/
 static Error_State_t Check_Calender(DS1307_Config_t *Date_Time_To_RTC);
 
+/*=======================================================================================
+ * @fn		 		:	Check_CalenderDigits
+ * @brief			:	Check Each Field of The Calender Array received from user is Two Decimal Digits
+ * @param			:	Pointer to the Calender Array received from user
+ * @param			:	Number of Fields , Each Two Digits & One Separator
+ * @retval			:	Error State
+ * ======================================================================================*/
+static Error_State_t Check_CalenderDigits(uint8_t *Date_Time_From_USART, uint8_t FieldsNum);
+
+/*==============================================================================================================================================
+ *@fn      : void FireAlarm(uint16_t AlarmId, uint8_t Beeps)
+ *@brief  :  This Function Is Responsible For Sending The Alarm Number & Its Name To The Blue Pill & Ringing The Bell Once Sent
+ *@paramter[in]  : uint16_t AlarmId : Id Of The Fired Alarm
+ *@paramter[in]  : uint8_t Beeps : Number Of Bell Pulses
+ *@retval void :
+ *==============================================================================================================================================*/
+static void FireAlarm(uint16_t AlarmId, uint8_t Beeps);
+
+/*==============================================================================================================================================
+ *@fn      : uint8_t ReceiveLine(uint8_t *Line, uint8_t MaxLength)
+ *@brief  :  This Function Is Responsible For Receiving Characters From The Terminal Until The User Press Enter
+ *@paramter[out] : uint8_t *Line : Received Characters , Characters Beyond MaxLength Are Dropped
+ *@paramter[in]  : uint8_t MaxLength : Size Of Line
+ *@retval uint8_t : Number Of Characters Stored In Line
+ *==============================================================================================================================================*/
+static uint8_t ReceiveLine(uint8_t *Line, uint8_t MaxLength);
+
+/*==============================================================================================================================================
+ *@fn      : void ReadRecurrence(AlarmPool_Record_t *Record)
+ *@brief  :  This Function Is Responsible For Asking The User On Which Days & How Often An Alarm Repeats
+ *@paramter[out] : AlarmPool_Record_t *Record : Alarm Record Whose Rule & Once Flag Are Set
+ *@retval void :
+ *==============================================================================================================================================*/
+static void ReadRecurrence(AlarmPool_Record_t *Record);
+
+/*==============================================================================================================================================
+ *@fn      : void SendNumber(uint16_t Number)
+ *@brief  :  This Function Is Responsible For Sending a Number In Decimal To The Terminal
+ *@paramter[in]  : uint16_t Number : Number To Be Sent
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SendNumber(uint16_t Number);
+
+/*==============================================================================================================================================
+ *@fn      : Error_State_t NextAlarmDeadline(const AlarmPool_Record_t *Record, uint32_t Now, uint32_t *Deadline)
+ *@brief  :  This Function Is Responsible For Getting The First Time After Now An Alarm Is Due At By Its Recurrence Rule
+ *@paramter[in]  : const AlarmPool_Record_t *Record : Alarm Record
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds , An Alarm At This Exact Second Is Not Returned
+ *@paramter[out] : uint32_t *Deadline : Deadline In Epoch Seconds
+ *@retval Error_State_t : NOK If The Rule Never Matches Again
+ *==============================================================================================================================================*/
+static Error_State_t NextAlarmDeadline(const AlarmPool_Record_t *Record, uint32_t Now, uint32_t *Deadline);
+
+/*==============================================================================================================================================
+ *@fn      : void RebuildAlarms(uint32_t From, uint32_t Now)
+ *@brief  :  This Function Is Responsible For Queueing All Enabled Alarms By Their First Deadline After From , Firing Those Already Due
+ *			 At Now & Arming The Nearest Remaining One
+ *@paramter[in]  : uint32_t From : Time To Search Deadlines After In Epoch Seconds
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds
+ *@retval void :
+ *==============================================================================================================================================*/
+static void RebuildAlarms(uint32_t From, uint32_t Now);
+
+/*==============================================================================================================================================
+ *@fn      : void ArmNextAlarm(void)
+ *@brief  :  This Function Is Responsible For Arming One Timer At The Nearest Deadline Of The Alarm Queue , The RTC Hardware Alarm
+ *			 If The RTC Has One , Otherwise The Soft Clock Deadline
+ *@retval void :
+ *==============================================================================================================================================*/
+static void ArmNextAlarm(void);
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmsDue(uint32_t Now)
+ *@brief  :  This Function Is Responsible For Handling Every Queued Deadline At Or Before Now By The Alarm State ( Fire , Ring Again ,
+ *			 Snooze , Give Up Or Finish An Acknowledged Alarm ) & Arming The Timer For The Nearest One
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmsDue(uint32_t Now);
+
+/*==============================================================================================================================================
+ *@fn      : void RingAlarm(uint16_t AlarmId, AlarmPool_Record_t *Record, uint32_t Now)
+ *@brief  :  This Function Is Responsible For Ringing an Active Alarm With One More Beep Every ( ALARM_RINGS_PER_SNOOZE ) Rings &
+ *			 Queueing Its Next Ring
+ *@paramter[in]  : uint16_t AlarmId : Id Of The Alarm
+ *@paramter[in]  : AlarmPool_Record_t *Record : Record Of The Alarm
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds
+ *@retval void :
+ *==============================================================================================================================================*/
+static void RingAlarm(uint16_t AlarmId, AlarmPool_Record_t *Record, uint32_t Now);
+
+/*==============================================================================================================================================
+ *@fn      : void FinishAlarm(uint16_t AlarmId, AlarmPool_Record_t *Record, uint32_t Now)
+ *@brief  :  This Function Is Responsible For Returning an Alarm To Idle & Queueing It At Its Next Deadline After Now , a One Shot
+ *			 Alarm Is Disabled & Removed From The Queue
+ *@paramter[in]  : uint16_t AlarmId : Id Of The Alarm
+ *@paramter[in]  : AlarmPool_Record_t *Record : Record Of The Alarm
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds
+ *@retval void :
+ *==============================================================================================================================================*/
+static void FinishAlarm(uint16_t AlarmId, AlarmPool_Record_t *Record, uint32_t Now);
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmButton_ISR(void)
+ *@brief  :  This Function Is The EXTI Call Back Of The User Button , Posts The Button Event
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmButton_ISR(void);
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmButtonDue(uint32_t Arg)
+ *@brief  :  This Function Is The Button Task , Acknowledges The Ringing Alarms
+ *@paramter[in]  : uint32_t Arg : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmButtonDue(uint32_t Arg);
+
+/*==============================================================================================================================================
+ *@fn      : uint16_t ReadTimerNumber(void)
+ *@brief  :  This Function Is Responsible For Asking The User For a Countdown Number
+ *@retval uint16_t : Timer Id Of The Countdown , ( TIMERS_COUNTDOWNS ) If The Number Is Not Valid
+ *==============================================================================================================================================*/
+static uint16_t ReadTimerNumber(void);
+
+/*==============================================================================================================================================
+ *@fn      : Error_State_t ReadDuration(uint32_t *Milliseconds)
+ *@brief  :  This Function Is Responsible For Receiving a Duration Typed In Seconds With Up To 3 Decimal Places
+ *@paramter[out] : uint32_t *Milliseconds : Duration In ms
+ *@retval Error_State_t : NOK If The Duration Is Not a Number Or Longer Than ( TIMERS_MAX_DURATION )
+ *==============================================================================================================================================*/
+static Error_State_t ReadDuration(uint32_t *Milliseconds);
+
+/*==============================================================================================================================================
+ *@fn      : void ShowTimers(void)
+ *@brief  :  This Function Is Responsible For Listing The Countdowns & The Stopwatch On The Terminal & Showing The Stopwatch On The LCD ,
+ *			 Or The Nearest Countdown While The Stopwatch Is Cleared
+ *@retval void :
+ *==============================================================================================================================================*/
+static void ShowTimers(void);
+
+/*==============================================================================================================================================
+ *@fn      : void SendDuration(uint32_t Milliseconds)
+ *@brief  :  This Function Is Responsible For Sending a Duration To The Terminal As H:MM:SS.mmm
+ *@paramter[in]  : uint32_t Milliseconds : Duration In ms
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SendDuration(uint32_t Milliseconds);
+
+/*==============================================================================================================================================
+ *@fn      : void SendDigits(uint32_t Number, uint8_t Width)
+ *@brief  :  This Function Is Responsible For Sending The Lowest Width Decimal Digits Of a Number To The Terminal , Zero Padded
+ *@paramter[in]  : uint32_t Number : Number To Be Sent
+ *@paramter[in]  : uint8_t Width : Number Of Digits
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SendDigits(uint32_t Number, uint8_t Width);
+
+/*==============================================================================================================================================
+ *@fn      : void SendTimerFrame(uint8_t Number, uint32_t Milliseconds)
+ *@brief  :  This Function Is Responsible For Sending a Timer Reading To The Blue Pill LCD
+ *@paramter[in]  : uint8_t Number : Countdown Number , 0 For The Stopwatch
+ *@paramter[in]  : uint32_t Milliseconds : Time In ms
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SendTimerFrame(uint8_t Number, uint32_t Milliseconds);
+
+/*==============================================================================================================================================
+ *@fn      : void CountdownDone(uint16_t TimerId)
+ *@brief  :  This Function Is The Call Back Of The Countdowns , Shows The Ended Countdown On The LCD & Rings The Bell
+ *@paramter[in]  : uint16_t TimerId : Id Of The Ended Countdown
+ *@retval void :
+ *==============================================================================================================================================*/
+static void CountdownDone(uint16_t TimerId);
+
+/*==============================================================================================================================================
+ *@fn      : void HwAlarm_ISR(void)
+ *@brief  :  This Function Is The EXTI Call Back Of The RTC INT Pin , Posts The Alarm Event
+ *@retval void :
+ *==============================================================================================================================================*/
+static void HwAlarm_ISR(void);
+
+/*==============================================================================================================================================
+ *@fn      : void HwAlarmDue(void)
+ *@brief  :  This Function Is Responsible For Firing The Alarms Matched By The RTC INT Pin & Programming The Next One
+ *@retval void :
+ *==============================================================================================================================================*/
+static void HwAlarmDue(void);
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmDeadline(uint32_t Now)
+ *@brief  :  This Function Is The Soft Clock Deadline Call Back , Posts The Alarm Event
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmDeadline(uint32_t Now);
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmTask(uint32_t Now)
+ *@brief  :  This Function Is The Alarm Task , Handles The Due Alarms At Thread Level
+ *@paramter[in]  : uint32_t Now : Epoch Second Of The Soft Clock Deadline , ALARM_DUE_RTC_MATCH For The RTC INT Pin
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmTask(uint32_t Now);
+
+/*==============================================================================================================================================
+ *@fn      : void SecondTick(uint16_t TimerId)
+ *@brief  :  This Function Is The Call Back Of The Second Timer , Posts The Second Event
+ *@paramter[in]  : uint16_t TimerId : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SecondTick(uint16_t TimerId);
+
+/*==============================================================================================================================================
+ *@fn      : void SecondTask(uint32_t Arg)
+ *@brief  :  This Function Is The Second Task , Saves The Changed Alarms , Refreshes The Time On The LCD & Checks The RTC Health
+ *@paramter[in]  : uint32_t Arg : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SecondTask(uint32_t Arg);
+
+/*==============================================================================================================================================
+ *@fn      : void SaveAlarms(void)
+ *@brief  :  This Function Is Responsible For Writing The Alarms Changed From The Console Or Finished To The RTC Battery Backed RAM
+ *@retval void :
+ *@note    : Records Not Written Are Tried Again Next Second
+ *==============================================================================================================================================*/
+static void SaveAlarms(void);
+
+/*==============================================================================================================================================
+ *@fn      : void SendFrame(uint8_t Frame, const uint8_t *Data)
+ *@brief  :  This Function Is Responsible For Queuing a Copy Of a Frame To The Blue Pill & Starting It If The SPI Is Free
+ *@paramter[in]  : uint8_t Frame : Frame Kind ( SPI_FRAME_xxx )
+ *@paramter[in]  : const uint8_t *Data : Frame Bytes , Free To Change Once This Function Returns
+ *@retval void :
+ *@note    : Safe From Tasks & Interrupts , One Frame Of Each Kind Waits At Most
+ *==============================================================================================================================================*/
+static void SendFrame(uint8_t Frame, const uint8_t *Data);
+
+/*==============================================================================================================================================
+ *@fn      : void StartNextFrame(void)
+ *@brief  :  This Function Is Responsible For Sending The Waiting Frame Of The Lowest Kind , Alarms First
+ *@retval void :
+ *@note    : Called With Interrupts Masked Or From The SPI Interrupt
+ *==============================================================================================================================================*/
+static void StartNextFrame(void);
+
+/*==============================================================================================================================================
+ *@fn      : void SpiDoneTask(uint32_t Frame)
+ *@brief  :  This Function Is The SPI Done Task , Rings The Bell After an Alarm Frame & Starts The Next Frame
+ *@paramter[in]  : uint32_t Frame : Kind Of The Sent Frame
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SpiDoneTask(uint32_t Frame);
+
+/*==============================================================================================================================================
+ *@fn      : void Console_ISR(uint16_t Data)
+ *@brief  :  This Function Is The USART2 Receive Call Back , Buffers The Byte & Posts The Console Event
+ *@paramter[in]  : uint16_t Data : Received Byte
+ *@retval void :
+ *==============================================================================================================================================*/
+static void Console_ISR(uint16_t Data);
+
+/*==============================================================================================================================================
+ *@fn      : void Console_Task(uint32_t Arg)
+ *@brief  :  This Function Is The Console Task , Runs The Console Handler Till The Typed Input Is Read
+ *@paramter[in]  : uint32_t Arg : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void Console_Task(uint32_t Arg);
+
+/*==============================================================================================================================================
+ *@fn      : void Console_Delay(uint32_t Milliseconds)
+ *@brief  :  This Function Is Responsible For Waiting While Other Tasks Run
+ *@paramter[in]  : uint32_t Milliseconds : Time To Wait In ms
+ *@retval void :
+ *==============================================================================================================================================*/
+static void Console_Delay(uint32_t Milliseconds);
+
+/*==============================================================================================================================================
+ *@fn      : void ScheduleAlarm(uint16_t AlarmId)
+ *@brief  :  This Function Is Responsible For Moving One Changed Alarm In The Alarm Queue & Arming The Nearest Deadline
+ *@paramter[in]  : uint16_t AlarmId : Id Of The Changed Alarm , Removed From The Queue If Freed Or Disabled
+ *@retval void :
+ *==============================================================================================================================================*/
+static void ScheduleAlarm(uint16_t AlarmId);
+
+/*==============================================================================================================================================
+ *@fn      : void I2C_Poll(uint16_t TimerId)
+ *@brief  :  This Function Is The Call Back Of The I2C Timer , Aborts The Transfers That Exceeded Their Timeout
+ *@paramter[in]  : uint16_t TimerId : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void I2C_Poll(uint16_t TimerId);
+
+/*==============================================================================================================================================
+ *@fn      : void I2C_RecoveryTask(uint32_t Arg)
+ *@brief  :  This Function Is The I2C Recovery Task , Recovers The Bus After An Aborted Transfer & Restarts Its Queue
+ *@paramter[in]  : uint32_t Arg : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void I2C_RecoveryTask(uint32_t Arg);
+
 #endif /* _SERVICE_PRIVATE_H_ */
@@ -0,0 +1,56 @@
+/*
+ ******************************************************************************
+ * @file           : SoftClock.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Software Clock Synchronized By The RTC Square Wave Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_SOFTCLOCK_H_
+#define INC_SOFTCLOCK_H_
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_Init
+ * @brief			:	Load The Time From The RTC , Enable its 1 HZ Square Wave & Route it to EXTI
+ * 						to Keep The Time in RAM
+ * @param			:	I2C Configurations of The RTC
+ * @retval			:	Error State
+ * @note			:	I2C , SQW Pin , SYSCFG Clock & EXTI IRQ Must be Initialized Before & ( RTC_Init ) Called ,
+ * 						An RTC With a Hardware Alarm Keeps its INT Pin For The Alarm So The Time is Read From it Directly
+ * ======================================================================================*/
+Error_State_t SoftClock_Init(I2C_Configs_t *I2CConfig);
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_GetTime
+ * @brief			:	Get The Current Date & Time From RAM Without Accessing The RTC
+ * @param			:	Structure to Copy The Time in
+ * @retval			:	void
+ * @note			:	Blocking RTC Read If The RTC Has a Hardware Alarm ( No Square Wave Ticks )
+ * ======================================================================================*/
+void SoftClock_GetTime(DS1307_Config_t *Time);
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_SetTime
+ * @brief			:	Write Date & Time to The RTC & Update The Time in RAM
+ * @param			:	New Date & Time
+ * @retval			:	Error State ( Time in RAM is Not Changed If The RTC Write Failed )
+ * ======================================================================================*/
+Error_State_t SoftClock_SetTime(const DS1307_Config_t *Time);
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_SetDeadline
+ * @brief			:	Arm a One Shot Call Back For The First Second at or After a Deadline
+ * @param			:	Deadline in Epoch Seconds
+ * @param			:	Call Back , Called From PendSV After The Tick With The Current Epoch Seconds ,
+ * 						NULL to Disarm
+ * @retval			:	void
+ * @note			:	Replaces The Armed Deadline , a Time Jump Past The Deadline Still Calls it ,
+ * 						Not Available If The RTC Has a Hardware Alarm ( No Ticks )
+ * ======================================================================================*/
+void SoftClock_SetDeadline(uint32_t Deadline, void (*CallBack)(uint32_t Now));
+
+#endif /* INC_SOFTCLOCK_H_ */
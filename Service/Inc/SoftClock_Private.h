@@ -0,0 +1,69 @@
+/*
+ ******************************************************************************
+ * @file           : SoftClock_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Software Clock Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _SOFTCLOCK_PRIVATE_H_
+#define _SOFTCLOCK_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* RTC SQW/OUT ( INT/SQW on DS3231 ) is Connected to PB0 */
+#define SOFTCLOCK_SQW_PORT GPIO_PORTB
+#define SOFTCLOCK_SQW_LINE EXTI0
+
+/* Seconds Between Two Readings of The RTC to Correct The Time in RAM */
+#define SOFTCLOCK_RESYNC_PERIOD 3600u
+
+#define SOFTCLOCK_DAYS_IN_WEEK 7u
+
+#define MAX_SECONDS 59u
+#define MAX_MINUTES 59u
+#define MAX_HOURS 23u
+#define MAX_MONTH 12u
+#define MAX_YEAR 99u
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_Tick
+ * @brief			:	EXTI Call Back of The 1 HZ Square Wave , Advance The Time One Second & Post The Rest of
+ * 						The Second ( SoftClock_Second )
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void SoftClock_Tick(void);
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_Second
+ * @brief			:	Deferred Work of Each Tick , Call The Due Deadline , Abort a Stuck RTC Transfer &
+ * 						Start The RTC Correction Write or The Resync Reading Every ( SOFTCLOCK_RESYNC_PERIOD )
+ * @param			:	Not Used
+ * @retval			:	void
+ * ======================================================================================*/
+static void SoftClock_Second(uint32_t Arg);
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_ResyncDone
+ * @brief			:	I2C Call Back of The Resync Reading , Replaces The Time in RAM With The RTC Time
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void SoftClock_ResyncDone(void);
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_Increment
+ * @brief			:	Advance Date & Time One Second
+ * @param			:	Date & Time to Advance
+ * @retval			:	void
+ * ======================================================================================*/
+static void SoftClock_Increment(DS1307_Config_t *Time);
+
+#endif /* _SOFTCLOCK_PRIVATE_H_ */
@@ -0,0 +1,68 @@
+/*
+ ******************************************************************************
+ * @file           : StringArena.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Interned Strings Arena Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_STRINGARENA_H_
+#define INC_STRINGARENA_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Bytes of The Arena , Each String Takes its Length + 3 Bytes */
+#define STRINGARENA_SIZE 8192u
+
+/* Number of Different Strings Held at Once */
+#define STRINGARENA_MAX_STRINGS 320u
+
+/* Handle of No String */
+#define STRINGARENA_NO_STRING 0xFFFFu
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Init
+ * @brief			:	Release All Strings & Empty The Arena
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void StringArena_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Intern
+ * @brief			:	Get a Handle of a String , Equal Strings Share One Copy in The Arena
+ * @param			:	String Bytes ( Not Terminated )
+ * @param			:	Length of The String ( 1 - 255 )
+ * @param			:	Returns Handle of The String
+ * @retval			:	Error State ( NOK If The Arena or The Strings Table is Full )
+ * @note			:	Each Successful Call Must be Matched By ( StringArena_Release ) ,
+ * 						Released Bytes Are Reused After The Arena is Compacted When it Fills
+ * ======================================================================================*/
+Error_State_t StringArena_Intern(const uint8_t *String, uint8_t Length, uint16_t *Handle);
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Release
+ * @brief			:	Drop One Reference of a String , The String is Freed With The Last Reference
+ * @param			:	Handle of The String , ( STRINGARENA_NO_STRING ) is Ignored
+ * @retval			:	void
+ * ======================================================================================*/
+void StringArena_Release(uint16_t Handle);
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Get
+ * @brief			:	Get The Bytes of a String
+ * @param			:	Handle of The String
+ * @param			:	Returns Pointer to The String Bytes in The Arena
+ * @param			:	Returns Length of The String
+ * @retval			:	Error State ( NOK If The Handle is Not Held )
+ * @note			:	The Pointer is Valid Till The Next ( StringArena_Intern ) , Which May Compact The Arena
+ * ======================================================================================*/
+Error_State_t StringArena_Get(uint16_t Handle, const uint8_t **String, uint8_t *Length);
+
+#endif /* INC_STRINGARENA_H_ */
@@ -0,0 +1,73 @@
+/*
+ ******************************************************************************
+ * @file           : StringArena_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Interned Strings Arena Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _STRINGARENA_PRIVATE_H_
+#define _STRINGARENA_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+/* Each String in The Arena is Preceded By its Length & Owner Handle ( Low , High ) ,
+ * The Owner is ( STRINGARENA_NO_STRING ) Once Released So Compaction Skips it */
+#define STRINGARENA_HEADER_SIZE 3u
+#define STRINGARENA_HEADER_LENGTH 0u
+#define STRINGARENA_HEADER_OWNER_L 1u
+#define STRINGARENA_HEADER_OWNER_H 2u
+
+/* ========================================================================= *
+ *                         PRIVATE TYPES SECTION                             *
+ * ========================================================================= */
+
+typedef struct
+{
+	/* Offset of The String Bytes , After its Header */
+	uint16_t Offset;
+
+	/* 0 Means The Entry is Free */
+	uint16_t References;
+
+	uint8_t Length;
+
+	/* Checked Before The Bytes When Interning */
+	uint8_t Hash;
+
+} StringArena_Entry_t;
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Hash
+ * @brief			:	8 Bits Hash of a String
+ * @param			:	String Bytes
+ * @param			:	Length of The String
+ * @retval			:	Hash
+ * ======================================================================================*/
+static uint8_t StringArena_Hash(const uint8_t *String, uint8_t Length);
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Find
+ * @brief			:	Search The Held Strings For an Equal One
+ * @param			:	String Bytes
+ * @param			:	Length of The String
+ * @param			:	Hash of The String
+ * @retval			:	Handle of The Equal String or ( STRINGARENA_NO_STRING )
+ * ======================================================================================*/
+static uint16_t StringArena_Find(const uint8_t *String, uint8_t Length, uint8_t Hash);
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Compact
+ * @brief			:	Move The Held Strings to The Arena Start Keeping Their Order & Handles
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void StringArena_Compact(void);
+
+#endif /* _STRINGARENA_PRIVATE_H_ */
@@ -0,0 +1,94 @@
+/*
+ ******************************************************************************
+ * @file           : TimeBase.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Monotonic 64 Bit Time Base , Delays & Timeouts Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_TIMEBASE_H_
+#define INC_TIMEBASE_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* SysTick Period , The Millisecond Count Advances Once Per Tick */
+#define TIMEBASE_TICK_MS 1u
+
+/* HCLK in MHz , The DWT Cycle Counter Runs at HCLK */
+#define TIMEBASE_HCLK_MHZ SYSTEM_HCLK_MHZ
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Init
+ * @brief			:	Start The DWT Cycle Counter & The SysTick Millisecond Tick
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	The Time Base Owns SysTick , Modules Needing The Tick Register a Call Back
+ * ======================================================================================*/
+void TimeBase_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_SetTickCallBack
+ * @brief			:	Set The Function Called From The SysTick Interrupt After Each Tick
+ * @param			:	Call Back , NULL Removes it
+ * @retval			:	void
+ * ======================================================================================*/
+void TimeBase_SetTickCallBack(void (*CallBack)(void));
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Millis
+ * @brief			:	SysTick Ticks Since TimeBase_Init in ms
+ * @param			:	void
+ * @retval			:	Millisecond Count , Never Wraps
+ * ======================================================================================*/
+uint64_t TimeBase_Millis(void);
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Micros
+ * @brief			:	Time Since TimeBase_Init in us
+ * @param			:	void
+ * @retval			:	Microsecond Count , Never Wraps & Never Goes Back
+ * @note			:	The DWT Cycle Counter Extended to 64 Bits at Each Tick , Exact Even While The Tick is Pending
+ * ======================================================================================*/
+uint64_t TimeBase_Micros(void);
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Deadline
+ * @brief			:	Time Base Value a Timeout Expires at
+ * @param			:	Timeout in us
+ * @retval			:	Deadline in us , Checked By TimeBase_Expired
+ * ======================================================================================*/
+uint64_t TimeBase_Deadline(uint32_t Timeout_us);
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Expired
+ * @brief			:	Check a Deadline Set By TimeBase_Deadline
+ * @param			:	Deadline in us
+ * @retval			:	1 If The Deadline Has Passed , 0 If Not
+ * ======================================================================================*/
+uint8_t TimeBase_Expired(uint64_t Deadline);
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_DelayUs
+ * @brief			:	Busy Wait on The Time Base
+ * @param			:	Time in us
+ * @retval			:	void
+ * @note			:	SysTick & Other Interrupts Keep Running During The Wait
+ * ======================================================================================*/
+void TimeBase_DelayUs(uint32_t Time_us);
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_DelayMs
+ * @brief			:	Busy Wait on The Time Base
+ * @param			:	Time in ms
+ * @retval			:	void
+ * @note			:	SysTick & Other Interrupts Keep Running During The Wait
+ * ======================================================================================*/
+void TimeBase_DelayMs(uint32_t Time_ms);
+
+#endif /* INC_TIMEBASE_H_ */
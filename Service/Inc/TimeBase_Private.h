@@ -0,0 +1,25 @@
+/*
+ ******************************************************************************
+ * @file           : TimeBase_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Monotonic 64 Bit Time Base , Delays & Timeouts Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _TIMEBASE_PRIVATE_H_
+#define _TIMEBASE_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Tick
+ * @brief			:	SysTick Call Back , Advances The Millisecond Count , Extends The Cycle Count &
+ * 						Calls The Registered Tick Call Back
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void TimeBase_Tick(void);
+
+#endif /* _TIMEBASE_PRIVATE_H_ */
@@ -0,0 +1,137 @@
+/*
+ ******************************************************************************
+ * @file           : Timers.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Millisecond Timing Wheel Timers & Stopwatch Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef INC_TIMERS_H_
+#define INC_TIMERS_H_
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Wheel Tick , Driven By The Time Base SysTick Tick */
+#define TIMERS_TICK_MS TIMEBASE_TICK_MS
+
+/* Countdown Timers Set From The Console Take Ids ( 0 - TIMERS_COUNTDOWNS - 1 ) , The Host Benchmark Builds With More */
+#ifndef TIMERS_COUNTDOWNS
+#define TIMERS_COUNTDOWNS 16u
+#endif
+
+/* Id Kept For The Alarm Bell Pattern */
+#define TIMERS_BELL_ID TIMERS_COUNTDOWNS
+
+/* Id Kept For The Clock Second Tick Posted to The Scheduler */
+#define TIMERS_SECOND_ID (TIMERS_COUNTDOWNS + 1u)
+
+/* Id Kept For The I2C Timeout Check */
+#define TIMERS_I2C_ID (TIMERS_COUNTDOWNS + 2u)
+
+/* Number of Timer Ids */
+#define TIMERS_MAX (TIMERS_COUNTDOWNS + 3u)
+
+/* Longest Duration in ms , Deadlines Stay Within Half The Wrap of The Millisecond Count ( 24 Days ) */
+#define TIMERS_MAX_DURATION 0x7FFFFFFFu
+
+/* Timing Wheel : 4 Levels of 256 Slots Cover The Whole 32 Bit Millisecond Count , a Level Slot Spans 256 Slots of The Level Below */
+#define TIMERS_WHEEL_BITS 8u
+#define TIMERS_WHEEL_SLOTS (1u << TIMERS_WHEEL_BITS)
+#define TIMERS_WHEEL_LEVELS 4u
+
+/* ========================================================================= *
+ *                      FUNCTIONS PROTOTYPES SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Init
+ * @brief			:	Stop All Timers & Hook The Wheel to The Time Base Tick
+ * @param			:	void
+ * @retval			:	void
+ * @note			:	Called After ( Deferred_Init ) & ( TimeBase_Init )
+ * ======================================================================================*/
+void Timers_Init(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Millis
+ * @brief			:	Milliseconds Since Timers_Init , Wraps After 49 Days
+ * @param			:	void
+ * @retval			:	Millisecond Count
+ * ======================================================================================*/
+uint32_t Timers_Millis(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Start
+ * @brief			:	Start a One Shot Timer or Restart a Running One
+ * @param			:	Timer Id ( 0 - TIMERS_MAX - 1 )
+ * @param			:	Duration in ms ( 0 - TIMERS_MAX_DURATION )
+ * @param			:	Call Back , Called From PendSV With The Timer Id Once The Duration Passes
+ * @retval			:	Error State ( NOK If The Id or The Duration is Out of Range )
+ * @note			:	O( 1 ) , Safe From Any Context , a Call Back May Start Timers Again
+ * ======================================================================================*/
+Error_State_t Timers_Start(uint16_t TimerId, uint32_t Duration, void (*CallBack)(uint16_t TimerId));
+
+/*=======================================================================================
+ * @fn		 		:	Timers_StartPeriodic
+ * @brief			:	Start a Periodic Timer or Restart a Running One
+ * @param			:	Timer Id ( 0 - TIMERS_MAX - 1 )
+ * @param			:	Period in ms ( 1 - TIMERS_MAX_DURATION ) , The First Call Back Comes After One Period
+ * @param			:	Call Back , Called From PendSV With The Timer Id Every Period
+ * @retval			:	Error State ( NOK If The Id or The Period is Out of Range )
+ * @note			:	O( 1 ) , Deadlines Are Counted From The Start So Late Call Backs Do Not Drift
+ * ======================================================================================*/
+Error_State_t Timers_StartPeriodic(uint16_t TimerId, uint32_t Period, void (*CallBack)(uint16_t TimerId));
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Stop
+ * @brief			:	Stop a Running Timer Without Calling its Call Back
+ * @param			:	Timer Id
+ * @retval			:	Error State ( NOK If The Timer is Not Running )
+ * @note			:	O( 1 )
+ * ======================================================================================*/
+Error_State_t Timers_Stop(uint16_t TimerId);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Remaining
+ * @brief			:	Time Left Before a Running Timer Expires
+ * @param			:	Timer Id
+ * @param			:	Returns Time Left in ms
+ * @retval			:	Error State ( NOK If The Timer is Not Running )
+ * ======================================================================================*/
+Error_State_t Timers_Remaining(uint16_t TimerId, uint32_t *Remaining);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_StopwatchStart
+ * @brief			:	Start The Stopwatch or Resume it From The Time it Was Stopped at
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void Timers_StopwatchStart(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_StopwatchStop
+ * @brief			:	Stop The Stopwatch Keeping its Time
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void Timers_StopwatchStop(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_StopwatchReset
+ * @brief			:	Clear The Stopwatch Time , a Running Stopwatch Keeps Running From 0
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void Timers_StopwatchReset(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_StopwatchRead
+ * @brief			:	Stopwatch Time
+ * @param			:	Returns 1 If The Stopwatch is Running , 0 If Not , May be NULL
+ * @retval			:	Time in ms
+ * ======================================================================================*/
+uint32_t Timers_StopwatchRead(uint8_t *Running);
+
+#endif /* INC_TIMERS_H_ */
@@ -0,0 +1,109 @@
+/*
+ ******************************************************************************
+ * @file           : Timers_Private.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Millisecond Timing Wheel Timers & Stopwatch Private Header File
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef _TIMERS_PRIVATE_H_
+#define _TIMERS_PRIVATE_H_
+
+/* ========================================================================= *
+ *                         PRIVATE MACROS SECTION                            *
+ * ========================================================================= */
+
+#define TIMERS_WHEEL_MASK (TIMERS_WHEEL_SLOTS - 1u)
+
+/* Slot Lists of All Levels Then The Expired List , Each Running Timer is in Exactly One List */
+#define TIMERS_EXPIRED_LIST (TIMERS_WHEEL_LEVELS * TIMERS_WHEEL_SLOTS)
+#define TIMERS_LISTS (TIMERS_EXPIRED_LIST + 1u)
+
+/* List of a Stopped Timer & End of a List */
+#define TIMERS_NOT_RUNNING 0xFFFFu
+#define TIMERS_LIST_END 0xFFFFu
+
+/* Slot of Level ( LEVEL ) a Deadline Falls in */
+#define TIMERS_SLOT(LEVEL, DEADLINE) (((LEVEL) * TIMERS_WHEEL_SLOTS) + (((DEADLINE) >> ((LEVEL) * TIMERS_WHEEL_BITS)) & TIMERS_WHEEL_MASK))
+
+/* ========================================================================= *
+ *                         PRIVATE TYPES SECTION                             *
+ * ========================================================================= */
+
+typedef struct
+{
+	void (*CallBack)(uint16_t TimerId);
+
+	uint32_t Deadline;
+
+	/* 0 For a One Shot Timer */
+	uint32_t Period;
+
+	/* Links in The List The Timer is in , So Stop Removes it Without Searching */
+	uint16_t Next;
+	uint16_t Previous;
+	uint16_t List;
+
+} Timers_Timer_t;
+
+/* ========================================================================= *
+ *                         PRIVATE FUNCTIONS SECTION                         *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Arm
+ * @brief			:	Start a Timer With a Deadline Period After Now
+ * @param			:	Timer Id
+ * @param			:	Duration in ms
+ * @param			:	Period in ms , 0 For a One Shot Timer
+ * @param			:	Call Back
+ * @retval			:	Error State ( NOK If The Id or The Duration is Out of Range )
+ * ======================================================================================*/
+static Error_State_t Timers_Arm(uint16_t TimerId, uint32_t Duration, uint32_t Period, void (*CallBack)(uint16_t TimerId));
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Place
+ * @brief			:	Put a Timer in The Slot of its Deadline , The Nearer The Deadline The Lower The Level ,
+ * 						a Passed Deadline Goes to The Expired List
+ * @param			:	Timer Id
+ * @param			:	The Next Tick to be Processed
+ * @retval			:	void
+ * @note			:	Called With The Timers Locked
+ * ======================================================================================*/
+static void Timers_Place(uint16_t TimerId, uint32_t NextTick);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Link
+ * @brief			:	Add a Timer to The Front of a List
+ * @param			:	Timer Id
+ * @param			:	List Index
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timers_Link(uint16_t TimerId, uint16_t List);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Unlink
+ * @brief			:	Remove a Timer From its List
+ * @param			:	Timer Id
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timers_Unlink(uint16_t TimerId);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Tick
+ * @brief			:	SysTick Call Back , Advances The Millisecond Count , Moves The Timers of a Higher Level Slot Down
+ * 						Once Every 256 Ticks of The Level Below & Posts The Expiry Work If The Current Slot Has Timers
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timers_Tick(void);
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Due
+ * @brief			:	Deferred Work , Calls Back Every Expired Timer & Starts a Periodic One Again
+ * @param			:	Not Used
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timers_Due(uint32_t Arg);
+
+#endif /* _TIMERS_PRIVATE_H_ */
@@ -0,0 +1,132 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmBell.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Timer Driven Alarm Bell Pattern
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/GPIO_Interface.h"
+#include "../Inc/Timers.h"
+#include "../Inc/AlarmBell.h"
+#include "../Inc/AlarmBell_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Pulses & Gaps Left in The Pattern , Odd While a Pulse is High , 0 While The Bell Timer is Stopped */
+static volatile uint8_t AlarmBell_Steps = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmBell_Ring
+ * @brief			:	Start a Pattern of Pulses on The Bell Pin , a Pattern Already Playing is Restarted
+ * @param			:	Number of Pulses ( 1 - ALARMBELL_MAX_BEEPS ) , Larger Numbers Are Limited
+ * @retval			:	void
+ * ======================================================================================*/
+void AlarmBell_Ring(uint8_t Beeps)
+{
+	uint32_t PriMask = 0;
+
+	if (Beeps > ALARMBELL_MAX_BEEPS)
+	{
+		Beeps = ALARMBELL_MAX_BEEPS;
+	}
+
+	if (Beeps > 0u)
+	{
+		/* The Timer Call Back Also Changes The Steps */
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		/* Each Pulse is Followed By a Gap , The Last Gap is Not Timed */
+		AlarmBell_Steps = (uint8_t)((2u * Beeps) - 1u);
+
+		GPIO_u8SetPinValue(ALARMBELL_PORT, ALARMBELL_PIN, PIN_HIGH);
+
+		/* Restarting The Timer Gives The First Pulse a Full Step */
+		Timers_Start(TIMERS_BELL_ID, ALARMBELL_STEP_MS, &AlarmBell_Step);
+
+		EXIT_CRITICAL_SECTION(PriMask);
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmBell_Stop
+ * @brief			:	Stop The Pattern Playing & Release The Bell Pin
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void AlarmBell_Stop(void)
+{
+	uint32_t PriMask = 0;
+
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	AlarmBell_Steps = 0;
+
+	Timers_Stop(TIMERS_BELL_ID);
+
+	GPIO_u8SetPinValue(ALARMBELL_PORT, ALARMBELL_PIN, PIN_LOW);
+
+	EXIT_CRITICAL_SECTION(PriMask);
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmBell_Step
+ * @brief			:	Bell Timer Call Back , Ends The Current Pulse or Gap & Times The Next Step Till The Last Pulse Ends
+ * @param			:	Timer Id , Not Used
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmBell_Step(uint16_t TimerId)
+{
+	uint32_t PriMask = 0;
+
+	(void)TimerId;
+
+	/* A Pattern Restarted From an Interrupt Changes The Steps */
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	if (0u == AlarmBell_Steps)
+	{
+		/* Stopped While The Call Back Was Pending */
+	}
+	else if (AlarmBell_Steps & 1u)
+	{
+		GPIO_u8SetPinValue(ALARMBELL_PORT, ALARMBELL_PIN, PIN_LOW);
+	}
+	else
+	{
+		GPIO_u8SetPinValue(ALARMBELL_PORT, ALARMBELL_PIN, PIN_HIGH);
+	}
+
+	if (AlarmBell_Steps > 0u)
+	{
+		AlarmBell_Steps--;
+	}
+
+	/* The Timer is Started Again Only While Steps Are Left */
+	if (AlarmBell_Steps > 0u)
+	{
+		Timers_Start(TIMERS_BELL_ID, ALARMBELL_STEP_MS, &AlarmBell_Step);
+	}
+
+	EXIT_CRITICAL_SECTION(PriMask);
+}
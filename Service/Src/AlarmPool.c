@@ -0,0 +1,202 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmPool.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Alarm Records Pool
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../Inc/Recurrence.h"
+#include "../Inc/AlarmPool.h"
+#include "../Inc/AlarmPool_Private.h"
+#include "../Inc/StringArena.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+static AlarmPool_Record_t AlarmPool_Records[ALARMPOOL_MAX_ALARMS];
+
+/* Next Free Record of Each Free Record , ( ALARMPOOL_ALLOCATED ) For Used Ones */
+static uint16_t AlarmPool_Links[ALARMPOOL_MAX_ALARMS];
+
+static uint16_t AlarmPool_FreeHead = ALARMPOOL_LIST_END;
+
+static uint16_t AlarmPool_Used = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_Init
+ * @brief			:	Free All Alarm Records & Their Names
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void AlarmPool_Init(void)
+{
+	uint16_t Counter = 0;
+
+	for (Counter = 0; Counter < ALARMPOOL_MAX_ALARMS; Counter++)
+	{
+		AlarmPool_Links[Counter] = Counter + 1u;
+	}
+	AlarmPool_Links[ALARMPOOL_MAX_ALARMS - 1u] = ALARMPOOL_LIST_END;
+
+	AlarmPool_FreeHead = 0;
+	AlarmPool_Used = 0;
+
+	/* The Arena Holds Alarm Names Only */
+	StringArena_Init();
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_Alloc
+ * @brief			:	Take a Free Alarm Record , Disabled , Idle & Unnamed With an Empty Time & a Daily Rule
+ * @param			:	Returns Alarm Id
+ * @retval			:	Error State ( NOK If All Records Are Used )
+ * ======================================================================================*/
+Error_State_t AlarmPool_Alloc(uint16_t *AlarmId)
+{
+	Error_State_t Error_State = OK;
+
+	AlarmPool_Record_t *Record = NULL;
+
+	uint8_t Counter = 0;
+
+	if (NULL == AlarmId)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (ALARMPOOL_LIST_END == AlarmPool_FreeHead)
+	{
+		*AlarmId = ALARMPOOL_NO_ALARM;
+		Error_State = NOK;
+	}
+	else
+	{
+		*AlarmId = AlarmPool_FreeHead;
+
+		AlarmPool_FreeHead = AlarmPool_Links[*AlarmId];
+		AlarmPool_Links[*AlarmId] = ALARMPOOL_ALLOCATED;
+		AlarmPool_Used++;
+
+		Record = &AlarmPool_Records[*AlarmId];
+
+		for (Counter = 0; Counter < ALARMPOOL_TIME_SIZE; Counter++)
+		{
+			Record->Time[Counter] = ALARMPOOL_EMPTY_TIME;
+		}
+		Recurrence_SetDaily(&Record->Rule);
+		Record->Flags = 0;
+		Record->State = ALARMPOOL_STATE_IDLE;
+		Record->Rings = 0;
+		Record->Name = STRINGARENA_NO_STRING;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_Free
+ * @brief			:	Return an Alarm Record to The Pool & Release its Name
+ * @param			:	Alarm Id
+ * @retval			:	Error State ( NOK If The Id is Not Allocated )
+ * ======================================================================================*/
+Error_State_t AlarmPool_Free(uint16_t AlarmId)
+{
+	Error_State_t Error_State = OK;
+
+	if (NULL == AlarmPool_Get(AlarmId))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		StringArena_Release(AlarmPool_Records[AlarmId].Name);
+
+		AlarmPool_Records[AlarmId].Name = STRINGARENA_NO_STRING;
+		AlarmPool_Records[AlarmId].Flags = 0;
+
+		AlarmPool_Links[AlarmId] = AlarmPool_FreeHead;
+		AlarmPool_FreeHead = AlarmId;
+		AlarmPool_Used--;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_Get
+ * @brief			:	Get an Allocated Alarm Record
+ * @param			:	Alarm Id
+ * @retval			:	Pointer to The Record , NULL If The Id is Not Allocated
+ * ======================================================================================*/
+AlarmPool_Record_t *AlarmPool_Get(uint16_t AlarmId)
+{
+	AlarmPool_Record_t *Record = NULL;
+
+	if ((AlarmId < ALARMPOOL_MAX_ALARMS) && (ALARMPOOL_ALLOCATED == AlarmPool_Links[AlarmId]))
+	{
+		Record = &AlarmPool_Records[AlarmId];
+	}
+
+	return Record;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_SetName
+ * @brief			:	Replace The Name of an Alarm
+ * @param			:	Alarm Id
+ * @param			:	Name Bytes ( Not Terminated )
+ * @param			:	Length of The Name ( 0 - ALARMPOOL_NAME_MAX ) , 0 Removes The Name
+ * @retval			:	Error State ( NOK If The Id is Not Allocated or The String Arena is Full , The Old Name is Kept )
+ * ======================================================================================*/
+Error_State_t AlarmPool_SetName(uint16_t AlarmId, const uint8_t *Name, uint8_t Length)
+{
+	Error_State_t Error_State = OK;
+
+	AlarmPool_Record_t *Record = AlarmPool_Get(AlarmId);
+
+	uint16_t Handle = STRINGARENA_NO_STRING;
+
+	if ((NULL == Record) || (Length > ALARMPOOL_NAME_MAX))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		if (Length > 0u)
+		{
+			/* The New Name is Held Before The Old One is Released , Renaming to The Same Name Keeps its Bytes */
+			Error_State = StringArena_Intern(Name, Length, &Handle);
+		}
+
+		if (OK == Error_State)
+		{
+			StringArena_Release(Record->Name);
+			Record->Name = Handle;
+		}
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmPool_Count
+ * @brief			:	Number of Allocated Alarm Records
+ * @param			:	void
+ * @retval			:	Count
+ * ======================================================================================*/
+uint16_t AlarmPool_Count(void)
+{
+	return AlarmPool_Used;
+}
@@ -0,0 +1,285 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmQueue.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Deadlines Min Heap
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../Inc/AlarmQueue.h"
+#include "../Inc/AlarmQueue_Private.h"
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Clear
+ * @brief			:	Remove All Entries From The Queue
+ * @param			:	Queue
+ * @retval			:	void
+ * ======================================================================================*/
+void AlarmQueue_Clear(AlarmQueue_t *Queue)
+{
+	uint16_t Counter = 0;
+
+	for (Counter = 0; Counter < Queue->Capacity; Counter++)
+	{
+		Queue->Position[Counter] = ALARMQUEUE_NOT_QUEUED;
+	}
+	Queue->Size = 0;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Add
+ * @brief			:	Queue an Alarm or Move an Already Queued One to a New Deadline
+ * @param			:	Queue
+ * @param			:	Alarm Id ( 0 - Capacity - 1 )
+ * @param			:	Deadline in The Queue Time Unit
+ * @retval			:	Error State ( NOK If The Id is Out of Range )
+ * ======================================================================================*/
+Error_State_t AlarmQueue_Add(AlarmQueue_t *Queue, uint16_t AlarmId, uint32_t Deadline)
+{
+	Error_State_t Error_State = OK;
+
+	uint16_t Index = 0;
+
+	if (AlarmId >= Queue->Capacity)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		if (ALARMQUEUE_NOT_QUEUED == Queue->Position[AlarmId])
+		{
+			/* New Leaf , There is Always Room as Each Id is Queued Once */
+			Index = Queue->Size++;
+
+			Queue->Heap[Index].AlarmId = AlarmId;
+			Queue->Position[AlarmId] = Index + 1u;
+		}
+		else
+		{
+			Index = Queue->Position[AlarmId] - 1u;
+		}
+
+		Queue->Heap[Index].Deadline = Deadline;
+
+		AlarmQueue_Restore(Queue, Index);
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Remove
+ * @brief			:	Remove an Alarm From The Queue
+ * @param			:	Queue
+ * @param			:	Alarm Id
+ * @retval			:	Error State ( NOK If The Alarm is Not Queued )
+ * ======================================================================================*/
+Error_State_t AlarmQueue_Remove(AlarmQueue_t *Queue, uint16_t AlarmId)
+{
+	Error_State_t Error_State = OK;
+
+	uint16_t Index = 0;
+
+	if ((AlarmId >= Queue->Capacity) || (ALARMQUEUE_NOT_QUEUED == Queue->Position[AlarmId]))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		Index = Queue->Position[AlarmId] - 1u;
+
+		/* Last Leaf Takes The Place of The Removed Entry */
+		Queue->Size--;
+		AlarmQueue_Swap(Queue, Index, Queue->Size);
+
+		Queue->Position[AlarmId] = ALARMQUEUE_NOT_QUEUED;
+
+		if (Index < Queue->Size)
+		{
+			AlarmQueue_Restore(Queue, Index);
+		}
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Peek
+ * @brief			:	Get The Alarm With The Nearest Deadline Without Removing it
+ * @param			:	Queue
+ * @param			:	Returns Alarm Id
+ * @param			:	Returns Deadline in The Queue Time Unit
+ * @retval			:	Error State ( NOK If The Queue is Empty )
+ * ======================================================================================*/
+Error_State_t AlarmQueue_Peek(const AlarmQueue_t *Queue, uint16_t *AlarmId, uint32_t *Deadline)
+{
+	Error_State_t Error_State = OK;
+
+	if ((NULL == AlarmId) || (NULL == Deadline))
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (0u == Queue->Size)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		*AlarmId = Queue->Heap[0].AlarmId;
+		*Deadline = Queue->Heap[0].Deadline;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Get
+ * @brief			:	Get The Deadline of a Queued Id
+ * @param			:	Queue
+ * @param			:	Alarm Id
+ * @param			:	Returns Deadline in The Queue Time Unit
+ * @retval			:	Error State ( NOK If The Id is Not Queued )
+ * ======================================================================================*/
+Error_State_t AlarmQueue_Get(const AlarmQueue_t *Queue, uint16_t AlarmId, uint32_t *Deadline)
+{
+	Error_State_t Error_State = OK;
+
+	if (NULL == Deadline)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if ((AlarmId >= Queue->Capacity) || (ALARMQUEUE_NOT_QUEUED == Queue->Position[AlarmId]))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		*Deadline = Queue->Heap[Queue->Position[AlarmId] - 1u].Deadline;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Pop
+ * @brief			:	Remove & Return The Alarm With The Nearest Deadline
+ * @param			:	Queue
+ * @param			:	Returns Alarm Id
+ * @param			:	Returns Deadline in The Queue Time Unit
+ * @retval			:	Error State ( NOK If The Queue is Empty )
+ * ======================================================================================*/
+Error_State_t AlarmQueue_Pop(AlarmQueue_t *Queue, uint16_t *AlarmId, uint32_t *Deadline)
+{
+	Error_State_t Error_State = AlarmQueue_Peek(Queue, AlarmId, Deadline);
+
+	if (OK == Error_State)
+	{
+		Error_State = AlarmQueue_Remove(Queue, *AlarmId);
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Count
+ * @brief			:	Number of Queued Entries
+ * @param			:	Queue
+ * @retval			:	Count
+ * ======================================================================================*/
+uint16_t AlarmQueue_Count(const AlarmQueue_t *Queue)
+{
+	return Queue->Size;
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_IsBefore
+ * @brief			:	Order of Two Entries , Equal Deadlines Are Ordered By Id
+ * @param			:	Queue
+ * @param			:	Heap Index of First Entry
+ * @param			:	Heap Index of Second Entry
+ * @retval			:	1 If The First is Due Before The Second , 0 If Not
+ * ======================================================================================*/
+static uint8_t AlarmQueue_IsBefore(const AlarmQueue_t *Queue, uint16_t First, uint16_t Second)
+{
+	const AlarmQueue_Entry_t *A = &Queue->Heap[First];
+	const AlarmQueue_Entry_t *B = &Queue->Heap[Second];
+
+	/* Difference Keeps The Order Across a Wrap of The Time Count */
+	int32_t Difference = (int32_t)(A->Deadline - B->Deadline);
+
+	return (Difference < 0) || ((0 == Difference) && (A->AlarmId < B->AlarmId));
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Swap
+ * @brief			:	Swap Two Heap Entries & Update Their Positions
+ * @param			:	Queue
+ * @param			:	Heap Index of First Entry
+ * @param			:	Heap Index of Second Entry
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmQueue_Swap(AlarmQueue_t *Queue, uint16_t First, uint16_t Second)
+{
+	AlarmQueue_Entry_t Temp = Queue->Heap[First];
+
+	Queue->Heap[First] = Queue->Heap[Second];
+	Queue->Heap[Second] = Temp;
+
+	Queue->Position[Queue->Heap[First].AlarmId] = First + 1u;
+	Queue->Position[Queue->Heap[Second].AlarmId] = Second + 1u;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmQueue_Restore
+ * @brief			:	Move an Entry Up or Down Till The Heap Order Holds Again
+ * @param			:	Queue
+ * @param			:	Heap Index of The Changed Entry
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmQueue_Restore(AlarmQueue_t *Queue, uint16_t Index)
+{
+	uint16_t Child = 0;
+
+	/* Earlier Than its Parent : Move Up */
+	while ((Index > 0u) && AlarmQueue_IsBefore(Queue, Index, ALARMQUEUE_PARENT(Index)))
+	{
+		AlarmQueue_Swap(Queue, Index, ALARMQUEUE_PARENT(Index));
+		Index = ALARMQUEUE_PARENT(Index);
+	}
+
+	/* Later Than a Child : Move Down Toward The Earlier Child */
+	Child = ALARMQUEUE_LEFT(Index);
+
+	while (Child < Queue->Size)
+	{
+		if (((Child + 1u) < Queue->Size) && AlarmQueue_IsBefore(Queue, Child + 1u, Child))
+		{
+			Child++;
+		}
+
+		if (AlarmQueue_IsBefore(Queue, Child, Index))
+		{
+			AlarmQueue_Swap(Queue, Index, Child);
+			Index = Child;
+			Child = ALARMQUEUE_LEFT(Index);
+		}
+		else
+		{
+			/* Heap Order Holds */
+			Child = Queue->Size;
+		}
+	}
+}
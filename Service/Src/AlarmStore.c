@@ -0,0 +1,310 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmStore.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Alarms Storage in The RTC Battery Backed RAM
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/I2C_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+#include "../../HAL/Inc/RTC_Interface.h"
+
+#include "../Inc/Recurrence.h"
+#include "../Inc/AlarmStore.h"
+#include "../Inc/AlarmStore_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* I2C Configurations of The RTC */
+static I2C_Configs_t *AlarmStore_I2C = NULL;
+
+/* Copy of The NVRAM Content , Used to Write Only The Changed Records */
+static uint8_t AlarmStore_Image[ALARMSTORE_IMAGE_SIZE] = {0};
+
+/* Set Once The Image Was Read Successfully , The Image Then Holds The NVRAM Content Or The Content to Write */
+static uint8_t AlarmStore_Read = 0;
+
+/* Set When The NVRAM Holds a Valid Header & All Records */
+static uint8_t AlarmStore_Formatted = 0;
+
+/* Bytes of an Empty Record , The CRC Byte is Not Used */
+static const uint8_t AlarmStore_EmptyRecord[ALARMSTORE_RECORD_SIZE] = {ALARMSTORE_EMPTY, ALARMSTORE_EMPTY, ALARMSTORE_EMPTY,
+																	   ALARMSTORE_EMPTY, ALARMSTORE_EMPTY, ALARMSTORE_EMPTY,
+																	   ALARMSTORE_EMPTY, ALARMSTORE_EMPTY};
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_Restore
+ * @brief			:	Read All Alarm Records in One Burst & Fill The Alarms Array With The Valid Ones
+ * @param			:	I2C Configurations of The RTC
+ * @param			:	Alarms Array to Fill ( ALARMSTORE_MAX_ALARMS ) , Corrupted or Empty Records Are Filled With
+ * 						( ALARMSTORE_EMPTY ) Bytes
+ * @param			:	Returns Number of Restored Alarms
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t AlarmStore_Restore(I2C_Configs_t *I2CConfig, AlarmStore_Record_t *Alarms, uint8_t *RestoredCount)
+{
+	Error_State_t Error_State = OK;
+
+	uint8_t Counter = 0;
+
+	if ((NULL == I2CConfig) || (NULL == Alarms) || (NULL == RestoredCount))
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		AlarmStore_I2C = I2CConfig;
+		*RestoredCount = 0;
+
+		Error_State = AlarmStore_ReadImage();
+
+		for (Counter = 0; Counter < ALARMSTORE_MAX_ALARMS; Counter++)
+		{
+			/* Records Left in The Image Passed The CRC & Alarm Checks , Empty Ones Fail The Alarm Check */
+			AlarmStore_DecodeRecord(&AlarmStore_Image[ALARMSTORE_RECORD_OFFSET(Counter)], &Alarms[Counter]);
+
+			if (AlarmStore_Formatted && AlarmStore_IsValidAlarm(&Alarms[Counter]))
+			{
+				(*RestoredCount)++;
+			}
+			else
+			{
+				AlarmStore_DecodeRecord(AlarmStore_EmptyRecord, &Alarms[Counter]);
+			}
+		}
+
+		if (AlarmStore_Read && !AlarmStore_Formatted)
+		{
+			/* First Boot or Lost Battery ( Read But No Valid Header ) , Write Header & Empty Records in One Burst */
+			AlarmStore_Image[ALARMSTORE_MAGIC_OFFSET] = ALARMSTORE_MAGIC;
+			AlarmStore_Image[ALARMSTORE_VERSION_OFFSET] = ALARMSTORE_VERSION;
+
+			Error_State = RTC_WriteNVRAM(I2CConfig, 0, AlarmStore_Image, ALARMSTORE_IMAGE_SIZE);
+
+			AlarmStore_Formatted = (OK == Error_State);
+		}
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_Save
+ * @brief			:	Write One Alarm Record to NVRAM , Only If it Differs From The Stored One
+ * @param			:	Alarm Index ( 0 - ALARMSTORE_MAX_ALARMS - 1 )
+ * @param			:	Alarm to Store , a Time of ( ALARMSTORE_EMPTY ) Bytes Clears it
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t AlarmStore_Save(uint8_t AlarmIndex, const AlarmStore_Record_t *Alarm)
+{
+	Error_State_t Error_State = OK;
+
+	uint8_t Record[ALARMSTORE_RECORD_SIZE];
+
+	uint8_t *Stored = NULL;
+
+	uint8_t Changed = 0;
+
+	uint8_t Counter = 0;
+
+	if ((NULL == Alarm) || (NULL == AlarmStore_I2C))
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (AlarmIndex >= ALARMSTORE_MAX_ALARMS)
+	{
+		Error_State = NOK;
+	}
+	else if ((!AlarmStore_Read) && (OK != AlarmStore_ReadImage()))
+	{
+		/* The Reading at Restore Failed & Failed Again , Writing Now Could Erase The Stored Alarms */
+		Error_State = NOK;
+	}
+	else
+	{
+		Stored = &AlarmStore_Image[ALARMSTORE_RECORD_OFFSET(AlarmIndex)];
+
+		AlarmStore_EncodeRecord(AlarmIndex, Alarm, Record);
+
+		for (Counter = 0; Counter < ALARMSTORE_RECORD_SIZE; Counter++)
+		{
+			Changed |= (Record[Counter] != Stored[Counter]);
+			Stored[Counter] = Record[Counter];
+		}
+
+		if (!AlarmStore_Formatted)
+		{
+			/* No Valid Header Was Read Or a Write Failed , The Image is What NVRAM Must Hold , Write it All */
+			AlarmStore_Image[ALARMSTORE_MAGIC_OFFSET] = ALARMSTORE_MAGIC;
+			AlarmStore_Image[ALARMSTORE_VERSION_OFFSET] = ALARMSTORE_VERSION;
+
+			Error_State = RTC_WriteNVRAM(AlarmStore_I2C, 0, AlarmStore_Image, ALARMSTORE_IMAGE_SIZE);
+
+			AlarmStore_Formatted = (OK == Error_State);
+		}
+		else if (Changed)
+		{
+			/* Only The Bytes of This Record */
+			Error_State = RTC_WriteNVRAM(AlarmStore_I2C, ALARMSTORE_RECORD_OFFSET(AlarmIndex), Record, ALARMSTORE_RECORD_SIZE);
+
+			if (OK != Error_State)
+			{
+				/* NVRAM Content is Unknown Now , Rewrite Everything Next Save */
+				AlarmStore_Formatted = 0;
+			}
+		}
+		else
+		{
+			/* Same Record is Already Stored */
+		}
+	}
+	return Error_State;
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_ReadImage
+ * @brief			:	Read The Header & All Records in One Burst , Records Not Holding a Valid Alarm Are Replaced in The
+ * 						Copy With Empty Ones
+ * @param			:	void
+ * @retval			:	Error State of The Reading
+ * ======================================================================================*/
+static Error_State_t AlarmStore_ReadImage(void)
+{
+	Error_State_t Error_State = OK;
+
+	uint8_t Record[ALARMSTORE_RECORD_SIZE];
+
+	AlarmStore_Record_t Alarm;
+
+	uint8_t *Stored = NULL;
+
+	uint8_t Counter = 0;
+
+	/* Header & All Records in One Burst */
+	Error_State = RTC_ReadNVRAM(AlarmStore_I2C, 0, AlarmStore_Image, ALARMSTORE_IMAGE_SIZE);
+
+	AlarmStore_Read = (OK == Error_State);
+
+	AlarmStore_Formatted = AlarmStore_Read &&
+						   (ALARMSTORE_MAGIC == AlarmStore_Image[ALARMSTORE_MAGIC_OFFSET]) &&
+						   (ALARMSTORE_VERSION == AlarmStore_Image[ALARMSTORE_VERSION_OFFSET]);
+
+	for (Counter = 0; (Counter < ALARMSTORE_MAX_ALARMS) && AlarmStore_Read; Counter++)
+	{
+		Stored = &AlarmStore_Image[ALARMSTORE_RECORD_OFFSET(Counter)];
+
+		/* Keep The Record Only If its CRC Matches & it Holds a Real Alarm */
+		AlarmStore_DecodeRecord(Stored, &Alarm);
+		AlarmStore_EncodeRecord(Counter, &Alarm, Record);
+
+		if (!(AlarmStore_Formatted && (Record[ALARMSTORE_CRC_INDEX] == Stored[ALARMSTORE_CRC_INDEX]) && AlarmStore_IsValidAlarm(&Alarm)))
+		{
+			/* Keep The Image Matching What Will be in NVRAM */
+			AlarmStore_DecodeRecord(AlarmStore_EmptyRecord, &Alarm);
+			AlarmStore_EncodeRecord(Counter, &Alarm, Stored);
+		}
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_CRC8
+ * @brief			:	CRC-8 of a Block of Bytes
+ * @param			:	Bytes
+ * @param			:	Number of Bytes
+ * @param			:	Initial CRC Value
+ * @retval			:	CRC
+ * ======================================================================================*/
+static uint8_t AlarmStore_CRC8(const uint8_t *Data, uint8_t Size, uint8_t CRC)
+{
+	uint8_t Counter1 = 0, Counter2 = 0;
+
+	for (Counter1 = 0; Counter1 < Size; Counter1++)
+	{
+		CRC ^= Data[Counter1];
+
+		for (Counter2 = 0; Counter2 < 8; Counter2++)
+		{
+			CRC = (CRC & 0x80u) ? (uint8_t)((CRC << 1) ^ ALARMSTORE_CRC_POLY) : (uint8_t)(CRC << 1);
+		}
+	}
+	return CRC;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_EncodeRecord
+ * @brief			:	Build The NVRAM Record of an Alarm
+ * @param			:	Alarm Index
+ * @param			:	Alarm
+ * @param			:	Record to Fill ( ALARMSTORE_RECORD_SIZE ) Bytes
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmStore_EncodeRecord(uint8_t AlarmIndex, const AlarmStore_Record_t *Alarm, uint8_t *Record)
+{
+	uint8_t CRC = 0;
+
+	Record[0] = Alarm->Time[0];
+	Record[1] = Alarm->Time[1];
+	Record[2] = Alarm->Time[2];
+	Record[ALARMSTORE_WEEKDAYS_INDEX] = Alarm->Weekdays;
+	Record[ALARMSTORE_INTERVAL_INDEX] = (uint8_t)(Alarm->IntervalMinutes & 0xFFu);
+	Record[ALARMSTORE_INTERVAL_INDEX + 1u] = (uint8_t)(Alarm->IntervalMinutes >> 8);
+	Record[ALARMSTORE_FLAGS_INDEX] = Alarm->Flags;
+
+	/* Index is Part of The CRC So a Record Found in Another Slot is Rejected */
+	CRC = AlarmStore_CRC8(&AlarmIndex, 1, 0);
+	CRC = AlarmStore_CRC8(Record, ALARMSTORE_CRC_INDEX, CRC);
+
+	Record[ALARMSTORE_CRC_INDEX] = CRC;
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_DecodeRecord
+ * @brief			:	Get The Alarm Held in an NVRAM Record , The CRC is Not Checked
+ * @param			:	Record ( ALARMSTORE_RECORD_SIZE ) Bytes
+ * @param			:	Alarm to Fill
+ * @retval			:	void
+ * ======================================================================================*/
+static void AlarmStore_DecodeRecord(const uint8_t *Record, AlarmStore_Record_t *Alarm)
+{
+	Alarm->Time[0] = Record[0];
+	Alarm->Time[1] = Record[1];
+	Alarm->Time[2] = Record[2];
+	Alarm->Weekdays = Record[ALARMSTORE_WEEKDAYS_INDEX];
+	Alarm->IntervalMinutes = (uint16_t)(Record[ALARMSTORE_INTERVAL_INDEX] | (Record[ALARMSTORE_INTERVAL_INDEX + 1u] << 8));
+	Alarm->Flags = Record[ALARMSTORE_FLAGS_INDEX];
+}
+
+/*=======================================================================================
+ * @fn		 		:	AlarmStore_IsValidAlarm
+ * @brief			:	Check That an Alarm Read From NVRAM Holds a Real Time of Day & a Rule That Can Match
+ * @param			:	Alarm
+ * @retval			:	1 If Valid , 0 If Not
+ * ======================================================================================*/
+static uint8_t AlarmStore_IsValidAlarm(const AlarmStore_Record_t *Alarm)
+{
+	return (Alarm->Time[0] <= ALARMSTORE_MAX_HOURS) && (Alarm->Time[1] <= ALARMSTORE_MAX_MINUTES) &&
+		   (Alarm->Time[2] <= ALARMSTORE_MAX_SECONDS) && (0u != Alarm->Weekdays) &&
+		   (Alarm->Weekdays <= ALARMSTORE_MAX_WEEKDAYS) && (Alarm->IntervalMinutes <= ALARMSTORE_MAX_INTERVAL);
+}
@@ -0,0 +1,183 @@
+/*
+ ******************************************************************************
+ * @file           : Calendar.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Epoch Seconds & Calendar Arithmetic
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+
+#include "../../Drivers/Inc/I2C_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+
+#include "../Inc/Calendar.h"
+#include "../Inc/Calendar_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Number of Days in Each Month of a Common Year ( Index 0 Not Used ) */
+static const uint8_t Calendar_MonthDays[CALENDAR_MAX_MONTH + 1u] = {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_ToEpoch
+ * @brief			:	Convert Date & Time to Seconds Since 01 / 01 / 1970 00:00:00 ( Unix Epoch )
+ * @param			:	Date & Time , Year is ( 2000 + Year ) , Day of Week is Not Used
+ * @retval			:	Epoch Seconds
+ * ======================================================================================*/
+uint32_t Calendar_ToEpoch(const DS1307_Config_t *Time)
+{
+	uint32_t Days = Calendar_DaysFromCivil(CALENDAR_BASE_YEAR + Time->Year, Time->Month, Time->Date);
+
+	return (Days * CALENDAR_SECONDS_PER_DAY) + (Time->Hours * CALENDAR_SECONDS_PER_HOUR) +
+		   (Time->Minutes * CALENDAR_SECONDS_PER_MINUTE) + Time->Seconds;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_FromEpoch
+ * @brief			:	Convert Seconds Since The Unix Epoch to Date & Time Including Day of Week
+ * @param			:	Epoch Seconds ( 2000 - 2099 )
+ * @param			:	Structure to Fill
+ * @retval			:	void
+ * ======================================================================================*/
+void Calendar_FromEpoch(uint32_t Epoch, DS1307_Config_t *Time)
+{
+	uint32_t Days = Epoch / CALENDAR_SECONDS_PER_DAY;
+	uint32_t Seconds = Epoch % CALENDAR_SECONDS_PER_DAY;
+
+	/* Civil From Days : Years Start at 1st of March So The Leap Day is The Last Day of The Year */
+	uint32_t Shifted = Days + CALENDAR_EPOCH_DAYS;
+	uint32_t Era = Shifted / CALENDAR_DAYS_PER_ERA;
+	uint32_t DayOfEra = Shifted - (Era * CALENDAR_DAYS_PER_ERA);
+	uint32_t YearOfEra = (DayOfEra - (DayOfEra / 1460u) + (DayOfEra / 36524u) - (DayOfEra / 146096u)) / 365u;
+	uint32_t DayOfYear = DayOfEra - ((365u * YearOfEra) + (YearOfEra / 4u) - (YearOfEra / 100u));
+	uint32_t MonthFromMarch = ((5u * DayOfYear) + 2u) / 153u;
+	uint32_t Month = (MonthFromMarch < 10u) ? (MonthFromMarch + 3u) : (MonthFromMarch - 9u);
+	uint32_t Year = YearOfEra + (Era * CALENDAR_YEARS_PER_ERA) + ((Month <= 2u) ? 1u : 0u);
+
+	Time->Date = (uint8_t)(DayOfYear - (((153u * MonthFromMarch) + 2u) / 5u) + 1u);
+	Time->Month = (uint8_t)Month;
+	Time->Year = (uint8_t)(Year - CALENDAR_BASE_YEAR);
+
+	Time->Hours = (uint8_t)(Seconds / CALENDAR_SECONDS_PER_HOUR);
+	Time->Minutes = (uint8_t)((Seconds % CALENDAR_SECONDS_PER_HOUR) / CALENDAR_SECONDS_PER_MINUTE);
+	Time->Seconds = (uint8_t)(Seconds % CALENDAR_SECONDS_PER_MINUTE);
+
+	Time->Day = (DS1307_DAYS_t)(((Days + CALENDAR_EPOCH_WEEKDAY) % CALENDAR_DAYS_PER_WEEK) + DS1307_SUNDAY);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_DayOfWeek
+ * @brief			:	Day of Week of a Date
+ * @param			:	Date ( 1 - 31 )
+ * @param			:	Month ( 1 - 12 )
+ * @param			:	Year ( 0 - 99 )
+ * @retval			:	Day of Week ( DS1307_SUNDAY - DS1307_SATURDAY )
+ * ======================================================================================*/
+DS1307_DAYS_t Calendar_DayOfWeek(uint8_t Date, uint8_t Month, uint8_t Year)
+{
+	uint32_t Days = Calendar_DaysFromCivil(CALENDAR_BASE_YEAR + Year, Month, Date);
+
+	return (DS1307_DAYS_t)(((Days + CALENDAR_EPOCH_WEEKDAY) % CALENDAR_DAYS_PER_WEEK) + DS1307_SUNDAY);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_DaysInMonth
+ * @brief			:	Number of Days in a Month , February Has 29 Days in Leap Years
+ * @param			:	Month ( 1 - 12 )
+ * @param			:	Year ( 0 - 99 )
+ * @retval			:	Days , 0 If The Month is Not Valid
+ * ======================================================================================*/
+uint8_t Calendar_DaysInMonth(uint8_t Month, uint8_t Year)
+{
+	uint8_t Days = 0;
+
+	if ((Month >= 1u) && (Month <= CALENDAR_MAX_MONTH))
+	{
+		Days = Calendar_MonthDays[Month];
+
+		if ((CALENDAR_FEBRUARY == Month) && CALENDAR_IS_LEAP(CALENDAR_BASE_YEAR + Year))
+		{
+			Days++;
+		}
+	}
+	return Days;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_AddSeconds
+ * @brief			:	Move Date & Time Forward or Backward
+ * @param			:	Date & Time to Change , Day of Week is Updated
+ * @param			:	Seconds to Add ( Negative to Subtract )
+ * @retval			:	void
+ * ======================================================================================*/
+void Calendar_AddSeconds(DS1307_Config_t *Time, int32_t Seconds)
+{
+	Calendar_FromEpoch((uint32_t)((int32_t)Calendar_ToEpoch(Time) + Seconds), Time);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_Diff
+ * @brief			:	Seconds From One Date & Time to Another
+ * @param			:	Later Date & Time
+ * @param			:	Earlier Date & Time
+ * @retval			:	( Later - Earlier ) in Seconds , Negative If Later is Before Earlier
+ * ======================================================================================*/
+int32_t Calendar_Diff(const DS1307_Config_t *Later, const DS1307_Config_t *Earlier)
+{
+	return (int32_t)(Calendar_ToEpoch(Later) - Calendar_ToEpoch(Earlier));
+}
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_Compare
+ * @brief			:	Order of Two Dates & Times
+ * @param			:	First Date & Time
+ * @param			:	Second Date & Time
+ * @retval			:	-1 If First is Before , 0 If Equal , 1 If First is After
+ * ======================================================================================*/
+int8_t Calendar_Compare(const DS1307_Config_t *First, const DS1307_Config_t *Second)
+{
+	uint32_t FirstEpoch = Calendar_ToEpoch(First);
+	uint32_t SecondEpoch = Calendar_ToEpoch(Second);
+
+	return (int8_t)((FirstEpoch > SecondEpoch) - (FirstEpoch < SecondEpoch));
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Calendar_DaysFromCivil
+ * @brief			:	Days Since The Unix Epoch of a Date
+ * @param			:	Full Year ( 1970 and Later )
+ * @param			:	Month ( 1 - 12 )
+ * @param			:	Date ( 1 - 31 )
+ * @retval			:	Days
+ * ======================================================================================*/
+static uint32_t Calendar_DaysFromCivil(uint32_t Year, uint32_t Month, uint32_t Date)
+{
+	/* January & February Belong to The Previous Year Starting From March */
+	uint32_t ShiftedYear = Year - ((Month <= 2u) ? 1u : 0u);
+	uint32_t Era = ShiftedYear / CALENDAR_YEARS_PER_ERA;
+	uint32_t YearOfEra = ShiftedYear - (Era * CALENDAR_YEARS_PER_ERA);
+	uint32_t MonthFromMarch = (Month > 2u) ? (Month - 3u) : (Month + 9u);
+	uint32_t DayOfYear = (((153u * MonthFromMarch) + 2u) / 5u) + Date - 1u;
+	uint32_t DayOfEra = (YearOfEra * 365u) + (YearOfEra / 4u) - (YearOfEra / 100u) + DayOfYear;
+
+	return (Era * CALENDAR_DAYS_PER_ERA) + DayOfEra - CALENDAR_EPOCH_DAYS;
+}
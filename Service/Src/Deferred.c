@@ -0,0 +1,118 @@
+/*
+ ******************************************************************************
+ * @file           : Deferred.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Work Deferred From Interrupts to PendSV
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/SCB_Interface.h"
+
+#include "../Inc/Deferred.h"
+#include "../Inc/Deferred_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+static Deferred_Item_t Deferred_Queue[DEFERRED_QUEUE_SIZE];
+
+/* Free Running Indexes , Their Difference is The Number of Waiting Works */
+static volatile uint8_t Deferred_Head = 0;
+static volatile uint8_t Deferred_Tail = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Deferred_Init
+ * @brief			:	Empty The Work Queue & Set The PendSV Handler With The Lowest Priority
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void Deferred_Init(void)
+{
+	Deferred_Head = 0;
+	Deferred_Tail = 0;
+
+	SCB_u8SetHandler(PENDSV_HANDLER, &Deferred_Run);
+	SCB_VoidSetCorePriority(PENDSV_FAULT, DEFERRED_PRIORITY);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Deferred_Post
+ * @brief			:	Queue a Work to Run From PendSV After All Active Interrupts Return
+ * @param			:	Work Function
+ * @param			:	Argument Passed to The Work
+ * @retval			:	Error State ( NOK If The Queue is Full , The Work is Dropped )
+ * ======================================================================================*/
+Error_State_t Deferred_Post(void (*Work)(uint32_t Arg), uint32_t Arg)
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t PriMask = 0;
+
+	if (NULL == Work)
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		/* Interrupts of Any Priority May Post */
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		if ((uint8_t)(Deferred_Head - Deferred_Tail) >= DEFERRED_QUEUE_SIZE)
+		{
+			Error_State = NOK;
+		}
+		else
+		{
+			Deferred_Queue[Deferred_Head & DEFERRED_INDEX_MASK].Work = Work;
+			Deferred_Queue[Deferred_Head & DEFERRED_INDEX_MASK].Arg = Arg;
+			Deferred_Head++;
+		}
+
+		EXIT_CRITICAL_SECTION(PriMask);
+
+		if (OK == Error_State)
+		{
+			SCB_VoidSetPendSV();
+		}
+	}
+	return Error_State;
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Deferred_Run
+ * @brief			:	PendSV Call Back , Run Posted Works Till The Queue is Empty
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void Deferred_Run(void)
+{
+	Deferred_Item_t Item;
+
+	/* Only PendSV Takes Works , The Tail Needs No Lock */
+	while (Deferred_Tail != Deferred_Head)
+	{
+		Item = Deferred_Queue[Deferred_Tail & DEFERRED_INDEX_MASK];
+		Deferred_Tail++;
+
+		Item.Work(Item.Arg);
+	}
+}
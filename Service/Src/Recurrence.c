@@ -0,0 +1,175 @@
+/*
+ ******************************************************************************
+ * @file           : Recurrence.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Alarm Recurrence Rules
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/I2C_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+
+#include "../Inc/Calendar.h"
+#include "../Inc/Recurrence.h"
+#include "../Inc/Recurrence_Private.h"
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Recurrence_SetDaily
+ * @brief			:	Set a Rule Matching Every Day Once
+ * @param			:	Rule to Set
+ * @retval			:	void
+ * ======================================================================================*/
+void Recurrence_SetDaily(Recurrence_Rule_t *Rule)
+{
+	if (NULL != Rule)
+	{
+		Rule->MonthDays = RECURRENCE_ALL_MONTHDAYS;
+		Rule->Months = RECURRENCE_ALL_MONTHS;
+		Rule->IntervalMinutes = 0;
+		Rule->Weekdays = RECURRENCE_ALL_WEEKDAYS;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Recurrence_Next
+ * @brief			:	First Occurrence of a Rule After a Time
+ * @param			:	Rule
+ * @param			:	Alarm Time as Second of The Day
+ * @param			:	Time to Search After in Epoch Seconds , an Occurrence at This Second is Not Returned
+ * @param			:	Returns The Occurrence in Epoch Seconds
+ * @retval			:	Error State ( NOK If The Rule Never Matches Before The End of 2099 )
+ * ======================================================================================*/
+Error_State_t Recurrence_Next(const Recurrence_Rule_t *Rule, uint32_t SecondOfDay, uint32_t After, uint32_t *Next)
+{
+	Error_State_t Error_State = OK;
+
+	DS1307_Config_t Day;
+
+	uint32_t Matches = 0, Candidate = CALENDAR_SECONDS_PER_DAY, Step = 0, Now = 0;
+
+	uint8_t Month = 0, Year = 0, FirstDate = 0;
+
+	if ((NULL == Rule) || (NULL == Next))
+	{
+		Error_State = Null_Pointer;
+	}
+	else if ((SecondOfDay >= CALENDAR_SECONDS_PER_DAY) || (Rule->IntervalMinutes > RECURRENCE_MAX_INTERVAL))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		Calendar_FromEpoch(After, &Day);
+
+		Now = After % CALENDAR_SECONDS_PER_DAY;
+
+		/* Today : The Alarm Time or The First Interval Step After Now */
+		if (Recurrence_MonthMatches(Rule, Day.Month, Day.Year) & RECURRENCE_MONTHDAY(Day.Date))
+		{
+			if (Now < SecondOfDay)
+			{
+				Candidate = SecondOfDay;
+			}
+			else if (0u != Rule->IntervalMinutes)
+			{
+				Step = (uint32_t)Rule->IntervalMinutes * CALENDAR_SECONDS_PER_MINUTE;
+
+				Candidate = SecondOfDay + ((((Now - SecondOfDay) / Step) + 1u) * Step);
+			}
+		}
+
+		if (Candidate < CALENDAR_SECONDS_PER_DAY)
+		{
+			*Next = (After - Now) + Candidate;
+		}
+		else
+		{
+			/* A Later Day : Whole Months Are Checked at Once Starting After Today */
+			Month = Day.Month;
+			Year = Day.Year;
+			FirstDate = Day.Date + 1u;
+
+			while ((0u == Matches) && (Year <= RECURRENCE_MAX_YEAR))
+			{
+				Matches = Recurrence_MonthMatches(Rule, Month, Year) & ~RECURRENCE_BEFORE_MASK(FirstDate);
+
+				if (0u == Matches)
+				{
+					FirstDate = 1;
+					Month++;
+
+					if (Month > RECURRENCE_MAX_MONTH)
+					{
+						Month = 1;
+						Year++;
+					}
+				}
+			}
+
+			if (0u == Matches)
+			{
+				Error_State = NOK;
+			}
+			else
+			{
+				/* The Lowest Set Bit is The Nearest Date */
+				Day.Date = (uint8_t)__builtin_ctz(Matches) + 1u;
+				Day.Month = Month;
+				Day.Year = Year;
+				Day.Hours = 0;
+				Day.Minutes = 0;
+				Day.Seconds = 0;
+
+				*Next = Calendar_ToEpoch(&Day) + SecondOfDay;
+			}
+		}
+	}
+	return Error_State;
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Recurrence_MonthMatches
+ * @brief			:	Dates of a Month Matching a Rule
+ * @param			:	Rule
+ * @param			:	Month ( 1 - 12 )
+ * @param			:	Year ( 0 - 99 )
+ * @retval			:	Mask of Matching Dates , Bit ( Date - 1 )
+ * ======================================================================================*/
+static uint32_t Recurrence_MonthMatches(const Recurrence_Rule_t *Rule, uint8_t Month, uint8_t Year)
+{
+	uint32_t Matches = 0, Weekdays = 0;
+
+	uint8_t FirstWeekday = 0;
+
+	if (Rule->Months & RECURRENCE_MONTH(Month))
+	{
+		/* Rotate The Week Mask So Bit 0 is The Day of Week of The 1st , Then Repeat it Over The Month */
+		FirstWeekday = (uint8_t)(Calendar_DayOfWeek(1, Month, Year) - DS1307_SUNDAY);
+
+		Weekdays = Rule->Weekdays & RECURRENCE_ALL_WEEKDAYS;
+		Weekdays = ((Weekdays >> FirstWeekday) | (Weekdays << (RECURRENCE_DAYS_PER_WEEK - FirstWeekday))) & RECURRENCE_ALL_WEEKDAYS;
+
+		Matches = (Weekdays * RECURRENCE_WEEK_REPEAT) & Rule->MonthDays & RECURRENCE_DAYS_MASK(Calendar_DaysInMonth(Month, Year));
+	}
+
+	return Matches;
+}
@@ -0,0 +1,118 @@
+/*
+ ******************************************************************************
+ * @file           : RtcHealth.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : RTC Oscillator & Registers Health Monitoring
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/I2C_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+#include "../../HAL/Inc/RTC_Interface.h"
+
+#include "../Inc/RtcHealth.h"
+#include "../Inc/RtcHealth_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Set When The RTC Lost its Time , Cleared When The Time is Set */
+static volatile uint8_t RtcHealth_Stale = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	RtcHealth_Check
+ * @brief			:	Read The RTC Registers , Restart a Halted Oscillator & Replace Invalid Registers
+ * @param			:	I2C Configurations of The RTC
+ * @param			:	Time to Write If The RTC Time is Lost , NULL to Restart From The Halted Registers
+ * 						or From ( 01 / 01 / 2000 00:00:00 ) If They Are Invalid
+ * @param			:	Returns Health Status Flags
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t RtcHealth_Check(I2C_Configs_t *I2CConfig, const DS1307_Config_t *Fallback, uint8_t *Status)
+{
+	Error_State_t Error_State = OK;
+
+	DS1307_Config_t Default = {0};
+
+	if ((NULL == I2CConfig) || (NULL == Status))
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		/* Oscillator Stop Indication & Register Check of The Probed Chip */
+		Error_State = RTC_GetHealth(I2CConfig, Status);
+
+		if (OK == Error_State)
+		{
+			if (*Status & RTCHEALTH_HALTED)
+			{
+				/* Time Did Not Advance While Stopped */
+				RtcHealth_Stale = 1;
+			}
+
+			if (RTCHEALTH_OK != *Status)
+			{
+				if (NULL != Fallback)
+				{
+					/* Full Write Also Restarts The Oscillator */
+					Error_State = RTC_WriteDateTime(I2CConfig, Fallback);
+				}
+				else if (*Status & RTCHEALTH_INVALID)
+				{
+					Default.Day = RTCHEALTH_DEFAULT_DAY;
+					Default.Date = RTCHEALTH_DEFAULT_DATE;
+					Default.Month = RTCHEALTH_DEFAULT_MONTH;
+					Default.Year = RTCHEALTH_DEFAULT_YEAR;
+
+					RtcHealth_Stale = 1;
+
+					Error_State = RTC_WriteDateTime(I2CConfig, &Default);
+				}
+				else
+				{
+					Error_State = RTC_StartOscillator(I2CConfig);
+				}
+			}
+		}
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	RtcHealth_IsTimeStale
+ * @brief			:	Check If The RTC Time Was Lost & Not Set Since
+ * @param			:	void
+ * @retval			:	1 If Stale , 0 If Not
+ * ======================================================================================*/
+uint8_t RtcHealth_IsTimeStale(void)
+{
+	return RtcHealth_Stale;
+}
+
+/*=======================================================================================
+ * @fn		 		:	RtcHealth_ClearStale
+ * @brief			:	Mark The RTC Time as Correct , Called When The Time is Set
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void RtcHealth_ClearStale(void)
+{
+	RtcHealth_Stale = 0;
+}
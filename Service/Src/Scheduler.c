@@ -0,0 +1,304 @@
+/*
+ ******************************************************************************
+ * @file           : Scheduler.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Run to Completion Event Scheduler
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../Inc/TimeBase.h"
+#include "../Inc/Scheduler.h"
+#include "../Inc/Scheduler_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+static volatile Scheduler_Queue_t Scheduler_Queues[SCHEDULER_EVENTS];
+
+static volatile Scheduler_Stats_t Scheduler_Stats[SCHEDULER_EVENTS];
+
+/* Bit of Each Event Whose Task is Running , Set Bits Are Only Left by Tasks That Yield */
+static uint8_t Scheduler_Running = 0;
+
+/* Time in us Spent in Scheduler_Yield Since The Running Task Started , Taken Out of its Run Time */
+static uint32_t Scheduler_Yielded = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Init
+ * @brief			:	Remove All Tasks , Empty The Queues & Clear The Statistics
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void Scheduler_Init(void)
+{
+	uint32_t PriMask = 0;
+
+	uint8_t Event = 0;
+
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	for (Event = 0; Event < SCHEDULER_EVENTS; Event++)
+	{
+		Scheduler_Queues[Event].Task = NULL;
+		Scheduler_Queues[Event].Head = 0;
+		Scheduler_Queues[Event].Tail = 0;
+
+		Scheduler_Stats[Event].Runs = 0;
+		Scheduler_Stats[Event].Dropped = 0;
+		Scheduler_Stats[Event].LastTime = 0;
+		Scheduler_Stats[Event].MaxTime = 0;
+		Scheduler_Stats[Event].TotalTime = 0;
+		Scheduler_Stats[Event].MaxDepth = 0;
+	}
+
+	Scheduler_Running = 0;
+	Scheduler_Yielded = 0;
+
+	EXIT_CRITICAL_SECTION(PriMask);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_SetTask
+ * @brief			:	Set The Task Run For Each Event Posted
+ * @param			:	Event ( 0 - SCHEDULER_EVENTS - 1 )
+ * @param			:	Task , Called From Thread Mode With The Posted Argument , NULL Stops Accepting The Event
+ * @retval			:	Error State ( NOK If The Event is Out of Range )
+ * ======================================================================================*/
+Error_State_t Scheduler_SetTask(uint8_t Event, void (*Task)(uint32_t Arg))
+{
+	Error_State_t Error_State = OK;
+
+	if (Event >= SCHEDULER_EVENTS)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		Scheduler_Queues[Event].Task = Task;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Post
+ * @brief			:	Queue an Event For its Task
+ * @param			:	Event
+ * @param			:	Argument Passed to The Task
+ * @retval			:	Error State ( NOK If The Event Has No Task or its Queue is Full , The Event is Dropped )
+ * ======================================================================================*/
+Error_State_t Scheduler_Post(uint8_t Event, uint32_t Arg)
+{
+	Error_State_t Error_State = OK;
+
+	volatile Scheduler_Queue_t *Queue = NULL;
+
+	uint32_t PriMask = 0;
+
+	uint8_t Depth = 0;
+
+	if ((Event >= SCHEDULER_EVENTS) || (NULL == Scheduler_Queues[Event].Task))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		Queue = &Scheduler_Queues[Event];
+
+		/* Interrupts of Any Priority May Post */
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		Depth = (uint8_t)(Queue->Head - Queue->Tail);
+
+		if (Depth >= SCHEDULER_QUEUE_SIZE)
+		{
+			Scheduler_Stats[Event].Dropped++;
+			Error_State = NOK;
+		}
+		else
+		{
+			Queue->Args[Queue->Head & SCHEDULER_INDEX_MASK] = Arg;
+			Queue->Head++;
+
+			if (Depth >= Scheduler_Stats[Event].MaxDepth)
+			{
+				Scheduler_Stats[Event].MaxDepth = Depth + 1u;
+			}
+		}
+
+		EXIT_CRITICAL_SECTION(PriMask);
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Yield
+ * @brief			:	Run The Highest Priority Waiting Event , or Sleep Till The Next Interrupt If None is Waiting
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void Scheduler_Yield(void)
+{
+	uint64_t Start = TimeBase_Micros();
+
+	uint32_t PriMask = 0, Arg = 0;
+
+	uint8_t Event = SCHEDULER_NO_EVENT;
+
+	/* An Event Posted Between The Check & The Sleep Still Wakes The Core */
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	Event = Scheduler_Take(&Arg);
+
+	if (SCHEDULER_NO_EVENT == Event)
+	{
+		SCHEDULER_WAIT_FOR_INTERRUPT();
+	}
+
+	EXIT_CRITICAL_SECTION(PriMask);
+
+	if (SCHEDULER_NO_EVENT != Event)
+	{
+		Scheduler_Dispatch(Event, Arg);
+	}
+
+	Scheduler_Yielded += (uint32_t)(TimeBase_Micros() - Start);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Run
+ * @brief			:	Run The Posted Events Forever
+ * @param			:	void
+ * @retval			:	Never Returns
+ * ======================================================================================*/
+void Scheduler_Run(void)
+{
+	while (1)
+	{
+		Scheduler_Yield();
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_GetStats
+ * @brief			:	Read The Statistics of an Event & its Task
+ * @param			:	Event
+ * @param			:	Returns Statistics
+ * @retval			:	Error State ( NOK If The Event is Out of Range )
+ * ======================================================================================*/
+Error_State_t Scheduler_GetStats(uint8_t Event, Scheduler_Stats_t *Stats)
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t PriMask = 0;
+
+	if (NULL == Stats)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (Event >= SCHEDULER_EVENTS)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		/* One Consistent Copy , Posts From Interrupts Change The Counts */
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		*Stats = Scheduler_Stats[Event];
+		Stats->Depth = (uint8_t)(Scheduler_Queues[Event].Head - Scheduler_Queues[Event].Tail);
+
+		EXIT_CRITICAL_SECTION(PriMask);
+	}
+	return Error_State;
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Take
+ * @brief			:	Remove The Highest Priority Waiting Event Whose Task is Not Yielding
+ * @param			:	Returns The Event Argument
+ * @retval			:	Event , SCHEDULER_NO_EVENT If None Can Run
+ * ======================================================================================*/
+static uint8_t Scheduler_Take(uint32_t *Arg)
+{
+	volatile Scheduler_Queue_t *Queue = NULL;
+
+	uint8_t Event = 0, Taken = SCHEDULER_NO_EVENT;
+
+	for (Event = 0; (Event < SCHEDULER_EVENTS) && (SCHEDULER_NO_EVENT == Taken); Event++)
+	{
+		Queue = &Scheduler_Queues[Event];
+
+		if ((Queue->Head != Queue->Tail) && !(Scheduler_Running & (1u << Event)))
+		{
+			*Arg = Queue->Args[Queue->Tail & SCHEDULER_INDEX_MASK];
+			Queue->Tail++;
+
+			Taken = Event;
+		}
+	}
+	return Taken;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Scheduler_Dispatch
+ * @brief			:	Run The Task of an Event & Update its Statistics
+ * @param			:	Event
+ * @param			:	Event Argument
+ * @retval			:	void
+ * ======================================================================================*/
+static void Scheduler_Dispatch(uint8_t Event, uint32_t Arg)
+{
+	void (*Task)(uint32_t Arg) = Scheduler_Queues[Event].Task;
+
+	volatile Scheduler_Stats_t *Stats = &Scheduler_Stats[Event];
+
+	/* Yield Time of The Task That Yielded to This One */
+	uint32_t Outer = Scheduler_Yielded, Time = 0;
+
+	uint64_t Start = 0;
+
+	/* The Task Was Removed After The Event Was Posted */
+	if (NULL != Task)
+	{
+		Scheduler_Running |= (1u << Event);
+		Scheduler_Yielded = 0;
+
+		Start = TimeBase_Micros();
+
+		Task(Arg);
+
+		Time = (uint32_t)(TimeBase_Micros() - Start) - Scheduler_Yielded;
+
+		Scheduler_Running &= ~(1u << Event);
+
+		Stats->Runs++;
+		Stats->LastTime = Time;
+		Stats->TotalTime += Time;
+
+		if (Time > Stats->MaxTime)
+		{
+			Stats->MaxTime = Time;
+		}
+	}
+
+	Scheduler_Yielded = Outer;
+}
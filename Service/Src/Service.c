@@ -35,10 +35,49 @@
 #include "../../Drivers/Inc/SYSTICK_Interface.h"
 
 #include "../../HAL/Inc/DS1307_Interface.h"
+#include "../../HAL/Inc/RTC_Interface.h"
 
 #include "../Inc/Service.h"
+#include "../Inc/SoftClock.h"
+#include "../Inc/RtcHealth.h"
+#include "../Inc/AlarmStore.h"
+#include "../Inc/Calendar.h"
+#include "../Inc/AlarmQueue.h"
+#include "../Inc/Recurrence.h"
+#include "../Inc/AlarmPool.h"
+#include "../Inc/StringArena.h"
+#include "../Inc/AlarmBell.h"
+#include "../Inc/TimeBase.h"
+#include "../Inc/Timers.h"
+#include "../Inc/Scheduler.h"
 #include "../Inc/Service_Private.h"
 
+/* Every Alarm Id Must Fit The Alarm Queue */
+#if ALARMPOOL_MAX_ALARMS > ALARMQUEUE_MAX_ALARMS
+#error "ALARMQUEUE_MAX_ALARMS Must Not be Less Than ALARMPOOL_MAX_ALARMS"
+#endif
+
+/* The Alarm Number Is Two Bytes Of The Alarm Frame & The Longest Name Fills The Rest */
+#if ALARMPOOL_MAX_ALARMS > 0xFFFFu
+#error "ALARMPOOL_MAX_ALARMS Must Fit The Alarm Number Of The Alarm Frame"
+#endif
+
+#if (ALARM_FRAME_NAME_POS + ALARMPOOL_NAME_MAX) > ALARM_FRAME_SIZE
+#error "ALARMPOOL_NAME_MAX Must Fit The Alarm Frame"
+#endif
+
+#if TIMERS_COUNTDOWNS > 32
+#error "CountdownsDone Holds One Bit For Each Countdown"
+#endif
+
+#if ALARMSTORE_MAX_ALARMS > 8
+#error "AlarmsToSave Holds One Bit For Each Saved Alarm"
+#endif
+
+#if (ALARM_FRAME_SIZE > SPI_FRAME_MAX_SIZE) || (TIMER_FRAME_SIZE > SPI_FRAME_MAX_SIZE) || (DISPLAY_FRAME_SIZE > SPI_FRAME_MAX_SIZE)
+#error "SPI_FRAME_MAX_SIZE Must Hold Every Frame Kind"
+#endif
+
 /* ========================================================================= *
  *                        GLOBAL VARIABLES SECTION                           *
  * ========================================================================= */
@@ -67,16 +106,65 @@ SPI_CONFIGS_t *SPI_CONFIG;
 I2C_Configs_t *I2C_CONFIG;
 
 /* Variable to Put Date & Time Configuration in IT to Be Used in Displaying Date & Time */
-DS1307_Config_t *ReadingStruct;
+DS1307_Config_t ReadingStruct;
+
+/* Deadlines Of All Alarm Ids In Epoch Seconds , The Nearest Is Armed On The RTC Or The Soft Clock */
+ALARMQUEUE_DEFINE(AlarmDeadlines, ALARMQUEUE_MAX_ALARMS);
+
+/* Set When The RTC INT Pin Is Routed To EXTI */
+static uint8_t HwAlarmLineEnabled = 0;
+
+/* Hours Format Of The RTC , The Alarm Hours Are Written In The Same Format To Match */
+static DS1307_HOUR_MODE_t HwAlarmMode = DS1307_24H_MODE;
+
+/* Time Of The Last Alarm Work , Snoozes Are Counted From It Without Reading The Clock */
+static uint32_t AlarmsNow = 0;
+
+/* Bell Pulses Of The Queued Alarm Frame & Of The Alarm Frame Being Sent */
+static uint8_t AlarmBeepsQueued = 1;
+static volatile uint8_t AlarmBeeps = 1;
+
+/* Bit Of Each Countdown That Ended & Was Not Started Again */
+static volatile uint32_t CountdownsDone = 0;
+
+/* Size Of Each Frame Kind , Indexed By SPI_FRAME_xxx */
+static const uint8_t SpiFrameSize[SPI_FRAMES] = {ALARM_FRAME_SIZE, TIMER_FRAME_SIZE, DISPLAY_FRAME_SIZE, DISPLAY_FRAME_SIZE};
+
+/* Latest Frame Of Each Kind Waiting For The SPI , Copied Only With Interrupts Masked */
+static uint8_t SpiFrameQueued[SPI_FRAMES][SPI_FRAME_MAX_SIZE];
+
+/* Frame Being Sent , Written Only While The SPI Is Free */
+static uint8_t SpiFrameSent[SPI_FRAME_MAX_SIZE];
+
+/* Bit Of Each Frame Kind Waiting For The SPI & The Kind Being Sent , a Newer Frame Of a Waiting Kind Replaces it */
+static volatile uint8_t SpiPending = 0;
+static volatile uint8_t SpiSending = SPI_FRAME_NONE;
 
-/* Alarm Time Array  */
-uint8_t AlarmTime[5][3] = Filling;
+/* Set Once The Date & Time Is Displayed , The LCD Time Is Refreshed Every Second After */
+static uint8_t DisplayRefresh = 0;
 
-/* Alarm Name Array */
-uint8_t AlarmName[30] = {0};
+/* Seconds Left Before The Time Refresh Replaces an Alarm Or Timer Frame On The LCD */
+static volatile uint8_t DisplayHold = 0;
 
-/* Counter To Store The Alarm Name Length */
-uint8_t AlarmNameCounter = 0;
+/* Bit Of Each Alarm Changed From The Console & Not Yet Written To The NVRAM */
+static volatile uint8_t AlarmsToSave = 0;
+
+/* Seconds Since The Last RTC Health Check */
+static uint8_t RtcCheckSeconds = 0;
+
+/* Console Input Written By The USART2 Interrupt , Free Running Indexes */
+static volatile uint8_t ConsoleBuffer[CONSOLE_BUFFER_SIZE];
+static volatile uint8_t ConsoleHead = 0;
+static volatile uint8_t ConsoleTail = 0;
+
+/* Set While a Console Event Is Queued , Bytes Typed Meanwhile Are Read By The Same Run */
+static volatile uint8_t ConsolePosted = 0;
+
+/* Set While an I2C Recovery Event Is Queued */
+static volatile uint8_t I2CRecoveryPosted = 0;
+
+/* Application Function Handling One Console Command */
+static void (*ConsoleHandler)(void) = NULL;
 
 /* ========================================================================= *
  *                    FUNCTIONS IMPLEMENTATION SECTION                       *
@@ -101,10 +189,10 @@ void WRONG_OptionChoosen(void)
 	SendNew_Line();
 
 	/* Notify User to Enter a Valid Option */
-	USART_SendStringPolling(UART_CONFIG->UART_ID, "  Wrong Option , Enter Option (1-3) ");
+	USART_SendStringPolling(UART_CONFIG->UART_ID, "  Wrong Option , Enter Option (1-8) ");
 
 	/* delay & clear terminal */
-	DELAY_500ms();
+	Console_Delay(MESSAGE_DELAY_MS);
 
 	Clear_Terminal();
 }
@@ -136,7 +224,7 @@ void Check_IF_ContinueisNeeded(void)
 	SendNew_Line();
 
 	/* Receive User's Choice */
-	Local_ReceivedChar = UART_u16Receive(UART_CONFIG);
+	Local_ReceivedChar = Console_Receive();
 
 	/* Transmit the Received Data to Visualize it on Putty Terminal */
 	UART_voidTransmitData(UART_CONFIG, Local_ReceivedChar);
@@ -153,9 +241,11 @@ void Check_IF_ContinueisNeeded(void)
 		USART_SendStringPolling(UART_CONFIG->UART_ID, (char *)"-           Bye Bye :)         - \n");
 		USART_SendStringPolling(UART_CONFIG->UART_ID, (char *)"└──────────── •✧✧• ────────────┘\n");
 
-		/* Stuck in Infinite Loop */
+		/* The Console Is Closed , Alarms , Timers & The Display Keep Running */
 		while (1)
-			;
+		{
+			Scheduler_Yield();
+		}
 	}
 	else
 	{
@@ -253,19 +343,21 @@ void Check_LoginInfo(uint8_t *ID_Ptr, uint8_t *Pass_Ptr, uint8_t TriesNumber)
  *                    1- Display Date & Time
  * 				      2- Set Alarm
  * 				      3- Set Date & Time
+ * 				      4- Acknowledge Alarms
+ * 				      5- Snooze Alarms
+ * 				      6- Timers & Stopwatch
+ * 				      7- Scheduler Statistics
+ * 				      8- Delete Alarm
  *
  * @param[in]		: void
  *
- * @return 			: OPTIONS_t > Option Choosen by User ( 1-3 )
+ * @return 			: void
  *
- * @note			: This Function is Called Only Once When User Enters the System ( ID & Password are Correct )
+ * @note			: The Option is Read By Read_Option Once the User Types it
  * ============================================================================
  */
-OPTIONS_t Display_Menu(void)
+void Display_Menu(void)
 {
-	/* Variable to Hold the Option Choosen by User */
-	OPTIONS_t ChoosenOption = NO_OPTION;
-
 	/* Welcome Message */
 	USART_SendStringPolling(UART_CONFIG->UART_ID, (char *)"┌──────────── •✧✧• ────────────┐\n");
 	USART_SendStringPolling(UART_CONFIG->UART_ID, (char *)"-  Welcome To My Clock System  - \n");
@@ -284,10 +376,32 @@ OPTIONS_t Display_Menu(void)
 	USART_SendStringPolling(UART_CONFIG->UART_ID, "1- Display Date & Time  \n");
 	USART_SendStringPolling(UART_CONFIG->UART_ID, "2- Set Alarm            \n");
 	USART_SendStringPolling(UART_CONFIG->UART_ID, "3- Set Date & Time      \n");
-	USART_SendStringPolling(UART_CONFIG->UART_ID, "[+] select option (1-3) : ");
+	USART_SendStringPolling(UART_CONFIG->UART_ID, "4- Acknowledge Alarms   \n");
+	USART_SendStringPolling(UART_CONFIG->UART_ID, "5- Snooze Alarms        \n");
+	USART_SendStringPolling(UART_CONFIG->UART_ID, "6- Timers & Stopwatch   \n");
+	USART_SendStringPolling(UART_CONFIG->UART_ID, "7- Scheduler Statistics \n");
+	USART_SendStringPolling(UART_CONFIG->UART_ID, "8- Delete Alarm         \n");
+	USART_SendStringPolling(UART_CONFIG->UART_ID, "[+] select option (1-8) : ");
+}
+
+/** ============================================================================
+ * @fn 				: Read_Option
+ *
+ * @brief 			: This Function is Used to Receive the Option Choosen by User From the Menu
+ *
+ * @param[in]		: void
+ *
+ * @return 			: OPTIONS_t > Option Choosen by User ( 1-8 )
+ *
+ * ============================================================================
+ */
+OPTIONS_t Read_Option(void)
+{
+	/* Variable to Hold the Option Choosen by User */
+	OPTIONS_t ChoosenOption = NO_OPTION;
 
 	/* Receive Option From User */
-	ChoosenOption = (uint8_t)UART_u16Receive(UART_CONFIG);
+	ChoosenOption = (uint8_t)Console_Receive();
 
 	/* Display Choosen Option in Putty Terminal */
 	UART_voidTransmitData(UART_CONFIG, ChoosenOption);
@@ -356,7 +470,7 @@ uint8_t *ID_Reception(void)
 	for (Local_u8Counter = 0; Local_u8Counter < NUM_OF_ID_PASS_DIGITS; Local_u8Counter++)
 	{
 		/* Receive ID From User Digit By Digit */
-		ID[Local_u8Counter] = UART_u16Receive(UART_CONFIG);
+		ID[Local_u8Counter] = Console_Receive();
 
 		/* Transmit the Received Data to Visualize it on Putty */
 		UART_voidTransmitData(UART_CONFIG, ID[Local_u8Counter]);
@@ -395,14 +509,14 @@ uint8_t *Pass_Reception(void)
 	for (Local_u8Counter = 0; Local_u8Counter < NUM_OF_ID_PASS_DIGITS; Local_u8Counter++)
 	{
 		/* Receive Pass From User Digit By Digit */
-		Pass[Local_u8Counter] = UART_u16Receive(UART_CONFIG);
+		Pass[Local_u8Counter] = Console_Receive();
 
 		/* Transmit the * to Make the Password Invisible */
 		UART_voidTransmitData(UART_CONFIG, '*');
 	}
 
 	/* Small Delay to Visualize the Last * on Putty Terminal */
-	DELAY_500ms();
+	Console_Delay(MESSAGE_DELAY_MS);
 
 	/* Send New Line to the terminal */
 	SendNew_Line();
@@ -431,8 +545,17 @@ void Clock_Init(void)
 	/* Enable GPIO PortB Clock */
 	RCC_AHB1EnableCLK(GPIOBEN);
 
+	/* Enable GPIO PortC Clock Used in Reading The User Button */
+	RCC_AHB1EnableCLK(GPIOCEN);
+
 	/* Enable I2C1 Clock */
 	RCC_APB1EnableCLK(I2C1EN);
+
+	/* Enable DMA1 Clock Used in Reading RTC Registers */
+	RCC_AHB1EnableCLK(DMA1EN);
+
+	/* Enable SYSCFG Clock Used in Routing RTC Square Wave to EXTI */
+	RCC_APB2EnableCLK(SYSCFGEN);
 }
 
 /*=======================================================================================
@@ -499,6 +622,30 @@ void Pins_Init(void)
 
 	/* Initialize Pin PB6 For EXTI */
 	GPIO_u8PinInit(&PB6_EXTI);
+
+	/* RTC SQW/OUT is Open Drain , Pulled Up on PB0 */
+	GPIO_PinConfig_t PB0_SQW =
+		{
+			.Port = PORTB,
+			.PinNum = PIN0,
+			.Mode = INPUT,
+			.PullType = PULL_UP,
+		};
+
+	/* Initialize Pin PB0 For RTC Square Wave */
+	GPIO_u8PinInit(&PB0_SQW);
+
+	/* User Button is Pulled Up on The Nucleo Board */
+	GPIO_PinConfig_t PC13_Button =
+		{
+			.Port = PORTC,
+			.PinNum = PIN13,
+			.Mode = INPUT,
+			.PullType = NO_PULL,
+		};
+
+	/* Initialize Pin PC13 For Acknowledging Alarms */
+	GPIO_u8PinInit(&PC13_Button);
 }
 
 /*=======================================================================================
@@ -526,6 +673,9 @@ void USART2_Init(void)
 
 	/* Initialize UART Struct Globally */
 	UART_CONFIG = &USART2Config;
+
+	/* Received Bytes Are Buffered From The Interrupt , The Console Task Reads Them */
+	UART_voidReceiveStreamIT(&USART2Config, &Console_ISR);
 }
 
 /*==============================================================================================================================================
@@ -543,8 +693,37 @@ void Interrupts_Init(void)
 	/* Set SPI to Group Priority Zero*/
 	NVIC_SetPriority(SPI1_IRQ, 0);
 
+	/* Enable I2C1 Event & Error Interrupts Used in Reading Time Without Blocking */
+	NVIC_EnableIRQ(I2C1_EV_IRQ);
+	NVIC_EnableIRQ(I2C1_ER_IRQ);
+
+	/* Set I2C1 to Group Priority Zero , Sub Priority One */
+	NVIC_SetPriority(I2C1_EV_IRQ, 1);
+	NVIC_SetPriority(I2C1_ER_IRQ, 1);
+
+	/* Enable I2C1 Receive DMA Stream Interrupt & Set it With I2C1 Priority */
+	NVIC_EnableIRQ(DMA1_Stream0_IRQ);
+	NVIC_SetPriority(DMA1_Stream0_IRQ, 1);
+
+	/* Enable RTC Square Wave Interrupt & Set it With I2C1 Priority */
+	NVIC_EnableIRQ(EXTI0_IRQ);
+	NVIC_SetPriority(EXTI0_IRQ, 1);
+
+	/* User Button Acknowledges The Ringing Alarms , Only The Event Is Posted From its Interrupt */
+	SYSFG_voidSetEXTIPort((EXTI_t)ALARM_BUTTON_LINE, ALARM_BUTTON_PORT);
+	EXTI_voidSetCallBack(ALARM_BUTTON_LINE, &AlarmButton_ISR);
+	EXTI_voidSetTriggerSelection(ALARM_BUTTON_LINE, FALLING_TRG);
+	EXTI_voidEnableEXTI(ALARM_BUTTON_LINE);
+
+	NVIC_EnableIRQ(EXTI15_10_IRQ);
+	NVIC_SetPriority(EXTI15_10_IRQ, 1);
+
+	/* Console Input Is Buffered From The USART2 Interrupt */
+	NVIC_EnableIRQ(USART2_IRQ);
+	NVIC_SetPriority(USART2_IRQ, 1);
+
 	/* Set SYSTICK to Group Priority One*/
-	SCB_VoidSetCorePriority(SYSTICK_FAULT, (1 << 7));
+	SCB_VoidSetCorePriority(SYSTICK_FAULT, 8);
 }
 
 /*=======================================================================================
@@ -582,15 +761,19 @@ void I2C1_Init(void)
 		.Chip_Address = 10,
 		.I2C_Mode = MASTER_MODE_STANDARD,
 		.I2C_Num = I2C_NUMBER_1,
-		.I2C_Pclk_MHZ = 16,
+		.I2C_Pclk_MHZ = SYSTEM_HCLK_MHZ,
 		.PEC_State = PACKET_ERR_CHECK_DISABLED,
-		.SCL_Frequency_KHZ = 100,
+		.SCL_Frequency_KHZ = 100, /* DS1307 Supports Standard Mode Only */
 		.Stretch_state = CLK_STRETCH_ENABLED};
 
 	/* I2C1 Initialization */
 	I2C_Init(&_I2C1);
 
 	I2C_CONFIG = &_I2C1;
+
+	/* Stuck Transfers Are Aborted Within a ms of Their Timeout , The Bus Is Recovered By a Task */
+	Scheduler_SetTask(SCHEDULER_EVENT_I2C_RECOVERY, &I2C_RecoveryTask);
+	Timers_StartPeriodic(TIMERS_I2C_ID, I2C_POLL_MS, &I2C_Poll);
 }
 
 /** ============================================================================
@@ -652,30 +835,33 @@ Error_State_t ReadDateTime_FromPC(void)
 	}
 	/*Display message to user that he should enter the Date and Time in the following form*/
 	USART_SendStringPolling(UART_2, "Enter the Date And time in the Following Form\n");
-	USART_SendStringPolling(UART_2, "yy-mm-dd (First 3 Letters of Day Name) HH:MM:SS\n");
+	USART_SendStringPolling(UART_2, "yy-mm-dd HH:MM:SS\n");
 
 	/*Receive the Date and Time from the user*/
 	for (uint8_t Local_Counter = 0; Local_Counter < CALENDER_FORMAT; Local_Counter++)
 	{
-		Date_Time_USART[Local_Counter] = UART_u16Receive(UART_CONFIG);
+		Date_Time_USART[Local_Counter] = Console_Receive();
 		UART_voidTransmitData(UART_CONFIG, Date_Time_USART[Local_Counter]);
 	}
-	/*Calculate calender Values to be send to RTC*/
-	Calculate_Calender(&Date_Time_RTC, Date_Time_USART);
-
-	/*Estimate the Day Name*/
-	Date_Time_RTC.Day = FindDay(Date_Time_USART);
-
 	/*Check the given Calender*/
-	if (OK == Check_Calender(&Date_Time_RTC))
+	if (OK == Check_CalenderDigits(Date_Time_USART, CALENDER_FIELDS_NUM))
 	{
-		Error_State = OK;
+		/*Calculate calender Values to be send to RTC*/
+		Calculate_Calender(&Date_Time_RTC, Date_Time_USART);
+
+		Error_State = Check_Calender(&Date_Time_RTC);
 	}
 	else
 	{
 		Error_State = NOK;
 	}
 
+	/*The Day Name is Calculated From the Date*/
+	if (OK == Error_State)
+	{
+		Date_Time_RTC.Day = Calendar_DayOfWeek(Date_Time_RTC.Date, Date_Time_RTC.Month, Date_Time_RTC.Year);
+	}
+
 	return Error_State;
 }
 
@@ -687,8 +873,12 @@ Error_State_t ReadDateTime_FromPC(void)
  * ======================================================================================*/
 void Transmit_Time(void)
 {
+	/* The Time Is Shown Now & Refreshed Every Second After */
+	DisplayRefresh = 1;
+	DisplayHold = 0;
+
 	/* Transmit Time Via SPI */
-	SPI_Transmit_IT(SPI_CONFIG, ReadingArr, 30, SPI_CALL_BACK);
+	SendFrame(SPI_FRAME_TIME, ReadingArr);
 }
 
 /*=======================================================================================
@@ -699,173 +889,496 @@ void Transmit_Time(void)
  * ======================================================================================*/
 void Reading_Time(void)
 {
-	/* Read Date & Time */
-	ReadingStruct = DS1307_ReadDateTime(I2C_CONFIG);
+	/* Read Date & Time Kept in RAM By the Soft Clock */
+	SoftClock_GetTime(&ReadingStruct);
 
 	/* Convert Reading Struct into Reading Array */
 
 	ReadingArr[0] = DISPLAY_CODE;
-	ReadingArr[1] = ReadingStruct->Seconds;
-	ReadingArr[2] = ReadingStruct->Minutes;
-	ReadingArr[3] = ReadingStruct->Hours;
-	ReadingArr[4] = ReadingStruct->Day;
-	ReadingArr[5] = ReadingStruct->Month;
-	ReadingArr[6] = ReadingStruct->Year;
-	ReadingArr[7] = ReadingStruct->Date;
+	ReadingArr[1] = ReadingStruct.Seconds;
+	ReadingArr[2] = ReadingStruct.Minutes;
+	ReadingArr[3] = ReadingStruct.Hours;
+	ReadingArr[4] = ReadingStruct.Day;
+	ReadingArr[5] = ReadingStruct.Month;
+	ReadingArr[6] = ReadingStruct.Year;
+	ReadingArr[7] = ReadingStruct.Date;
 }
 
 /*==============================================================================================================================================
- *@fn      : void CalcAlarm(uint8_t AlarmNumber)
- *@brief  :  This Function Is Responsible For Calculating The Alarm Time And Storing It In The Global Array
- *@paramter[in]  : uint8_t AlarmNumber : The Number Of The Alarm To Be Set
- *@retval void :
+ *@fn      : Error_State_t CalcAlarm(uint16_t AlarmId)
+ *@brief  :  This Function Is Responsible For Calculating The Alarm Time And Storing It In The Alarm Record
+ *@paramter[in]  : uint16_t AlarmId : Id Of The Allocated Alarm To Be Set
+ *@retval Error_State_t : NOK If The Typed Time Is Not Two Digit Fields Of a Real Time Of Day , The Record Is Then Not Changed
  *==============================================================================================================================================*/
-void CalcAlarm(uint8_t AlarmNumber)
+Error_State_t CalcAlarm(uint16_t AlarmId)
 {
+	Error_State_t Error_State = OK;
+
+	/* Record Of The Alarm To Be Set */
+	AlarmPool_Record_t *Record = AlarmPool_Get(AlarmId);
+
 	/* Variable To Store The Received Data From UART */
-	uint8_t RecTemp[8] = {0};
+	uint8_t RecTemp[ALARM_TIME_FORMAT] = {0};
 
-	uint8_t LoopCounter = 0;
+	uint8_t LoopCounter = 0, Hours = 0, Minutes = 0, Seconds = 0;
 
 	/* Receive The Alarm Time From UART And Store It In The Array */
-	for (LoopCounter = 0; LoopCounter < 8; LoopCounter++)
+	for (LoopCounter = 0; LoopCounter < ALARM_TIME_FORMAT; LoopCounter++)
 	{
-		RecTemp[LoopCounter] = UART_u16Receive(UART_CONFIG);
+		RecTemp[LoopCounter] = Console_Receive();
 
 		UART_voidTransmitData(UART_CONFIG, RecTemp[LoopCounter]);
 	}
 
-	/* Store The Received Data In The Global Array */
-	AlarmTime[AlarmNumber - 48][0] = (RecTemp[0] - 48) * 10 + (RecTemp[1] - 48);
-	AlarmTime[AlarmNumber - 48][1] = (RecTemp[3] - 48) * 10 + (RecTemp[4] - 48);
-	AlarmTime[AlarmNumber - 48][2] = (RecTemp[6] - 48) * 10 + (RecTemp[7] - 48);
+	/* Each Field Must be Two Digits Before It Is Converted */
+	if (NULL == Record)
+	{
+		Error_State = NOK;
+	}
+	else if (OK != Check_CalenderDigits(RecTemp, ALARM_FIELDS_NUM))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		Hours = (RecTemp[ALARM_HOURS_POS] - ZERO_ASCII) * 10 + (RecTemp[ALARM_HOURS_POS + 1] - ZERO_ASCII);
+		Minutes = (RecTemp[ALARM_MINUTES_POS] - ZERO_ASCII) * 10 + (RecTemp[ALARM_MINUTES_POS + 1] - ZERO_ASCII);
+		Seconds = (RecTemp[ALARM_SECONDS_POS] - ZERO_ASCII) * 10 + (RecTemp[ALARM_SECONDS_POS + 1] - ZERO_ASCII);
+
+		if ((Hours > MAX_HOURS) || (Minutes > MAX_MINUTES) || (Seconds > MAX_SECONDS))
+		{
+			Error_State = NOK;
+		}
+	}
+
+	/* Only a Real Time Of Day Reaches The Record , The Queue & The NVRAM */
+	if (OK == Error_State)
+	{
+		/* Store The Received Data In The Alarm Record */
+		Record->Time[0] = Hours;
+		Record->Time[1] = Minutes;
+		Record->Time[2] = Seconds;
+		Record->Flags |= ALARMPOOL_FLAG_ENABLED;
+
+		/* Keep The Alarm Over Resets , The Second Task Writes Only This Record , The NVRAM Holds The First Alarms Only */
+		if (AlarmId < ALARMSTORE_MAX_ALARMS)
+		{
+			AlarmsToSave |= (uint8_t)(1u << AlarmId);
+		}
+
+		/* Only The Changed Alarm Is Moved In The Queue */
+		ScheduleAlarm(AlarmId);
+	}
+
+	return Error_State;
 }
 
 /*==============================================================================================================================================
- *@fn      :  void CompTime()
- *@brief  :   This Function Is Responsible For Comparing The Current Time With The Alarm Time And Send The Alarm Number To The Blue Pill If They Are Equal
- *@retval void :
+ *@fn      : uint8_t RestoreAlarms(void)
+ *@brief  :  This Function Is Responsible For Emptying The Alarm Pool & Loading The Alarms Saved in the RTC Battery Backed RAM Into It
+ *@retval uint8_t : Number Of Restored Alarms
+ *@note    : Restored Alarms Keep Their Numbers , Repeat Days , Interval & Flags & Are Unnamed , The Names Are Not Saved
  *==============================================================================================================================================*/
-void CompTime()
+uint8_t RestoreAlarms(void)
 {
-	/* Variable To Store The Received Time From The RTC */
-	DS1307_Config_t *RecievedTime;
+	/* Alarms Saved In The NVRAM */
+	AlarmStore_Record_t Stored[ALARMSTORE_MAX_ALARMS];
+
+	/* Variable To Store The Number Of Restored Alarms */
+	uint8_t RestoredCount = 0, Counter = 0;
+
+	AlarmPool_Record_t *Record = NULL;
+
+	uint16_t AlarmId = 0;
 
-	/* Reading The Current Time From The RTC */
-	RecievedTime = DS1307_ReadDateTime(I2C_CONFIG);
+	/* A Fresh Pool Gives The Stored Records Ids 0 ~ ( ALARMSTORE_MAX_ALARMS - 1 ) In Order */
+	AlarmPool_Init();
 
-	/* Array To Store The Current Time From The Current Time Recieved From The RTC */
-	uint8_t CurrentTime[3] = {
-		RecievedTime->Hours, RecievedTime->Minutes, RecievedTime->Seconds};
+	/* All Alarms Are Read in One Burst , Alarms Are Left Empty If The Reading Failed */
+	AlarmStore_Restore(I2C_CONFIG, Stored, &RestoredCount);
 
-	/* Variable To Loop On The Alarm Time Array  Counter1 For Looping On Alarm Number & Counter2 For Looping On The Alarm Time */
-	uint8_t Counter1, Counter2 = 0;
+	for (Counter = 0; Counter < ALARMSTORE_MAX_ALARMS; Counter++)
+	{
+		AlarmPool_Alloc(&AlarmId);
+
+		Record = AlarmPool_Get(AlarmId);
 
-	/* Variable To Check The Equality Between The Current Time And The Alarm Time */
-	Equality_t EqualityCheck = NotEqual;
+		Record->Time[0] = Stored[Counter].Time[0];
+		Record->Time[1] = Stored[Counter].Time[1];
+		Record->Time[2] = Stored[Counter].Time[2];
+
+		/* The Console Sets Only The Weekdays & Interval Of The Rule , The Allocated Daily Rule Holds The Other Masks */
+		Record->Rule.Weekdays = Stored[Counter].Weekdays;
+		Record->Rule.IntervalMinutes = Stored[Counter].IntervalMinutes;
+		Record->Flags = Stored[Counter].Flags & (ALARMPOOL_FLAG_ENABLED | ALARMPOOL_FLAG_ONCE);
+	}
 
-	/* Loop On The Alarm Number */
-	for (Counter1 = 0; Counter1 < 5; Counter1++)
+	/* Empty Records Are Freed From The Last So New Alarms Take The Lowest Saved Numbers First */
+	for (Counter = ALARMSTORE_MAX_ALARMS; Counter > 0; Counter--)
 	{
-		/* Check If The Alarm Time Is Not Empty */
-		if (AlarmTime[Counter1][0] != 0xFF)
+		Record = AlarmPool_Get(Counter - 1u);
+
+		if (Record->Time[0] == ALARM_EMPTY)
 		{
-			/* Loop On The Alarm Time */
-			for (Counter2 = 0; Counter2 < 3; Counter2++)
-			{
-				/* Check If The Current Time Is Equal To The Alarm Time */
-				if (AlarmTime[Counter1][Counter2] != CurrentTime[Counter2])
-				{
-					/* If Not Equal Break The Loop And Continue To The Next Alarm Number */
-					EqualityCheck = NotEqual;
-					break;
-				}
-				/* If Equal Continue The Loop */
-				else
-				{
-					/* If The Loop Reached The End Of The Alarm Time Array Then The Current Time Is Equal To The Alarm Time */
-					EqualityCheck = Equal;
-				}
-			}
+			AlarmPool_Free(Counter - 1u);
 		}
-		/* If The Alarm Time Is Empty Continue To The Next Alarm Number */
-		else
+	}
+
+	return RestoredCount;
+}
+
+/*==============================================================================================================================================
+ *@fn      : void StartAlarms(void)
+ *@brief  :  This Function Is Responsible For Queueing All Alarms By Their Next Deadline & Arming One Timer At The Nearest , The RTC
+ *			 Hardware Alarm Fired From its INT Pin If The RTC Has One ( DS3231 ) , Otherwise The Soft Clock Deadline
+ *@retval void :
+ *==============================================================================================================================================*/
+void StartAlarms(void)
+{
+	/* Variable To Store The Current Time */
+	DS1307_Config_t Now;
+
+	uint32_t Epoch = 0;
+
+	if (RTC_HasHardwareAlarm() && !HwAlarmLineEnabled)
+	{
+		/* INT Pin Is Open Drain & Goes Low On The Match Till The Alarm Flag Is Cleared */
+		SYSFG_voidSetEXTIPort((EXTI_t)RTC_INT_LINE, RTC_INT_PORT);
+		EXTI_voidSetCallBack(RTC_INT_LINE, &HwAlarm_ISR);
+		EXTI_voidSetTriggerSelection(RTC_INT_LINE, FALLING_TRG);
+		EXTI_voidEnableEXTI(RTC_INT_LINE);
+
+		HwAlarmLineEnabled = 1;
+	}
+
+	SoftClock_GetTime(&Now);
+
+	HwAlarmMode = Now.Mode;
+
+	Epoch = Calendar_ToEpoch(&Now);
+
+	/* Nothing Is Due Yet , Only The Nearest Deadline Is Armed */
+	RebuildAlarms(Epoch, Epoch);
+}
+
+/*==============================================================================================================================================
+ *@fn      : Error_State_t SetClockTime(const DS1307_Config_t *Time)
+ *@brief  :  This Function Is Responsible For Setting The Time Of The RTC & The Soft Clock And Rescheduling The Alarms From It ,
+ *			 Moving The Time Forward Fires The Alarms Skipped Within ( ALARM_LATE_TOLERANCE ) , Moving It Backward Lets
+ *			 The Alarms Of The Repeated Period Fire Again
+ *@paramter[in]  : const DS1307_Config_t *Time : New Date & Time
+ *@retval Error_State_t : Error State Of Writing The RTC
+ *==============================================================================================================================================*/
+Error_State_t SetClockTime(const DS1307_Config_t *Time)
+{
+	Error_State_t Error_State = OK;
+
+	/* Variable To Store The Time Before & After The Change */
+	DS1307_Config_t Before, After;
+
+	uint32_t BeforeEpoch = 0, AfterEpoch = 0, From = 0;
+
+	SoftClock_GetTime(&Before);
+
+	Error_State = SoftClock_SetTime(Time);
+
+	SoftClock_GetTime(&After);
+
+	HwAlarmMode = After.Mode;
+
+	BeforeEpoch = Calendar_ToEpoch(&Before);
+	AfterEpoch = Calendar_ToEpoch(&After);
+
+	/* Deadlines Are Searched After The Old Time If It Is Recent Enough , Otherwise After The Tolerance Window */
+	From = AfterEpoch;
+
+	if (AfterEpoch > BeforeEpoch)
+	{
+		From = ((AfterEpoch - BeforeEpoch) > ALARM_LATE_TOLERANCE) ? (AfterEpoch - ALARM_LATE_TOLERANCE) : BeforeEpoch;
+	}
+
+	RebuildAlarms(From, AfterEpoch);
+
+	return Error_State;
+}
+
+/*==============================================================================================================================================
+ *@fn      : uint16_t AcknowledgeAlarms(void)
+ *@brief  :  This Function Is Responsible For Acknowledging Every Ringing Or Snoozed Alarm & Silencing The Bell , Each Alarm Is Queued
+ *			 At Its Next Deadline When Its Pending Ring Or Snooze End Comes
+ *@retval uint16_t : Number Of Acknowledged Alarms
+ *==============================================================================================================================================*/
+uint16_t AcknowledgeAlarms(void)
+{
+	AlarmPool_Record_t *Record = NULL;
+
+	uint16_t AlarmId = 0, Count = 0;
+
+	for (AlarmId = 0; AlarmId < ALARMPOOL_MAX_ALARMS; AlarmId++)
+	{
+		Record = AlarmPool_Get(AlarmId);
+
+		if ((NULL != Record) && ((ALARMPOOL_STATE_ACTIVE == Record->State) || (ALARMPOOL_STATE_SNOOZED == Record->State)))
 		{
-			continue;
+			Record->State = ALARMPOOL_STATE_ACKNOWLEDGED;
+			Count++;
 		}
-		/* If The Current Time Is Equal To The Alarm Time Send The Alarm Number To The Blue Pill */
-		if (EqualityCheck == Equal)
+	}
+
+	AlarmBell_Stop();
+
+	return Count;
+}
+
+/*==============================================================================================================================================
+ *@fn      : uint16_t SnoozeAlarms(void)
+ *@brief  :  This Function Is Responsible For Snoozing Every Ringing Alarm For ( ALARM_SNOOZE_TIME ) Seconds & Silencing The Bell
+ *@retval uint16_t : Number Of Snoozed Alarms
+ *==============================================================================================================================================*/
+uint16_t SnoozeAlarms(void)
+{
+	AlarmPool_Record_t *Record = NULL;
+
+	uint16_t AlarmId = 0, Count = 0;
+
+	for (AlarmId = 0; AlarmId < ALARMPOOL_MAX_ALARMS; AlarmId++)
+	{
+		Record = AlarmPool_Get(AlarmId);
+
+		if ((NULL != Record) && (ALARMPOOL_STATE_ACTIVE == Record->State))
 		{
-			AlarmName[0] = ALARMCODE;
-			/* Variable To Store The Alarm Number */
-			AlarmName[1] = ++Counter1;
-			/* Send The Alarm Number To The Blue Pill */
-			SPI_Transmit_IT(SPI_CONFIG, AlarmName, 30, &SPI1_ISR);
+			/* Counted From The Last Ring , At Most ( ALARM_RING_PERIOD ) Seconds Ago */
+			Record->State = ALARMPOOL_STATE_SNOOZED;
+			AlarmQueue_Add(&AlarmDeadlines, AlarmId, AlarmsNow + ALARM_SNOOZE_TIME);
+			Count++;
 		}
 	}
+
+	if (Count > 0u)
+	{
+		ArmNextAlarm();
+	}
+
+	AlarmBell_Stop();
+
+	return Count;
 }
 
 /*==============================================================================================================================================
- *@fn      : void SPI1_ISR()
- *@brief  :  This Function Is The ISR For The SPI1 Interrupt
+ *@fn      : void TimersMenu(void)
+ *@brief  :  This Function Is Responsible For Starting & Stopping The Countdowns & The Stopwatch And Showing Them From The Terminal
  *@retval void :
  *==============================================================================================================================================*/
-void SPI1_ISR()
+void TimersMenu(void)
 {
-	/* Notify The Blue Pill That The Alarm Is Fired */
-	GPIO_u8SetPinValue(PORTB, PIN6, PIN_HIGH);
-	DELAY_500ms();
-	GPIO_u8SetPinValue(PORTB, PIN6, PIN_LOW);
+	/* Variable To Store The Option Choosen By The User */
+	uint8_t Choice = 0, Running = 0;
+
+	uint32_t Milliseconds = 0, PriMask = 0;
+
+	uint16_t TimerId = TIMERS_COUNTDOWNS;
+
+	SendNew_Line();
+
+	USART_SendStringPolling(UART_2, "1- Start Countdown      \n");
+	USART_SendStringPolling(UART_2, "2- Stop Countdown       \n");
+	USART_SendStringPolling(UART_2, "3- Show Timers          \n");
+	USART_SendStringPolling(UART_2, "4- Start / Stop Stopwatch\n");
+	USART_SendStringPolling(UART_2, "5- Reset Stopwatch      \n");
+	USART_SendStringPolling(UART_2, "[+] select option (1-5) : ");
+
+	Choice = Console_Receive();
+	UART_voidTransmitData(UART_CONFIG, Choice);
+
+	SendNew_Line();
+
+	switch (Choice)
+	{
+	case '1':
+
+		TimerId = ReadTimerNumber();
+
+		if (TimerId < TIMERS_COUNTDOWNS)
+		{
+			USART_SendStringPolling(UART_2, "Please Enter Duration In Seconds ( e.g. 90.250 ): ");
+
+			if ((OK == ReadDuration(&Milliseconds)) && (OK == Timers_Start(TimerId, Milliseconds, &CountdownDone)))
+			{
+				/* The Call Back Sets The Bit From PendSV */
+				ENTER_CRITICAL_SECTION(PriMask);
+
+				CountdownsDone &= ~(1uL << TimerId);
+
+				EXIT_CRITICAL_SECTION(PriMask);
+
+				USART_SendStringPolling(UART_2, "Countdown Started\n");
+			}
+			else
+			{
+				USART_SendStringPolling(UART_2, "Wrong Duration\n");
+			}
+		}
+		break;
+
+	case '2':
+
+		TimerId = ReadTimerNumber();
+
+		if ((TimerId < TIMERS_COUNTDOWNS) && (OK == Timers_Stop(TimerId)))
+		{
+			USART_SendStringPolling(UART_2, "Countdown Stopped\n");
+		}
+		else if (TimerId < TIMERS_COUNTDOWNS)
+		{
+			USART_SendStringPolling(UART_2, "Countdown Is Not Running\n");
+		}
+		break;
+
+	case '3':
+
+		ShowTimers();
+		break;
+
+	case '4':
+
+		Timers_StopwatchRead(&Running);
+
+		if (Running)
+		{
+			Timers_StopwatchStop();
+
+			/* The Stopped Time Stays On The LCD */
+			Milliseconds = Timers_StopwatchRead(NULL);
+			SendTimerFrame(0, Milliseconds);
+
+			USART_SendStringPolling(UART_2, "Stopwatch Stopped At ");
+			SendDuration(Milliseconds);
+			SendNew_Line();
+		}
+		else
+		{
+			Timers_StopwatchStart();
+
+			USART_SendStringPolling(UART_2, "Stopwatch Running\n");
+		}
+		break;
+
+	case '5':
+
+		Timers_StopwatchReset();
+
+		USART_SendStringPolling(UART_2, "Stopwatch Cleared\n");
+		break;
+
+	default:
+
+		USART_SendStringPolling(UART_2, " Wrong Choice \n");
+		break;
+	}
 }
 
 /*==============================================================================================================================================
  *@fn      : void SetAlarm()
- *@brief  :  This Function Is Responsible For Setting The Alarm Time
+ *@brief  :  This Function Is Responsible For Creating a New Alarm Or Changing an Existing One , Its Name & Its Time
  *@retval void :
  *==============================================================================================================================================*/
 void SetAlarm()
 {
-	/* Variable To Store The Alarm Number */
-	uint8_t ChooseNum = 0;
-
-	SendNew_Line();
+	/* Alarm Name Received From The User */
+	uint8_t Name[ALARMPOOL_NAME_MAX] = {0};
 
-	/* Ask The User To Choose The Alarm Number */
-	USART_SendStringPolling(UART_2, "Please Choose Alarm Number From ( 1 ~ 5 )\nYour Choice: ");
+	/* Variable To Store The Received Character */
+	uint8_t Received = 0, NameLength = 0;
 
-	/* Receive The Alarm Number From The User */
-	ChooseNum = UART_u16Receive(UART_CONFIG);
+	/* Alarm Number Typed By The User , 0 For a New Alarm */
+	uint32_t ChooseNum = 0;
 
-	/* To Print on Terminal What User Typed */
-	UART_voidTransmitData(UART_CONFIG, ChooseNum);
+	uint16_t AlarmId = ALARMPOOL_NO_ALARM;
 
 	SendNew_Line();
 
-	/* Ask The User To Enter The Alarm Name */
-	USART_SendStringPolling(UART_2, "Please Enter Alarm Name: ");
+	/* Ask The User To Choose The Alarm Number */
+	USART_SendStringPolling(UART_2, "Please Enter Alarm Number To Change , or Press Enter For a New Alarm\nYour Choice: ");
 
-	/* Loop To Receive The Alarm Name From The User Until The User Press Enter */
-	for (AlarmNameCounter = 2; AlarmNameCounter < 30; AlarmNameCounter++)
+	/* Receive The Alarm Number Digits Until The User Press Enter */
+	Received = Console_Receive();
+	while (Received != 13)
 	{
+		/* To Print on Terminal What User Typed */
+		UART_voidTransmitData(UART_CONFIG, Received);
 
-		/* Receive The Alarm Name From The User */
-		AlarmName[AlarmNameCounter] = UART_u16Receive(UART_CONFIG);
-		if (AlarmName[AlarmNameCounter] == 13)
+		/* Non Digits & Numbers Out Of Range Are Refused Below */
+		if ((Received >= '0') && (Received <= '9') && (ChooseNum <= ALARMPOOL_MAX_ALARMS))
 		{
-			break;
+			ChooseNum = (ChooseNum * 10) + (Received - ZERO_ASCII);
 		}
-		UART_voidTransmitData(UART_CONFIG, AlarmName[AlarmNameCounter]);
+		else
+		{
+			ChooseNum = ALARMPOOL_MAX_ALARMS + 1u;
+		}
+		Received = Console_Receive();
 	}
 
 	SendNew_Line();
 
-	/* Check If The Alarm Number Is In The Range */
-	if (ChooseNum > '0' && ChooseNum < '6')
+	if (0 == ChooseNum)
+	{
+		/* New Alarm Takes a Free Record */
+		if (OK == AlarmPool_Alloc(&AlarmId))
+		{
+			USART_SendStringPolling(UART_2, "New Alarm Number: ");
+			SendNumber(AlarmId + 1u);
+			SendNew_Line();
+		}
+	}
+	else if (NULL != AlarmPool_Get(ChooseNum - 1u))
+	{
+		AlarmId = ChooseNum - 1u;
+	}
+
+	/* Check If The Alarm Number Is Valid */
+	if (ALARMPOOL_NO_ALARM != AlarmId)
 	{
+		/* Ask The User To Enter The Alarm Name */
+		USART_SendStringPolling(UART_2, "Please Enter Alarm Name: ");
+
+		/* Loop To Receive The Alarm Name From The User Until The User Press Enter */
+		for (NameLength = 0; NameLength < ALARMPOOL_NAME_MAX; NameLength++)
+		{
+			/* Receive The Alarm Name From The User */
+			Name[NameLength] = Console_Receive();
+			if (Name[NameLength] == 13)
+			{
+				break;
+			}
+			UART_voidTransmitData(UART_CONFIG, Name[NameLength]);
+		}
+
+		SendNew_Line();
+
+		/* Each Alarm Keeps Its Own Name , Equal Names Share One Copy */
+		if (OK != AlarmPool_SetName(AlarmId, Name, NameLength))
+		{
+			USART_SendStringPolling(UART_2, "No Room For The Name , The Old Name Is Kept\n");
+		}
+
+		/* The Rule Is Set Before The Time , CalcAlarm Schedules The Alarm */
+		ReadRecurrence(AlarmPool_Get(AlarmId));
+
 		USART_SendStringPolling(UART_2, "Please Enter Your Alarm in this sequence xx:xx:xx\n");
-		CalcAlarm(ChooseNum - 1);
+
+		/* A Wrong Time Is Never Stored , The User Is Asked Again */
+		while (OK != CalcAlarm(AlarmId))
+		{
+			USART_SendStringPolling(UART_2, "\nWrong Time , Please Enter HH:MM:SS ( 00:00:00 - 23:59:59 )\n");
+		}
+	}
+	else if (0 == ChooseNum)
+	{
+		/* All Alarm Records Are Used */
+		USART_SendStringPolling(UART_2, " No Free Alarms ");
 	}
-	/* If The Alarm Number Is Not In The Range Send Wrong Choice To The User */
+	/* If The Alarm Number Is Not In Use Send Wrong Choice To The User */
 	else
 	{
 		/* Send Wrong Choice To The User */
@@ -876,77 +1389,192 @@ void SetAlarm()
 }
 
 /*==============================================================================================================================================
- *@fn      :  void SendGreenSignal()
- *@brief  :   This Function Is Responsible For Sending a Signal to Panda Board when System Login is Completed
+ *@fn      : void DeleteAlarm(void)
+ *@brief  :  This Function Is Responsible For Deleting an Alarm Chosen By The User , It Is Removed From The Alarm Queue & Its Record Is
+ *			 Returned To The Alarm Pool
  *@retval void :
  *==============================================================================================================================================*/
-void SendGreenSignal( void )
+void DeleteAlarm(void)
 {
-	ReadingArr[0] = GREEN_LED_CODE ;
-	SPI_Transmit_IT(SPI_CONFIG, ReadingArr , 30 , SPI_CALL_BACK) ;
-}
+	/* Characters Received From The User */
+	uint8_t Line[REPEAT_LINE_SIZE] = {0};
 
-/* ============================================================================*
- * 								Private Functions							   *
- * ============================================================================*/
+	uint8_t Length = 0, Counter = 0;
 
-/*=======================================================================================
- * @fn		 		:	FindDay
- * @brief			:	Find The Day given by the user
- * @param			:	Pointer to the Calender Array received from user
- * @retval			:	The Day received from the user
- * ======================================================================================*/
-static DS1307_DAYS_t FindDay(uint8_t *Calender)
-{
-	/*Variable to store the Day*/
-	DS1307_DAYS_t Day = 0;
+	AlarmPool_Record_t *Record = NULL;
 
-	/*Check the 3 Given Letters*/
-	if ((('S' == Calender[FIRST_LETTER_OF_DAY]) || ('s' == Calender[FIRST_LETTER_OF_DAY])) && (('A' == Calender[SECOND_LETTER_OF_DAY]) || ('a' == Calender[SECOND_LETTER_OF_DAY])) && (('T' == Calender[THIRD_LETTER_OF_DAY]) || ('t' == Calender[THIRD_LETTER_OF_DAY])))
-	{
-		/*First 3 letters are SAT so the day is Saturday*/
-		Day = DS1307_SATURDAY;
-	}
-	else if ((('S' == Calender[FIRST_LETTER_OF_DAY]) || ('s' == Calender[FIRST_LETTER_OF_DAY])) && (('U' == Calender[SECOND_LETTER_OF_DAY]) || ('u' == Calender[SECOND_LETTER_OF_DAY])) && (('N' == Calender[THIRD_LETTER_OF_DAY]) || ('n' == Calender[THIRD_LETTER_OF_DAY])))
+	uint32_t Number = 0;
+
+	SendNew_Line();
+
+	USART_SendStringPolling(UART_2, "Please Enter Alarm Number To Delete: ");
+	Length = ReceiveLine(Line, REPEAT_LINE_SIZE);
+
+	for (Counter = 0; (Counter < Length) && (Line[Counter] >= '0') && (Line[Counter] <= '9'); Counter++)
 	{
-		/*First 3 letters are SUN so the day is Sunday*/
-		Day = DS1307_SUNDAY;
+		Number = (Number * 10) + (Line[Counter] - ZERO_ASCII);
 	}
-	else if ((('M' == Calender[FIRST_LETTER_OF_DAY]) || ('m' == Calender[FIRST_LETTER_OF_DAY])) && (('O' == Calender[SECOND_LETTER_OF_DAY]) || ('o' == Calender[SECOND_LETTER_OF_DAY])) && (('N' == Calender[THIRD_LETTER_OF_DAY]) || ('n' == Calender[THIRD_LETTER_OF_DAY])))
+
+	if ((Length > 0) && (Counter == Length) && (Number >= 1u) && (Number <= ALARMPOOL_MAX_ALARMS))
 	{
-		/*First 3 letters are MON so the day is Monday*/
-		Day = DS1307_MONDAY;
+		Record = AlarmPool_Get(Number - 1u);
 	}
 
-	else if ((('T' == Calender[FIRST_LETTER_OF_DAY]) || ('t' == Calender[FIRST_LETTER_OF_DAY])) && (('U' == Calender[SECOND_LETTER_OF_DAY]) || ('u' == Calender[SECOND_LETTER_OF_DAY])) && (('E' == Calender[THIRD_LETTER_OF_DAY]) || ('e' == Calender[THIRD_LETTER_OF_DAY])))
+	if (NULL != Record)
 	{
-		/*First 3 letters are Tue so the day is Tuesday*/
-		Day = DS1307_TUESDAY;
+		/* A Ringing Alarm Stops Ringing , Other Ringing Alarms Ring Again At Their Next Ring */
+		if (ALARMPOOL_STATE_ACTIVE == Record->State)
+		{
+			AlarmBell_Stop();
+		}
+
+		/* The Alarm Must Leave The Queue Before Its Id Can Be Taken Again */
+		AlarmQueue_Remove(&AlarmDeadlines, Number - 1u);
+		AlarmPool_Free(Number - 1u);
+
+		ArmNextAlarm();
+
+		/* A Freed Record Is Cleared From The NVRAM By The Second Task */
+		if ((Number - 1u) < ALARMSTORE_MAX_ALARMS)
+		{
+			AlarmsToSave |= (uint8_t)(1u << (Number - 1u));
+		}
+
+		USART_SendStringPolling(UART_2, "Alarm Deleted\n");
 	}
-	else if ((('W' == Calender[FIRST_LETTER_OF_DAY]) || ('w' == Calender[FIRST_LETTER_OF_DAY])) && (('E' == Calender[SECOND_LETTER_OF_DAY]) || ('e' == Calender[SECOND_LETTER_OF_DAY])) && (('D' == Calender[THIRD_LETTER_OF_DAY]) || ('d' == Calender[THIRD_LETTER_OF_DAY])))
+	else
 	{
-		/*First 3 letters are wed so the day is Wednesday*/
-		Day = DS1307_WEDNESDAY;
+		USART_SendStringPolling(UART_2, " Wrong Choice \n");
 	}
-	else if ((('T' == Calender[FIRST_LETTER_OF_DAY]) || ('t' == Calender[FIRST_LETTER_OF_DAY])) && (('H' == Calender[SECOND_LETTER_OF_DAY]) || ('h' == Calender[SECOND_LETTER_OF_DAY])) && (('U' == Calender[THIRD_LETTER_OF_DAY]) || ('u' == Calender[THIRD_LETTER_OF_DAY])))
+}
+
+/*==============================================================================================================================================
+ *@fn      :  void SendGreenSignal()
+ *@brief  :   This Function Is Responsible For Sending a Signal to Panda Board when System Login is Completed
+ *@retval void :
+ *==============================================================================================================================================*/
+void SendGreenSignal( void )
+{
+	/* Login Signal Frame Sent To The Blue Pill */
+	uint8_t SignalFrame[DISPLAY_FRAME_SIZE] = {0} ;
+
+	SignalFrame[0] = GREEN_LED_CODE ;
+	SendFrame(SPI_FRAME_SIGNAL, SignalFrame) ;
+}
+
+/*==============================================================================================================================================
+ *@fn      : void StartTasks(void)
+ *@brief  :  This Function Is Responsible For Setting The Alarm , Button , Second & SPI Tasks Of The Scheduler & Starting The Second Tick
+ *@retval void :
+ *@note    : Called After Scheduler_Init & Before StartAlarms , The Interrupts Post Their Events From Then
+ *==============================================================================================================================================*/
+void StartTasks(void)
+{
+	Scheduler_SetTask(SCHEDULER_EVENT_ALARM_DUE, &AlarmTask);
+	Scheduler_SetTask(SCHEDULER_EVENT_BUTTON, &AlarmButtonDue);
+	Scheduler_SetTask(SCHEDULER_EVENT_SECOND, &SecondTask);
+	Scheduler_SetTask(SCHEDULER_EVENT_SPI_DONE, &SpiDoneTask);
+
+	/* Works With Both RTC Chips , The Soft Clock Keeps The Time Itself */
+	Timers_StartPeriodic(TIMERS_SECOND_ID, SECOND_TICK_MS, &SecondTick);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void Console_Start(void (*Handler)(void))
+ *@brief  :  This Function Is Responsible For Running The Console Task On Each Console Input
+ *@paramter[in]  : void (*Handler)(void) : Called While Input Is Waiting , Handles One Command Reading It By Console_Receive
+ *@retval void :
+ *==============================================================================================================================================*/
+void Console_Start(void (*Handler)(void))
+{
+	ConsoleHandler = Handler;
+
+	Scheduler_SetTask(SCHEDULER_EVENT_UART_RX, &Console_Task);
+
+	/* Bytes Typed Before The Task Was Set Posted Nothing */
+	if (Console_Pending())
 	{
-		/*First 3 letters are THU so the day is Thrusday*/
-		Day = DS1307_THURSDAY;
+		ConsolePosted = 1;
+		Scheduler_Post(SCHEDULER_EVENT_UART_RX, 0);
 	}
-	else if ((('F' == Calender[FIRST_LETTER_OF_DAY]) || ('f' == Calender[FIRST_LETTER_OF_DAY])) && (('R' == Calender[SECOND_LETTER_OF_DAY]) || ('r' == Calender[SECOND_LETTER_OF_DAY])) && (('I' == Calender[THIRD_LETTER_OF_DAY]) || ('i' == Calender[THIRD_LETTER_OF_DAY])))
+}
+
+/*==============================================================================================================================================
+ *@fn      : uint8_t Console_Receive(void)
+ *@brief  :  This Function Is Responsible For Receiving One Byte From The Console , Other Tasks Run While The User Types
+ *@retval uint8_t : Received Byte
+ *==============================================================================================================================================*/
+uint8_t Console_Receive(void)
+{
+	uint8_t Data = 0;
+
+	while (ConsoleHead == ConsoleTail)
 	{
-		/*First 3 letters are FRI so the day is Friday*/
-		Day = DS1307_FRIDAY;
+		Scheduler_Yield();
 	}
-	else
+
+	Data = ConsoleBuffer[ConsoleTail & CONSOLE_INDEX_MASK];
+	ConsoleTail++;
+
+	return Data;
+}
+
+/*==============================================================================================================================================
+ *@fn      : uint8_t Console_Pending(void)
+ *@brief  :  This Function Is Responsible For Checking The Console Input
+ *@retval uint8_t : Number Of Received Bytes Not Read Yet
+ *==============================================================================================================================================*/
+uint8_t Console_Pending(void)
+{
+	return (uint8_t)(ConsoleHead - ConsoleTail);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void ShowStatistics(void)
+ *@brief  :  This Function Is Responsible For Sending The Run Count , Run Times & Queue Depths Of Each Scheduler Task To The Terminal
+ *@retval void :
+ *==============================================================================================================================================*/
+void ShowStatistics(void)
+{
+	/* Task Names Indexed By The Scheduler Events */
+	static const char *const TaskNames[SCHEDULER_EVENTS] = {"Alarms   ", "Button   ", "Second   ", "SPI Done ", "Console  ",
+																  "I2C      "};
+
+	Scheduler_Stats_t Stats;
+
+	uint8_t Event = 0;
+
+	SendNew_Line();
+	USART_SendStringPolling(UART_2, "Task      Runs  Last us  Max us  Avg us  Queue  Max Queue  Dropped\n");
+
+	for (Event = 0; Event < SCHEDULER_EVENTS; Event++)
 	{
-		/*Wrong Day*/
-		Day = WRONG_DAY;
+		if (OK == Scheduler_GetStats(Event, &Stats))
+		{
+			USART_SendStringPolling(UART_2, (char *)TaskNames[Event]);
+			SendDigits(Stats.Runs, 5);
+			USART_SendStringPolling(UART_2, "  ");
+			SendDigits(Stats.LastTime, 7);
+			USART_SendStringPolling(UART_2, "  ");
+			SendDigits(Stats.MaxTime, 6);
+			USART_SendStringPolling(UART_2, "  ");
+			/* The Total Wraps After Long Uptimes , The Average Is a Guide Only */
+			SendDigits((0u == Stats.Runs) ? 0u : (Stats.TotalTime / Stats.Runs), 6);
+			USART_SendStringPolling(UART_2, "  ");
+			SendDigits(Stats.Depth, 5);
+			USART_SendStringPolling(UART_2, "  ");
+			SendDigits(Stats.MaxDepth, 9);
+			USART_SendStringPolling(UART_2, "  ");
+			SendNumber((Stats.Dropped > 0xFFFFu) ? 0xFFFFu : (uint16_t)Stats.Dropped);
+			SendNew_Line();
+		}
 	}
-	/*Return the Day*/
-	return Day;
 }
 
+/* ============================================================================*
+ * 								Private Functions							   *
+ * ============================================================================*/
+
 /*=======================================================================================
  * @fn		 		:	Calculate_Calender
  * @brief			:	Translate The Calender given by the user from ASCII to Decimal values
@@ -958,33 +1586,60 @@ static DS1307_DAYS_t FindDay(uint8_t *Calender)
 static void Calculate_Calender(DS1307_Config_t *Date_Time_To_RTC, uint8_t *Date_Time_From_USART)
 {
 	/*Calculate The Date*/
-	Date_Time_To_RTC->Year = (((Date_Time_From_USART[0] - ZERO_ASCII) * 10) + (Date_Time_From_USART[1] - ZERO_ASCII));
-	Date_Time_To_RTC->Month = (((Date_Time_From_USART[3] - ZERO_ASCII) * 10) + (Date_Time_From_USART[4] - ZERO_ASCII));
-	Date_Time_To_RTC->Date = (((Date_Time_From_USART[6] - ZERO_ASCII) * 10) + (Date_Time_From_USART[7] - ZERO_ASCII));
+	Date_Time_To_RTC->Year = (((Date_Time_From_USART[CALENDER_YEAR_POS] - ZERO_ASCII) * 10) + (Date_Time_From_USART[CALENDER_YEAR_POS + 1] - ZERO_ASCII));
+	Date_Time_To_RTC->Month = (((Date_Time_From_USART[CALENDER_MONTH_POS] - ZERO_ASCII) * 10) + (Date_Time_From_USART[CALENDER_MONTH_POS + 1] - ZERO_ASCII));
+	Date_Time_To_RTC->Date = (((Date_Time_From_USART[CALENDER_DATE_POS] - ZERO_ASCII) * 10) + (Date_Time_From_USART[CALENDER_DATE_POS + 1] - ZERO_ASCII));
 
 	/*Calculate the Time*/
-	Date_Time_To_RTC->Hours = (((Date_Time_From_USART[15] - ZERO_ASCII) * 10) + (Date_Time_From_USART[16] - ZERO_ASCII));
-	Date_Time_To_RTC->Minutes = (((Date_Time_From_USART[18] - ZERO_ASCII) * 10) + (Date_Time_From_USART[19] - ZERO_ASCII));
-	Date_Time_To_RTC->Seconds = (((Date_Time_From_USART[21] - ZERO_ASCII) * 10) + (Date_Time_From_USART[22] - ZERO_ASCII));
+	Date_Time_To_RTC->Hours = (((Date_Time_From_USART[CALENDER_HOURS_POS] - ZERO_ASCII) * 10) + (Date_Time_From_USART[CALENDER_HOURS_POS + 1] - ZERO_ASCII));
+	Date_Time_To_RTC->Minutes = (((Date_Time_From_USART[CALENDER_MINUTES_POS] - ZERO_ASCII) * 10) + (Date_Time_From_USART[CALENDER_MINUTES_POS + 1] - ZERO_ASCII));
+	Date_Time_To_RTC->Seconds = (((Date_Time_From_USART[CALENDER_SECONDS_POS] - ZERO_ASCII) * 10) + (Date_Time_From_USART[CALENDER_SECONDS_POS + 1] - ZERO_ASCII));
 }
 
 /*=======================================================================================
  * @fn		 		:	Check_Calender
- * @brief			:	Check The Calender given by the user
+ * @brief			:	Check The Calender given by the user Is a Real Date & Time ( Month Lengths & Leap Years )
  * @param			:	Pointer to the Calender struct which will be sent to RTC
  * @retval			:	Error State
  * ======================================================================================*/
 static Error_State_t Check_Calender(DS1307_Config_t *Date_Time_To_RTC)
 {
 	Error_State_t Error_State = OK;
-	/*Check if the Date and Time are in the Acceptable Range*/
-	if ((Date_Time_To_RTC->Date > MAX_DATE) || (Date_Time_To_RTC->Day == WRONG_DAY) || (Date_Time_To_RTC->Hours > MAX_HOURS) || (Date_Time_To_RTC->Minutes > MAX_MINUTES) || (Date_Time_To_RTC->Month > MAX_MONTH) || (Date_Time_To_RTC->Seconds > MAX_SECONDS) || (Date_Time_To_RTC->Year > MAX_YEAR))
+	/*Check if the Date and Time are in the Acceptable Range , Month is Checked First as Days in Month Depends on it*/
+	if ((Date_Time_To_RTC->Month < 1) || (Date_Time_To_RTC->Month > MAX_MONTH) || (Date_Time_To_RTC->Year > MAX_YEAR) ||
+		(Date_Time_To_RTC->Date < 1) || (Date_Time_To_RTC->Date > Calendar_DaysInMonth(Date_Time_To_RTC->Month, Date_Time_To_RTC->Year)) ||
+		(Date_Time_To_RTC->Hours > MAX_HOURS) || (Date_Time_To_RTC->Minutes > MAX_MINUTES) || (Date_Time_To_RTC->Seconds > MAX_SECONDS))
 	{
 		Error_State = NOK;
 	}
 	return Error_State;
 }
 
+/*=======================================================================================
+ * @fn		 		:	Check_CalenderDigits
+ * @brief			:	Check Each Field of The Calender Array received from user is Two Decimal Digits
+ * @param			:	Pointer to the Calender Array received from user
+ * @param			:	Number of Fields , Each Two Digits & One Separator
+ * @retval			:	Error State
+ * ======================================================================================*/
+static Error_State_t Check_CalenderDigits(uint8_t *Date_Time_From_USART, uint8_t FieldsNum)
+{
+	Error_State_t Error_State = OK;
+
+	uint8_t Local_Counter = 0;
+
+	/*Fields Are Two Digits Separated By One Character , Each Field Starts 3 Characters After the Previous*/
+	for (Local_Counter = 0; Local_Counter < (FieldsNum * 3); Local_Counter += 3)
+	{
+		if ((Date_Time_From_USART[Local_Counter] < '0') || (Date_Time_From_USART[Local_Counter] > '9') ||
+			(Date_Time_From_USART[Local_Counter + 1] < '0') || (Date_Time_From_USART[Local_Counter + 1] > '9'))
+		{
+			Error_State = NOK;
+		}
+	}
+	return Error_State;
+}
+
 /** ============================================================================
  * @fn 				: TryAgain
  *
@@ -1095,7 +1750,1059 @@ static uint8_t *InvertPass(uint8_t *Arr, uint8_t ArrSize)
 /* ============================================================================*
  * 								ISRs  										   *
  * ============================================================================*/
-/* Unused Call Back Function of SPI , When Transmitting Data to Display  & when Transmitting Green Led Signal */
+/* Call Back Function of SPI For Every Queued Frame , The Next Frame Is Started From The SPI Done Task */
 void SPI_CALL_BACK(void)
 {
+	/* Without The Task The Queue Must Not Stall , The Next Frame Is Started Here */
+	if (OK != Scheduler_Post(SCHEDULER_EVENT_SPI_DONE, SpiSending))
+	{
+		StartNextFrame();
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void FireAlarm(uint16_t AlarmId, uint8_t Beeps)
+ *@brief  :  This Function Is Responsible For Sending The Alarm Number & Its Name To The Blue Pill & Ringing The Bell Once Sent
+ *@paramter[in]  : uint16_t AlarmId : Id Of The Fired Alarm
+ *@paramter[in]  : uint8_t Beeps : Number Of Bell Pulses
+ *@retval void :
+ *==============================================================================================================================================*/
+static void FireAlarm(uint16_t AlarmId, uint8_t Beeps)
+{
+	AlarmPool_Record_t *Record = AlarmPool_Get(AlarmId);
+
+	/* Alarm Frame Sent To The Blue Pill ( Code , Alarm Number , Name ) */
+	uint8_t AlarmFrame[ALARM_FRAME_SIZE];
+
+	const uint8_t *Name = NULL;
+
+	uint32_t PriMask = 0;
+
+	uint8_t NameLength = 0, Counter = 0;
+
+	if ((NULL == Record) || (OK != StringArena_Get(Record->Name, &Name, &NameLength)))
+	{
+		NameLength = 0;
+	}
+
+	AlarmFrame[0] = ALARMCODE;
+	/* Alarm Number ( 1 - ALARMPOOL_MAX_ALARMS ) , High Byte First */
+	AlarmFrame[ALARM_FRAME_NUMBER_POS] = (uint8_t)((AlarmId + 1u) >> 8);
+	AlarmFrame[ALARM_FRAME_NUMBER_POS + 1u] = (uint8_t)((AlarmId + 1u) & 0xFFu);
+
+	/* The Name Ends With Enter As Typed , The Rest Of The Frame Is Cleared */
+	for (Counter = 0; Counter < (ALARM_FRAME_SIZE - ALARM_FRAME_NAME_POS); Counter++)
+	{
+		if (Counter < NameLength)
+		{
+			AlarmFrame[ALARM_FRAME_NAME_POS + Counter] = Name[Counter];
+		}
+		else if (Counter == NameLength)
+		{
+			AlarmFrame[ALARM_FRAME_NAME_POS + Counter] = 13;
+		}
+		else
+		{
+			AlarmFrame[ALARM_FRAME_NAME_POS + Counter] = 0;
+		}
+	}
+
+	/* Send The Alarm Number To The Blue Pill , The SPI Done Task Rings The Bell Once It Is Sent */
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	AlarmBeepsQueued = Beeps;
+	SendFrame(SPI_FRAME_ALARM, AlarmFrame);
+
+	EXIT_CRITICAL_SECTION(PriMask);
+}
+
+/*==============================================================================================================================================
+ *@fn      : uint8_t ReceiveLine(uint8_t *Line, uint8_t MaxLength)
+ *@brief  :  This Function Is Responsible For Receiving Characters From The Terminal Until The User Press Enter
+ *@paramter[out] : uint8_t *Line : Received Characters , Characters Beyond MaxLength Are Dropped
+ *@paramter[in]  : uint8_t MaxLength : Size Of Line
+ *@retval uint8_t : Number Of Characters Stored In Line
+ *==============================================================================================================================================*/
+static uint8_t ReceiveLine(uint8_t *Line, uint8_t MaxLength)
+{
+	uint8_t Received = Console_Receive(), Length = 0;
+
+	while (Received != 13)
+	{
+		/* To Print on Terminal What User Typed */
+		UART_voidTransmitData(UART_CONFIG, Received);
+
+		if (Length < MaxLength)
+		{
+			Line[Length++] = Received;
+		}
+		Received = Console_Receive();
+	}
+
+	SendNew_Line();
+
+	return Length;
+}
+
+/*==============================================================================================================================================
+ *@fn      : void ReadRecurrence(AlarmPool_Record_t *Record)
+ *@brief  :  This Function Is Responsible For Asking The User On Which Days & How Often An Alarm Repeats
+ *@paramter[out] : AlarmPool_Record_t *Record : Alarm Record Whose Rule & Once Flag Are Set
+ *@retval void :
+ *==============================================================================================================================================*/
+static void ReadRecurrence(AlarmPool_Record_t *Record)
+{
+	/* Characters Received From The User */
+	uint8_t Line[REPEAT_LINE_SIZE] = {0};
+
+	uint8_t Length = 0, Counter = 0;
+
+	uint16_t Interval = 0;
+
+	Recurrence_SetDaily(&Record->Rule);
+	Record->Flags &= ~ALARMPOOL_FLAG_ONCE;
+
+	USART_SendStringPolling(UART_2, "Repeat On Days ( 1 = Sunday ~ 7 = Saturday , e.g. 246 ) , 0 For Once , Press Enter For Every Day: ");
+	Length = ReceiveLine(Line, REPEAT_LINE_SIZE);
+
+	if ((Length > 0) && (Line[0] == '0'))
+	{
+		Record->Flags |= ALARMPOOL_FLAG_ONCE;
+	}
+	else if (Length > 0)
+	{
+		Record->Rule.Weekdays = 0;
+
+		for (Counter = 0; Counter < Length; Counter++)
+		{
+			if ((Line[Counter] >= '1') && (Line[Counter] <= '7'))
+			{
+				Record->Rule.Weekdays |= RECURRENCE_WEEKDAY(Line[Counter] - ZERO_ASCII);
+			}
+		}
+
+		/* Nothing Valid Typed , Keep Every Day */
+		if (0 == Record->Rule.Weekdays)
+		{
+			Record->Rule.Weekdays = RECURRENCE_ALL_WEEKDAYS;
+		}
+	}
+
+	USART_SendStringPolling(UART_2, "Repeat Every N Minutes After The Alarm Time Till Midnight , Press Enter For No Repeat: ");
+	Length = ReceiveLine(Line, REPEAT_LINE_SIZE);
+
+	for (Counter = 0; (Counter < Length) && (Line[Counter] >= '0') && (Line[Counter] <= '9'); Counter++)
+	{
+		Interval = (Interval * 10) + (Line[Counter] - ZERO_ASCII);
+	}
+
+	if ((Counter == Length) && (Interval <= RECURRENCE_MAX_INTERVAL))
+	{
+		Record->Rule.IntervalMinutes = Interval;
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void SendNumber(uint16_t Number)
+ *@brief  :  This Function Is Responsible For Sending a Number In Decimal To The Terminal
+ *@paramter[in]  : uint16_t Number : Number To Be Sent
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SendNumber(uint16_t Number)
+{
+	/* Digits Are Found From The Lowest */
+	uint8_t Digits[5] = {0};
+
+	uint8_t Counter = 0;
+
+	do
+	{
+		Digits[Counter++] = (Number % 10) + ZERO_ASCII;
+		Number /= 10;
+	} while (Number > 0);
+
+	while (Counter > 0)
+	{
+		UART_voidTransmitData(UART_CONFIG, Digits[--Counter]);
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : uint16_t ReadTimerNumber(void)
+ *@brief  :  This Function Is Responsible For Asking The User For a Countdown Number
+ *@retval uint16_t : Timer Id Of The Countdown , ( TIMERS_COUNTDOWNS ) If The Number Is Not Valid
+ *==============================================================================================================================================*/
+static uint16_t ReadTimerNumber(void)
+{
+	/* Characters Received From The User */
+	uint8_t Line[REPEAT_LINE_SIZE] = {0};
+
+	uint8_t Length = 0, Counter = 0;
+
+	uint16_t Number = 0, TimerId = TIMERS_COUNTDOWNS;
+
+	USART_SendStringPolling(UART_2, "Please Enter Countdown Number ( 1 - 16 ): ");
+	Length = ReceiveLine(Line, REPEAT_LINE_SIZE);
+
+	for (Counter = 0; (Counter < Length) && (Line[Counter] >= '0') && (Line[Counter] <= '9'); Counter++)
+	{
+		Number = (Number * 10) + (Line[Counter] - ZERO_ASCII);
+	}
+
+	if ((Length > 0) && (Counter == Length) && (Number >= 1u) && (Number <= TIMERS_COUNTDOWNS))
+	{
+		TimerId = Number - 1u;
+	}
+	else
+	{
+		USART_SendStringPolling(UART_2, " Wrong Choice \n");
+	}
+
+	return TimerId;
+}
+
+/*==============================================================================================================================================
+ *@fn      : Error_State_t ReadDuration(uint32_t *Milliseconds)
+ *@brief  :  This Function Is Responsible For Receiving a Duration Typed In Seconds With Up To 3 Decimal Places
+ *@paramter[out] : uint32_t *Milliseconds : Duration In ms
+ *@retval Error_State_t : NOK If The Duration Is Not a Number Or Longer Than ( TIMERS_MAX_DURATION )
+ *==============================================================================================================================================*/
+static Error_State_t ReadDuration(uint32_t *Milliseconds)
+{
+	Error_State_t Error_State = OK;
+
+	/* Characters Received From The User */
+	uint8_t Line[DURATION_LINE_SIZE] = {0};
+
+	uint8_t Length = 0, Counter = 0, Decimals = 0;
+
+	uint32_t Seconds = 0, Fraction = 0;
+
+	Length = ReceiveLine(Line, DURATION_LINE_SIZE);
+
+	/* Whole Seconds */
+	for (Counter = 0; (Counter < Length) && (Line[Counter] >= '0') && (Line[Counter] <= '9') && (Seconds <= DURATION_MAX_SECONDS); Counter++)
+	{
+		Seconds = (Seconds * 10) + (Line[Counter] - ZERO_ASCII);
+	}
+
+	/* Milliseconds After The Point */
+	if ((Counter < Length) && (Line[Counter] == '.'))
+	{
+		for (Counter++; (Counter < Length) && (Line[Counter] >= '0') && (Line[Counter] <= '9') && (Decimals < 3u); Counter++, Decimals++)
+		{
+			Fraction = (Fraction * 10) + (Line[Counter] - ZERO_ASCII);
+		}
+	}
+
+	for (; Decimals < 3u; Decimals++)
+	{
+		Fraction *= 10;
+	}
+
+	if ((0u == Length) || (Counter != Length) || (Seconds > DURATION_MAX_SECONDS) ||
+		(((Seconds * 1000u) + Fraction) > TIMERS_MAX_DURATION))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		*Milliseconds = (Seconds * 1000u) + Fraction;
+	}
+
+	return Error_State;
+}
+
+/*==============================================================================================================================================
+ *@fn      : void ShowTimers(void)
+ *@brief  :  This Function Is Responsible For Listing The Countdowns & The Stopwatch On The Terminal & Showing The Stopwatch On The LCD ,
+ *			 Or The Nearest Countdown While The Stopwatch Is Cleared
+ *@retval void :
+ *==============================================================================================================================================*/
+static void ShowTimers(void)
+{
+	uint32_t Remaining = 0, Nearest = 0, Stopwatch = 0;
+
+	uint16_t TimerId = 0, NearestId = TIMERS_COUNTDOWNS;
+
+	uint8_t Running = 0;
+
+	for (TimerId = 0; TimerId < TIMERS_COUNTDOWNS; TimerId++)
+	{
+		if (OK == Timers_Remaining(TimerId, &Remaining))
+		{
+			USART_SendStringPolling(UART_2, "Countdown ");
+			SendNumber(TimerId + 1u);
+			USART_SendStringPolling(UART_2, ": ");
+			SendDuration(Remaining);
+			SendNew_Line();
+
+			if ((TIMERS_COUNTDOWNS == NearestId) || (Remaining < Nearest))
+			{
+				NearestId = TimerId;
+				Nearest = Remaining;
+			}
+		}
+		else if (CountdownsDone & (1uL << TimerId))
+		{
+			USART_SendStringPolling(UART_2, "Countdown ");
+			SendNumber(TimerId + 1u);
+			USART_SendStringPolling(UART_2, ": Done\n");
+		}
+	}
+
+	Stopwatch = Timers_StopwatchRead(&Running);
+
+	USART_SendStringPolling(UART_2, Running ? "Stopwatch ( Running ): " : "Stopwatch: ");
+	SendDuration(Stopwatch);
+	SendNew_Line();
+
+	if ((0u == Stopwatch) && (TIMERS_COUNTDOWNS != NearestId))
+	{
+		SendTimerFrame((uint8_t)(NearestId + 1u), Nearest);
+	}
+	else
+	{
+		SendTimerFrame(0, Stopwatch);
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void SendDuration(uint32_t Milliseconds)
+ *@brief  :  This Function Is Responsible For Sending a Duration To The Terminal As H:MM:SS.mmm
+ *@paramter[in]  : uint32_t Milliseconds : Duration In ms
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SendDuration(uint32_t Milliseconds)
+{
+	uint32_t Seconds = Milliseconds / 1000u;
+
+	SendNumber((uint16_t)(Seconds / CALENDAR_SECONDS_PER_HOUR));
+	UART_voidTransmitData(UART_CONFIG, ':');
+	SendDigits((Seconds % CALENDAR_SECONDS_PER_HOUR) / CALENDAR_SECONDS_PER_MINUTE, 2);
+	UART_voidTransmitData(UART_CONFIG, ':');
+	SendDigits(Seconds % CALENDAR_SECONDS_PER_MINUTE, 2);
+	UART_voidTransmitData(UART_CONFIG, '.');
+	SendDigits(Milliseconds % 1000u, 3);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void SendDigits(uint32_t Number, uint8_t Width)
+ *@brief  :  This Function Is Responsible For Sending The Lowest Width Decimal Digits Of a Number To The Terminal , Zero Padded
+ *@paramter[in]  : uint32_t Number : Number To Be Sent
+ *@paramter[in]  : uint8_t Width : Number Of Digits
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SendDigits(uint32_t Number, uint8_t Width)
+{
+	uint32_t Divisor = 1;
+
+	uint8_t Counter = 0;
+
+	for (Counter = 1; Counter < Width; Counter++)
+	{
+		Divisor *= 10;
+	}
+
+	while (Divisor > 0)
+	{
+		UART_voidTransmitData(UART_CONFIG, ((Number / Divisor) % 10) + ZERO_ASCII);
+		Divisor /= 10;
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void SendTimerFrame(uint8_t Number, uint32_t Milliseconds)
+ *@brief  :  This Function Is Responsible For Sending a Timer Reading To The Blue Pill LCD
+ *@paramter[in]  : uint8_t Number : Countdown Number , 0 For The Stopwatch
+ *@paramter[in]  : uint32_t Milliseconds : Time In ms
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SendTimerFrame(uint8_t Number, uint32_t Milliseconds)
+{
+	uint32_t Seconds = Milliseconds / 1000u, Hours = Seconds / CALENDAR_SECONDS_PER_HOUR;
+
+	/* Timer Frame Sent To The Blue Pill LCD , Built Here So The Countdown Call Back Does Not Share It */
+	uint8_t TimerFrame[TIMER_FRAME_SIZE] = {0};
+
+	TimerFrame[0] = TIMER_CODE;
+	TimerFrame[TIMER_FRAME_NUMBER_POS] = Number;
+
+	/* Hours Above 255 Are Shown As 255 */
+	TimerFrame[TIMER_FRAME_HOURS_POS] = (Hours > 0xFFu) ? 0xFFu : (uint8_t)Hours;
+	TimerFrame[TIMER_FRAME_MINUTES_POS] = (uint8_t)((Seconds % CALENDAR_SECONDS_PER_HOUR) / CALENDAR_SECONDS_PER_MINUTE);
+	TimerFrame[TIMER_FRAME_SECONDS_POS] = (uint8_t)(Seconds % CALENDAR_SECONDS_PER_MINUTE);
+	TimerFrame[TIMER_FRAME_MS_HIGH_POS] = (uint8_t)((Milliseconds % 1000u) >> 8);
+	TimerFrame[TIMER_FRAME_MS_LOW_POS] = (uint8_t)(Milliseconds % 1000u);
+
+	/* Same Path As Displaying Date & Time */
+	SendFrame(SPI_FRAME_TIMER, TimerFrame);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void CountdownDone(uint16_t TimerId)
+ *@brief  :  This Function Is The Call Back Of The Countdowns , Shows The Ended Countdown On The LCD & Rings The Bell
+ *@paramter[in]  : uint16_t TimerId : Id Of The Ended Countdown
+ *@retval void :
+ *==============================================================================================================================================*/
+static void CountdownDone(uint16_t TimerId)
+{
+	/* Runs From PendSV , The Terminal Is Left To The Console Task & Shows It In The Timers List */
+	CountdownsDone |= (1uL << TimerId);
+
+	SendTimerFrame((uint8_t)(TimerId + 1u), 0);
+
+	AlarmBell_Ring(COUNTDOWN_BEEPS);
+}
+
+/*==============================================================================================================================================
+ *@fn      : Error_State_t NextAlarmDeadline(const AlarmPool_Record_t *Record, uint32_t Now, uint32_t *Deadline)
+ *@brief  :  This Function Is Responsible For Getting The First Time After Now An Alarm Is Due At By Its Recurrence Rule
+ *@paramter[in]  : const AlarmPool_Record_t *Record : Alarm Record
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds , An Alarm At This Exact Second Is Not Returned
+ *@paramter[out] : uint32_t *Deadline : Deadline In Epoch Seconds
+ *@retval Error_State_t : NOK If The Rule Never Matches Again
+ *==============================================================================================================================================*/
+static Error_State_t NextAlarmDeadline(const AlarmPool_Record_t *Record, uint32_t Now, uint32_t *Deadline)
+{
+	return Recurrence_Next(&Record->Rule, ALARM_SECOND_OF_DAY(Record->Time), Now, Deadline);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void RebuildAlarms(uint32_t From, uint32_t Now)
+ *@brief  :  This Function Is Responsible For Queueing All Enabled Alarms By Their First Deadline After From , Firing Those Already Due
+ *			 At Now & Arming The Nearest Remaining One
+ *@paramter[in]  : uint32_t From : Time To Search Deadlines After In Epoch Seconds
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds
+ *@retval void :
+ *@note    : Called From Tasks Only , The Queue Is Never Changed By Interrupts So No Lock Is Taken
+ *==============================================================================================================================================*/
+static void RebuildAlarms(uint32_t From, uint32_t Now)
+{
+	AlarmPool_Record_t *Record = NULL;
+
+	uint32_t Deadline = 0;
+
+	uint16_t AlarmId = 0;
+
+	AlarmQueue_Clear(&AlarmDeadlines);
+
+	for (AlarmId = 0; AlarmId < ALARMPOOL_MAX_ALARMS; AlarmId++)
+	{
+		Record = AlarmPool_Get(AlarmId);
+
+		if (NULL != Record)
+		{
+			/* Rings & Snoozes Belonged To The Old Time */
+			Record->State = ALARMPOOL_STATE_IDLE;
+			Record->Rings = 0;
+
+			/* Alarms Whose Rule Never Matches Again Are Not Queued */
+			if ((Record->Flags & ALARMPOOL_FLAG_ENABLED) && (OK == NextAlarmDeadline(Record, From, &Deadline)))
+			{
+				AlarmQueue_Add(&AlarmDeadlines, AlarmId, Deadline);
+			}
+		}
+	}
+
+	/* Also Arms The Next Deadline , A Past One Would Never Match The RTC Hardware Alarm */
+	AlarmsDue(Now);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void ArmNextAlarm(void)
+ *@brief  :  This Function Is Responsible For Arming One Timer At The Nearest Deadline Of The Alarm Queue , The RTC Hardware Alarm
+ *			 If The RTC Has One , Otherwise The Soft Clock Deadline
+ *@retval void :
+ *@note    : Called From Tasks Only
+ *==============================================================================================================================================*/
+static void ArmNextAlarm(void)
+{
+	/* Variable To Store The Programmed Alarm Time */
+	DS1307_Config_t AlarmClock = {0};
+
+	uint32_t Deadline = 0;
+
+	uint16_t AlarmId = 0;
+
+	Error_State_t Queued = AlarmQueue_Peek(&AlarmDeadlines, &AlarmId, &Deadline);
+
+	if (RTC_HasHardwareAlarm())
+	{
+		if (OK == Queued)
+		{
+			Calendar_FromEpoch(Deadline, &AlarmClock);
+			AlarmClock.Mode = HwAlarmMode;
+
+			/* Queued Write , Does Not Wait For The Bus */
+			RTC_SetAlarm_IT(I2C_CONFIG, &AlarmClock);
+		}
+		else
+		{
+			/* No Alarms , Disable The Interrupt & Release The Pin */
+			RTC_SetAlarm_IT(I2C_CONFIG, NULL);
+		}
+	}
+	else
+	{
+		if (OK == Queued)
+		{
+			SoftClock_SetDeadline(Deadline, &AlarmDeadline);
+		}
+		else
+		{
+			SoftClock_SetDeadline(0, NULL);
+		}
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmsDue(uint32_t Now)
+ *@brief  :  This Function Is Responsible For Handling Every Queued Deadline At Or Before Now By The Alarm State ( Fire , Ring Again ,
+ *			 Snooze , Give Up Or Finish An Acknowledged Alarm ) & Arming The Timer For The Nearest One
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds
+ *@retval void :
+ *@note    : Runs As The Alarm Task , Posted By The Soft Clock Deadline
+ *==============================================================================================================================================*/
+static void AlarmsDue(uint32_t Now)
+{
+	AlarmPool_Record_t *Record = NULL;
+
+	uint32_t Deadline = 0;
+
+	uint16_t AlarmId = 0;
+
+	AlarmsNow = Now;
+
+	/* Alarms Set To The Same Time Fire Together , Only Due Alarms Are Visited , Deadlines Passed Meanwhile
+	 * ( Busy Console Task , Stuck Bus ) Fire Late If Within The Tolerance & Are Skipped Otherwise */
+	while ((OK == AlarmQueue_Peek(&AlarmDeadlines, &AlarmId, &Deadline)) && (Deadline <= Now))
+	{
+		Record = AlarmPool_Get(AlarmId);
+
+		switch (Record->State)
+		{
+		case ALARMPOOL_STATE_IDLE:
+
+			if ((Now - Deadline) <= ALARM_LATE_TOLERANCE)
+			{
+				Record->State = ALARMPOOL_STATE_ACTIVE;
+				Record->Rings = 0;
+
+				RingAlarm(AlarmId, Record, Now);
+			}
+			else
+			{
+				FinishAlarm(AlarmId, Record, Now);
+			}
+			break;
+
+		case ALARMPOOL_STATE_ACTIVE:
+
+			/* Not Acknowledged Since The Last Ring */
+			if (Record->Rings >= ALARM_MAX_RINGS)
+			{
+				FinishAlarm(AlarmId, Record, Now);
+			}
+			else if (0u == (Record->Rings % ALARM_RINGS_PER_SNOOZE))
+			{
+				Record->State = ALARMPOOL_STATE_SNOOZED;
+				AlarmQueue_Add(&AlarmDeadlines, AlarmId, Now + ALARM_SNOOZE_TIME);
+			}
+			else
+			{
+				RingAlarm(AlarmId, Record, Now);
+			}
+			break;
+
+		case ALARMPOOL_STATE_SNOOZED:
+
+			Record->State = ALARMPOOL_STATE_ACTIVE;
+
+			RingAlarm(AlarmId, Record, Now);
+			break;
+
+		default:
+
+			/* Acknowledged */
+			FinishAlarm(AlarmId, Record, Now);
+			break;
+		}
+	}
+
+	ArmNextAlarm();
+}
+
+/*==============================================================================================================================================
+ *@fn      : void RingAlarm(uint16_t AlarmId, AlarmPool_Record_t *Record, uint32_t Now)
+ *@brief  :  This Function Is Responsible For Ringing an Active Alarm With One More Beep Every ( ALARM_RINGS_PER_SNOOZE ) Rings &
+ *			 Queueing Its Next Ring
+ *@paramter[in]  : uint16_t AlarmId : Id Of The Alarm
+ *@paramter[in]  : AlarmPool_Record_t *Record : Record Of The Alarm
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds
+ *@retval void :
+ *==============================================================================================================================================*/
+static void RingAlarm(uint16_t AlarmId, AlarmPool_Record_t *Record, uint32_t Now)
+{
+	Record->Rings++;
+
+	FireAlarm(AlarmId, (uint8_t)(1u + ((Record->Rings - 1u) / ALARM_RINGS_PER_SNOOZE)));
+
+	AlarmQueue_Add(&AlarmDeadlines, AlarmId, Now + ALARM_RING_PERIOD);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void FinishAlarm(uint16_t AlarmId, AlarmPool_Record_t *Record, uint32_t Now)
+ *@brief  :  This Function Is Responsible For Returning an Alarm To Idle & Queueing It At Its Next Deadline After Now , a One Shot
+ *			 Alarm Is Disabled & Removed From The Queue
+ *@paramter[in]  : uint16_t AlarmId : Id Of The Alarm
+ *@paramter[in]  : AlarmPool_Record_t *Record : Record Of The Alarm
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds
+ *@retval void :
+ *==============================================================================================================================================*/
+static void FinishAlarm(uint16_t AlarmId, AlarmPool_Record_t *Record, uint32_t Now)
+{
+	uint32_t Deadline = 0;
+
+	Record->State = ALARMPOOL_STATE_IDLE;
+	Record->Rings = 0;
+
+	if (Record->Flags & ALARMPOOL_FLAG_ONCE)
+	{
+		Record->Flags &= ~ALARMPOOL_FLAG_ENABLED;
+
+		/* The Stored Record Would Come Back Enabled After a Reset , The Second Task Clears It */
+		if (AlarmId < ALARMSTORE_MAX_ALARMS)
+		{
+			AlarmsToSave |= (uint8_t)(1u << AlarmId);
+		}
+	}
+
+	if ((Record->Flags & ALARMPOOL_FLAG_ENABLED) && (OK == NextAlarmDeadline(Record, Now, &Deadline)))
+	{
+		AlarmQueue_Add(&AlarmDeadlines, AlarmId, Deadline);
+	}
+	else
+	{
+		AlarmQueue_Remove(&AlarmDeadlines, AlarmId);
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmButton_ISR(void)
+ *@brief  :  This Function Is The EXTI Call Back Of The User Button , Posts The Button Event
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmButton_ISR(void)
+{
+	/* Bounces Post The Event Again , Acknowledging Twice Changes Nothing */
+	Scheduler_Post(SCHEDULER_EVENT_BUTTON, 0);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmButtonDue(uint32_t Arg)
+ *@brief  :  This Function Is The Button Task , Acknowledges The Ringing Alarms
+ *@paramter[in]  : uint32_t Arg : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmButtonDue(uint32_t Arg)
+{
+	(void)Arg;
+
+	AcknowledgeAlarms();
+}
+
+/*==============================================================================================================================================
+ *@fn      : void HwAlarm_ISR(void)
+ *@brief  :  This Function Is The EXTI Call Back Of The RTC INT Pin , Posts The Alarm Event
+ *@retval void :
+ *==============================================================================================================================================*/
+static void HwAlarm_ISR(void)
+{
+	/* Only The Event Is Posted , The Alarms Are Handled By The Alarm Task */
+	Scheduler_Post(SCHEDULER_EVENT_ALARM_DUE, ALARM_DUE_RTC_MATCH);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void HwAlarmDue(void)
+ *@brief  :  This Function Is Responsible For Firing The Alarms Matched By The RTC INT Pin & Programming The Next One
+ *@retval void :
+ *==============================================================================================================================================*/
+static void HwAlarmDue(void)
+{
+	uint32_t Deadline = 0;
+
+	uint16_t AlarmId = 0;
+
+	DS1307_Config_t Now;
+
+	if (OK == AlarmQueue_Peek(&AlarmDeadlines, &AlarmId, &Deadline))
+	{
+		/* The Month Is Not Matched , The Pin May Fire Before The Deadline So Only The Alarms Due By The RTC Time Are Fired */
+		if (OK != RTC_ReadDateTime(I2C_CONFIG, &Now))
+		{
+			SoftClock_GetTime(&Now);
+		}
+		AlarmsDue(Calendar_ToEpoch(&Now));
+	}
+	else
+	{
+		/* No Alarm Was Programmed , Release The Pin */
+		RTC_SetAlarm_IT(I2C_CONFIG, NULL);
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void ScheduleAlarm(uint16_t AlarmId)
+ *@brief  :  This Function Is Responsible For Moving One Changed Alarm In The Alarm Queue & Arming The Nearest Deadline
+ *@paramter[in]  : uint16_t AlarmId : Id Of The Changed Alarm , Removed From The Queue If Freed Or Disabled
+ *@retval void :
+ *==============================================================================================================================================*/
+static void ScheduleAlarm(uint16_t AlarmId)
+{
+	/* Variable To Store The Current Time */
+	DS1307_Config_t Now;
+
+	AlarmPool_Record_t *Record = AlarmPool_Get(AlarmId);
+
+	uint32_t Deadline = 0;
+
+	SoftClock_GetTime(&Now);
+
+	/* A Changed Alarm Starts Again From Its New Time */
+	if (NULL != Record)
+	{
+		Record->State = ALARMPOOL_STATE_IDLE;
+		Record->Rings = 0;
+	}
+
+	if ((NULL != Record) && (Record->Flags & ALARMPOOL_FLAG_ENABLED) &&
+		(OK == NextAlarmDeadline(Record, Calendar_ToEpoch(&Now), &Deadline)))
+	{
+		AlarmQueue_Add(&AlarmDeadlines, AlarmId, Deadline);
+	}
+	else
+	{
+		AlarmQueue_Remove(&AlarmDeadlines, AlarmId);
+	}
+
+	ArmNextAlarm();
+}
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmDeadline(uint32_t Now)
+ *@brief  :  This Function Is The Soft Clock Deadline Call Back , Posts The Alarm Event
+ *@paramter[in]  : uint32_t Now : Current Time In Epoch Seconds
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmDeadline(uint32_t Now)
+{
+	/* A Lost Post Is Tried Again Next Second , The Deadline Is Cleared Once Reached */
+	if (OK != Scheduler_Post(SCHEDULER_EVENT_ALARM_DUE, Now))
+	{
+		SoftClock_SetDeadline(Now + 1u, &AlarmDeadline);
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void AlarmTask(uint32_t Now)
+ *@brief  :  This Function Is The Alarm Task , Handles The Due Alarms At Thread Level
+ *@paramter[in]  : uint32_t Now : Epoch Second Of The Soft Clock Deadline , ALARM_DUE_RTC_MATCH For The RTC INT Pin
+ *@retval void :
+ *==============================================================================================================================================*/
+static void AlarmTask(uint32_t Now)
+{
+	if (ALARM_DUE_RTC_MATCH == Now)
+	{
+		HwAlarmDue();
+	}
+	else
+	{
+		AlarmsDue(Now);
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void SecondTick(uint16_t TimerId)
+ *@brief  :  This Function Is The Call Back Of The Second Timer , Posts The Second Event
+ *@paramter[in]  : uint16_t TimerId : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SecondTick(uint16_t TimerId)
+{
+	(void)TimerId;
+
+	Scheduler_Post(SCHEDULER_EVENT_SECOND, 0);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void SecondTask(uint32_t Arg)
+ *@brief  :  This Function Is The Second Task , Saves The Changed Alarms , Refreshes The Time On The LCD & Checks The RTC Health
+ *@paramter[in]  : uint32_t Arg : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SecondTask(uint32_t Arg)
+{
+	DS1307_Config_t Now;
+
+	uint8_t Status = RTCHEALTH_OK;
+
+	(void)Arg;
+
+	if (0u != AlarmsToSave)
+	{
+		SaveAlarms();
+	}
+
+	/* Alarm & Timer Frames Stay On The LCD For a While */
+	if (DisplayHold > 0u)
+	{
+		DisplayHold--;
+	}
+	else if (DisplayRefresh)
+	{
+		Reading_Time();
+		SendFrame(SPI_FRAME_TIME, ReadingArr);
+	}
+
+	/* Periodic RTC Check , The Time In RAM Replaces a Lost RTC Time */
+	if (++RtcCheckSeconds >= RTC_CHECK_PERIOD)
+	{
+		RtcCheckSeconds = 0;
+
+		SoftClock_GetTime(&Now);
+		RtcHealth_Check(I2C_CONFIG, &Now, &Status);
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void SaveAlarms(void)
+ *@brief  :  This Function Is Responsible For Writing The Alarms Changed From The Console Or Finished To The RTC Battery Backed RAM
+ *@retval void :
+ *@note    : Records Not Written Are Tried Again Next Second
+ *==============================================================================================================================================*/
+static void SaveAlarms(void)
+{
+	AlarmPool_Record_t *Record = NULL;
+
+	AlarmStore_Record_t Stored;
+
+	uint8_t AlarmId = 0;
+
+	for (AlarmId = 0; AlarmId < ALARMSTORE_MAX_ALARMS; AlarmId++)
+	{
+		if (AlarmsToSave & (1u << AlarmId))
+		{
+			Record = AlarmPool_Get(AlarmId);
+
+			/* Only Enabled Alarms Are Kept , Freed & Disabled ( Finished One Shot ) Alarms Are Cleared */
+			if ((NULL != Record) && (Record->Flags & ALARMPOOL_FLAG_ENABLED))
+			{
+				Stored.Time[0] = Record->Time[0];
+				Stored.Time[1] = Record->Time[1];
+				Stored.Time[2] = Record->Time[2];
+				Stored.Weekdays = Record->Rule.Weekdays;
+				Stored.IntervalMinutes = Record->Rule.IntervalMinutes;
+				Stored.Flags = Record->Flags;
+			}
+			else
+			{
+				Stored.Time[0] = ALARMSTORE_EMPTY;
+				Stored.Time[1] = ALARMSTORE_EMPTY;
+				Stored.Time[2] = ALARMSTORE_EMPTY;
+				Stored.Weekdays = ALARMSTORE_EMPTY;
+				Stored.IntervalMinutes = ALARMSTORE_EMPTY;
+				Stored.Flags = ALARMSTORE_EMPTY;
+			}
+
+			if (OK == AlarmStore_Save(AlarmId, &Stored))
+			{
+				AlarmsToSave &= (uint8_t)~(1u << AlarmId);
+			}
+		}
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void SendFrame(uint8_t Frame, const uint8_t *Data)
+ *@brief  :  This Function Is Responsible For Queuing a Copy Of a Frame To The Blue Pill & Starting It If The SPI Is Free
+ *@paramter[in]  : uint8_t Frame : Frame Kind ( SPI_FRAME_xxx )
+ *@paramter[in]  : const uint8_t *Data : Frame Bytes , Free To Change Once This Function Returns
+ *@retval void :
+ *@note    : Safe From Tasks & Interrupts , One Frame Of Each Kind Waits At Most
+ *==============================================================================================================================================*/
+static void SendFrame(uint8_t Frame, const uint8_t *Data)
+{
+	uint32_t PriMask = 0;
+
+	uint8_t Counter = 0;
+
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	/* A Waiting Frame Of The Same Kind Is Replaced , The Frame Being Sent Is Never Touched */
+	for (Counter = 0; Counter < SpiFrameSize[Frame]; Counter++)
+	{
+		SpiFrameQueued[Frame][Counter] = Data[Counter];
+	}
+
+	SpiPending |= (uint8_t)(1u << Frame);
+
+	if ((SPI_FRAME_ALARM == Frame) || (SPI_FRAME_TIMER == Frame))
+	{
+		DisplayHold = DISPLAY_HOLD_TIME;
+	}
+
+	if (SPI_FRAME_NONE == SpiSending)
+	{
+		StartNextFrame();
+	}
+
+	EXIT_CRITICAL_SECTION(PriMask);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void StartNextFrame(void)
+ *@brief  :  This Function Is Responsible For Sending The Waiting Frame Of The Lowest Kind , Alarms First
+ *@retval void :
+ *@note    : Called With Interrupts Masked Or From The SPI Interrupt
+ *==============================================================================================================================================*/
+static void StartNextFrame(void)
+{
+	uint8_t Frame = 0, Counter = 0;
+
+	SpiSending = SPI_FRAME_NONE;
+
+	for (Frame = 0; (Frame < SPI_FRAMES) && (SPI_FRAME_NONE == SpiSending); Frame++)
+	{
+		if (SpiPending & (1u << Frame))
+		{
+			SpiPending &= (uint8_t)~(1u << Frame);
+			SpiSending = Frame;
+
+			/* The SPI Is Free , So The Sent Copy Can Be Written */
+			for (Counter = 0; Counter < SpiFrameSize[Frame]; Counter++)
+			{
+				SpiFrameSent[Counter] = SpiFrameQueued[Frame][Counter];
+			}
+
+			if (SPI_FRAME_ALARM == Frame)
+			{
+				AlarmBeeps = AlarmBeepsQueued;
+			}
+
+			SPI_Transmit_IT(SPI_CONFIG, SpiFrameSent, SpiFrameSize[Frame], &SPI_CALL_BACK);
+		}
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void SpiDoneTask(uint32_t Frame)
+ *@brief  :  This Function Is The SPI Done Task , Rings The Bell After an Alarm Frame & Starts The Next Frame
+ *@paramter[in]  : uint32_t Frame : Kind Of The Sent Frame
+ *@retval void :
+ *==============================================================================================================================================*/
+static void SpiDoneTask(uint32_t Frame)
+{
+	uint32_t PriMask = 0;
+
+	/* Notify The Blue Pill That The Alarm Is Fired , The Pulses Are Timed By SysTick */
+	if (SPI_FRAME_ALARM == Frame)
+	{
+		AlarmBell_Ring(AlarmBeeps);
+	}
+
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	StartNextFrame();
+
+	EXIT_CRITICAL_SECTION(PriMask);
+}
+
+/*==============================================================================================================================================
+ *@fn      : void Console_ISR(uint16_t Data)
+ *@brief  :  This Function Is The USART2 Receive Call Back , Buffers The Byte & Posts The Console Event
+ *@paramter[in]  : uint16_t Data : Received Byte
+ *@retval void :
+ *==============================================================================================================================================*/
+static void Console_ISR(uint16_t Data)
+{
+	/* Bytes Typed While The Buffer Is Full Are Lost */
+	if ((uint8_t)(ConsoleHead - ConsoleTail) < CONSOLE_BUFFER_SIZE)
+	{
+		ConsoleBuffer[ConsoleHead & CONSOLE_INDEX_MASK] = (uint8_t)Data;
+		ConsoleHead++;
+
+		if (!ConsolePosted)
+		{
+			ConsolePosted = (OK == Scheduler_Post(SCHEDULER_EVENT_UART_RX, 0));
+		}
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void Console_Task(uint32_t Arg)
+ *@brief  :  This Function Is The Console Task , Runs The Console Handler Till The Typed Input Is Read
+ *@paramter[in]  : uint32_t Arg : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void Console_Task(uint32_t Arg)
+{
+	(void)Arg;
+
+	/* Bytes Typed From Now Post a New Event */
+	ConsolePosted = 0;
+
+	while (Console_Pending() && (NULL != ConsoleHandler))
+	{
+		ConsoleHandler();
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void Console_Delay(uint32_t Milliseconds)
+ *@brief  :  This Function Is Responsible For Waiting While Other Tasks Run
+ *@paramter[in]  : uint32_t Milliseconds : Time To Wait In ms
+ *@retval void :
+ *==============================================================================================================================================*/
+static void Console_Delay(uint32_t Milliseconds)
+{
+	uint64_t Deadline = TimeBase_Deadline(Milliseconds * 1000u);
+
+	while (!TimeBase_Expired(Deadline))
+	{
+		Scheduler_Yield();
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void I2C_Poll(uint16_t TimerId)
+ *@brief  :  This Function Is The Call Back Of The I2C Timer , Aborts The Transfers That Exceeded Their Timeout
+ *@paramter[in]  : uint16_t TimerId : Not Used
+ *@retval void :
+ *@note    : Runs At PendSV Priority , The Bus Recovery Busy Waits Up To About 10 ms So It Is Posted To I2C_RecoveryTask
+ *==============================================================================================================================================*/
+static void I2C_Poll(uint16_t TimerId)
+{
+	(void)TimerId;
+
+	if (I2C_Process_Timeouts() && !I2CRecoveryPosted)
+	{
+		I2CRecoveryPosted = (OK == Scheduler_Post(SCHEDULER_EVENT_I2C_RECOVERY, 0));
+	}
+}
+
+/*==============================================================================================================================================
+ *@fn      : void I2C_RecoveryTask(uint32_t Arg)
+ *@brief  :  This Function Is The I2C Recovery Task , Recovers The Bus After An Aborted Transfer & Restarts Its Queue
+ *@paramter[in]  : uint32_t Arg : Not Used
+ *@retval void :
+ *==============================================================================================================================================*/
+static void I2C_RecoveryTask(uint32_t Arg)
+{
+	(void)Arg;
+
+	/* An Abort From Now Posts a New Event */
+	I2CRecoveryPosted = 0;
+
+	I2C_Process_Recovery();
 }
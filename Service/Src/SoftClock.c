@@ -0,0 +1,390 @@
+/*
+ ******************************************************************************
+ * @file           : SoftClock.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Software Clock Synchronized By The RTC Square Wave
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/EXTI_Interface.h"
+#include "../../Drivers/Inc/SYSCFG_Interface.h"
+#include "../../Drivers/Inc/I2C_Interface.h"
+
+#include "../../HAL/Inc/DS1307_Interface.h"
+#include "../../HAL/Inc/RTC_Interface.h"
+
+#include "../Inc/SoftClock.h"
+#include "../Inc/SoftClock_Private.h"
+#include "../Inc/RtcHealth.h"
+#include "../Inc/Calendar.h"
+#include "../Inc/Deferred.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Current Date & Time , Advanced Every SQW Falling Edge */
+static volatile DS1307_Config_t SoftClock_Time;
+
+/* I2C Configurations of The RTC */
+static I2C_Configs_t *SoftClock_I2C = NULL;
+
+/* Seconds Since The Last Resync */
+static uint16_t SoftClock_SecondsSinceSync = 0;
+
+/* BCD Time Registers Read By The Resync */
+static uint8_t SoftClock_Readings[DS1307_RECEIVE_ARR_SIZE] = {0};
+
+/* Set When The RTC INT Pin Carries The Hardware Alarm , The Time is Read From The RTC Then */
+static uint8_t SoftClock_Direct = 0;
+
+/* Set When The RTC Must be Written With The Time in RAM ( After a Correction or an Invalid Reading ) */
+static volatile uint8_t SoftClock_WritePending = 0;
+
+/* BCD Registers Written by The Correction , Sent From The I2C Interrupt */
+static uint8_t SoftClock_WriteArr[DS1307_WRITE_ARR_SIZE] = {0};
+
+/* One Shot Deadline in Epoch Seconds & its Call Back , NULL When Disarmed */
+static uint32_t SoftClock_Deadline = 0;
+static void (*volatile SoftClock_DeadlineCallBack)(uint32_t Now) = NULL;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_Init
+ * @brief			:	Load The Time From The RTC , Enable its 1 HZ Square Wave & Route it to EXTI
+ * 						to Keep The Time in RAM
+ * @param			:	I2C Configurations of The RTC
+ * @retval			:	Error State
+ * ======================================================================================*/
+Error_State_t SoftClock_Init(I2C_Configs_t *I2CConfig)
+{
+	Error_State_t Error_State = OK;
+
+	DS1307_Config_t Time;
+
+	uint32_t PriMask = 0;
+
+	if (NULL == I2CConfig)
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		SoftClock_I2C = I2CConfig;
+		SoftClock_Direct = RTC_HasHardwareAlarm();
+
+		/* Load The Time Before The First Edge */
+		Error_State = RTC_ReadDateTime(I2CConfig, &Time);
+
+		if (OK == Error_State)
+		{
+			ENTER_CRITICAL_SECTION(PriMask);
+
+			SoftClock_Time = Time;
+			SoftClock_SecondsSinceSync = 0;
+
+			EXIT_CRITICAL_SECTION(PriMask);
+		}
+		else
+		{
+			/* Let The First Edge Retry The Reading */
+			SoftClock_SecondsSinceSync = SOFTCLOCK_RESYNC_PERIOD;
+		}
+
+		if (SoftClock_Direct)
+		{
+			/* The Pin is Left to The Alarm Interrupt , No Square Wave Ticks */
+		}
+		else
+		{
+			/* Route SQW Pin to EXTI , Seconds Register is Updated on The Falling Edge */
+			SYSFG_voidSetEXTIPort((EXTI_t)SOFTCLOCK_SQW_LINE, SOFTCLOCK_SQW_PORT);
+			EXTI_voidSetCallBack(SOFTCLOCK_SQW_LINE, &SoftClock_Tick);
+			EXTI_voidSetTriggerSelection(SOFTCLOCK_SQW_LINE, FALLING_TRG);
+			EXTI_voidEnableEXTI(SOFTCLOCK_SQW_LINE);
+
+			/* Start The 1 HZ Square Wave , Report The First Error */
+			if (OK == Error_State)
+			{
+				Error_State = RTC_EnableSquareWave(I2CConfig, DS1307_SQW_1HZ);
+			}
+			else
+			{
+				RTC_EnableSquareWave(I2CConfig, DS1307_SQW_1HZ);
+			}
+		}
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_GetTime
+ * @brief			:	Get The Current Date & Time From RAM Without Accessing The RTC
+ * @param			:	Structure to Copy The Time in
+ * @retval			:	void
+ * ======================================================================================*/
+void SoftClock_GetTime(DS1307_Config_t *Time)
+{
+	DS1307_Config_t RtcTime;
+
+	uint32_t PriMask = 0;
+
+	if (NULL != Time)
+	{
+		/* No Ticks Advance The RAM Time , Refresh it From The RTC & Keep The Last Time If The Reading Failed */
+		if (SoftClock_Direct && (OK == RTC_ReadDateTime(SoftClock_I2C, &RtcTime)))
+		{
+			ENTER_CRITICAL_SECTION(PriMask);
+
+			SoftClock_Time = RtcTime;
+
+			EXIT_CRITICAL_SECTION(PriMask);
+		}
+
+		/* Copy With The Tick Blocked So All Fields Belong to The Same Second */
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		*Time = SoftClock_Time;
+
+		EXIT_CRITICAL_SECTION(PriMask);
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_SetTime
+ * @brief			:	Write Date & Time to The RTC & Update The Time in RAM
+ * @param			:	New Date & Time
+ * @retval			:	Error State ( Time in RAM is Not Changed If The RTC Write Failed )
+ * ======================================================================================*/
+Error_State_t SoftClock_SetTime(const DS1307_Config_t *Time)
+{
+	Error_State_t Error_State = OK;
+
+	DS1307_HOUR_MODE_t Mode = DS1307_24H_MODE;
+
+	uint32_t PriMask = 0;
+
+	if ((NULL == Time) || (NULL == SoftClock_I2C))
+	{
+		Error_State = Null_Pointer;
+	}
+	else
+	{
+		/* Only Changed Registers Are Written , If The Seconds Are Written The RTC Second Restarts
+		   So The Next Edge is One Second Later */
+		Error_State = RTC_UpdateDateTime(SoftClock_I2C, Time);
+
+		if (OK == Error_State)
+		{
+			ENTER_CRITICAL_SECTION(PriMask);
+
+			/* The RTC Keeps its Hours Format , Corrections Are Written Back in it */
+			Mode = SoftClock_Time.Mode;
+			SoftClock_Time = *Time;
+			SoftClock_Time.Mode = Mode;
+			SoftClock_SecondsSinceSync = 0;
+			SoftClock_WritePending = 0;
+
+			EXIT_CRITICAL_SECTION(PriMask);
+
+			RtcHealth_ClearStale();
+		}
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_SetDeadline
+ * @brief			:	Arm a One Shot Call Back For The First Second at or After a Deadline
+ * @param			:	Deadline in Epoch Seconds
+ * @param			:	Call Back , Called From PendSV After The Tick With The Current Epoch Seconds ,
+ * 						NULL to Disarm
+ * @retval			:	void
+ * ======================================================================================*/
+void SoftClock_SetDeadline(uint32_t Deadline, void (*CallBack)(uint32_t Now))
+{
+	uint32_t PriMask = 0;
+
+	/* Both Are Changed Together So The Tick Never Sees a Half Armed Deadline */
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	SoftClock_Deadline = Deadline;
+	SoftClock_DeadlineCallBack = CallBack;
+
+	EXIT_CRITICAL_SECTION(PriMask);
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_Tick
+ * @brief			:	EXTI Call Back of The 1 HZ Square Wave , Advance The Time One Second & Start a Resync
+ * 						Reading Every ( SOFTCLOCK_RESYNC_PERIOD )
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void SoftClock_Tick(void)
+{
+	SoftClock_Increment((DS1307_Config_t *)&SoftClock_Time);
+
+	/* The Rest of The Second is Not Time Critical , Leave it to PendSV */
+	Deferred_Post(&SoftClock_Second, 0);
+}
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_Second
+ * @brief			:	Deferred Work of Each Tick , Call The Due Deadline , Abort a Stuck RTC Transfer &
+ * 						Start The RTC Correction Write or The Resync Reading
+ * @param			:	Not Used
+ * @retval			:	void
+ * ======================================================================================*/
+static void SoftClock_Second(uint32_t Arg)
+{
+	void (*CallBack)(uint32_t Now) = NULL;
+
+	DS1307_Config_t Time;
+
+	uint32_t Now = 0, PriMask = 0;
+
+	(void)Arg;
+
+	/* Ticks Preempt This Work , Use One Consistent Copy */
+	SoftClock_GetTime(&Time);
+
+	/* Nothing is Compared While No Deadline is Armed */
+	if (NULL != SoftClock_DeadlineCallBack)
+	{
+		Now = Calendar_ToEpoch(&Time);
+
+		/* Taken With The Tick Blocked So a Deadline Armed Meanwhile is Not Lost */
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		if (Now >= SoftClock_Deadline)
+		{
+			/* One Shot , The Call Back May Arm The Next Deadline */
+			CallBack = SoftClock_DeadlineCallBack;
+			SoftClock_DeadlineCallBack = NULL;
+		}
+
+		EXIT_CRITICAL_SECTION(PriMask);
+
+		if (NULL != CallBack)
+		{
+			CallBack(Now);
+		}
+	}
+
+	if (SoftClock_WritePending)
+	{
+		/* Copy The Corrected Time to The RTC Right After its Update , If The Bus is Busy Try Next Second */
+		if (OK == RTC_WriteDateTime_IT(SoftClock_I2C, &Time, SoftClock_WriteArr, NULL))
+		{
+			SoftClock_WritePending = 0;
+			SoftClock_SecondsSinceSync = 0;
+		}
+	}
+	else if (SoftClock_SecondsSinceSync < SOFTCLOCK_RESYNC_PERIOD)
+	{
+		SoftClock_SecondsSinceSync++;
+	}
+	else
+	{
+		/* Read The RTC Right After its Update , If The Bus is Busy Try Next Second */
+		if (OK == RTC_ReadRegisters_DMA(SoftClock_I2C, DS1307_FIRST_LOC, SoftClock_Readings, DS1307_RECEIVE_ARR_SIZE, &SoftClock_ResyncDone))
+		{
+			SoftClock_SecondsSinceSync = 0;
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_ResyncDone
+ * @brief			:	I2C Call Back of The Resync Reading , Replaces The Time in RAM With The RTC Time
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void SoftClock_ResyncDone(void)
+{
+	DS1307_Config_t Time;
+
+	/* Keep The RAM Time If The Reading Failed or a Correction Was Made After it Started */
+	if ((OK == I2C_Get_Transfer_Status(SoftClock_I2C->I2C_Num)) && !SoftClock_WritePending)
+	{
+		if (OK == RTC_CheckReadings(SoftClock_Readings))
+		{
+			RTC_BCDToDateTime(SoftClock_Readings, &Time);
+			SoftClock_Time = Time;
+		}
+		else
+		{
+			/* RTC Registers Corrupted , Restore Them From RAM */
+			SoftClock_WritePending = 1;
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	SoftClock_Increment
+ * @brief			:	Advance Date & Time One Second
+ * @param			:	Date & Time to Advance
+ * @retval			:	void
+ * ======================================================================================*/
+static void SoftClock_Increment(DS1307_Config_t *Time)
+{
+	/* Each Field Rolls Over Only When The Previous One Did */
+	Time->Seconds++;
+
+	if (Time->Seconds > MAX_SECONDS)
+	{
+		Time->Seconds = 0;
+		Time->Minutes++;
+
+		if (Time->Minutes > MAX_MINUTES)
+		{
+			Time->Minutes = 0;
+			Time->Hours++;
+
+			if (Time->Hours > MAX_HOURS)
+			{
+				Time->Hours = 0;
+				Time->Date++;
+
+				/* New Day of The Week */
+				Time->Day = (Time->Day % SOFTCLOCK_DAYS_IN_WEEK) + 1;
+
+				/* Month Read From a Corrupted RTC is Treated as January */
+				if ((Time->Month < 1) || (Time->Month > MAX_MONTH))
+				{
+					Time->Month = 1;
+				}
+
+				if (Time->Date > Calendar_DaysInMonth(Time->Month, Time->Year))
+				{
+					Time->Date = 1;
+					Time->Month++;
+
+					if (Time->Month > MAX_MONTH)
+					{
+						Time->Month = 1;
+						Time->Year = (Time->Year + 1) % (MAX_YEAR + 1);
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,286 @@
+/*
+ ******************************************************************************
+ * @file           : StringArena.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Interned Strings Arena
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../Inc/StringArena.h"
+#include "../Inc/StringArena_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Strings With Their Headers , Appended at ( StringArena_Used ) */
+static uint8_t StringArena_Bytes[STRINGARENA_SIZE];
+
+static uint16_t StringArena_Used = 0;
+
+/* Handle is The Index of The String Entry */
+static StringArena_Entry_t StringArena_Table[STRINGARENA_MAX_STRINGS] = {0};
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Init
+ * @brief			:	Release All Strings & Empty The Arena
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void StringArena_Init(void)
+{
+	uint16_t Counter = 0;
+
+	for (Counter = 0; Counter < STRINGARENA_MAX_STRINGS; Counter++)
+	{
+		StringArena_Table[Counter].References = 0;
+	}
+	StringArena_Used = 0;
+}
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Intern
+ * @brief			:	Get a Handle of a String , Equal Strings Share One Copy in The Arena
+ * @param			:	String Bytes ( Not Terminated )
+ * @param			:	Length of The String ( 1 - 255 )
+ * @param			:	Returns Handle of The String
+ * @retval			:	Error State ( NOK If The Arena or The Strings Table is Full )
+ * ======================================================================================*/
+Error_State_t StringArena_Intern(const uint8_t *String, uint8_t Length, uint16_t *Handle)
+{
+	Error_State_t Error_State = OK;
+
+	uint16_t Found = STRINGARENA_NO_STRING, Counter = 0;
+
+	uint8_t Hash = 0, *Header = NULL;
+
+	if ((NULL == String) || (NULL == Handle))
+	{
+		Error_State = Null_Pointer;
+	}
+	else if (0u == Length)
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		Hash = StringArena_Hash(String, Length);
+
+		Found = StringArena_Find(String, Length, Hash);
+
+		if (STRINGARENA_NO_STRING != Found)
+		{
+			/* Already Held , Share it */
+			StringArena_Table[Found].References++;
+		}
+		else
+		{
+			/* Released Bytes Are Only Reclaimed When The New String Does Not Fit */
+			if ((StringArena_Used + STRINGARENA_HEADER_SIZE + Length) > STRINGARENA_SIZE)
+			{
+				StringArena_Compact();
+			}
+
+			for (Counter = 0; (Counter < STRINGARENA_MAX_STRINGS) && (STRINGARENA_NO_STRING == Found); Counter++)
+			{
+				if (0u == StringArena_Table[Counter].References)
+				{
+					Found = Counter;
+				}
+			}
+
+			if ((STRINGARENA_NO_STRING == Found) || ((StringArena_Used + STRINGARENA_HEADER_SIZE + Length) > STRINGARENA_SIZE))
+			{
+				Found = STRINGARENA_NO_STRING;
+				Error_State = NOK;
+			}
+			else
+			{
+				Header = &StringArena_Bytes[StringArena_Used];
+
+				Header[STRINGARENA_HEADER_LENGTH] = Length;
+				Header[STRINGARENA_HEADER_OWNER_L] = (uint8_t)Found;
+				Header[STRINGARENA_HEADER_OWNER_H] = (uint8_t)(Found >> 8);
+
+				StringArena_Used += STRINGARENA_HEADER_SIZE;
+
+				StringArena_Table[Found].Offset = StringArena_Used;
+				StringArena_Table[Found].References = 1;
+				StringArena_Table[Found].Length = Length;
+				StringArena_Table[Found].Hash = Hash;
+
+				for (Counter = 0; Counter < Length; Counter++)
+				{
+					StringArena_Bytes[StringArena_Used++] = String[Counter];
+				}
+			}
+		}
+
+		*Handle = Found;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Release
+ * @brief			:	Drop One Reference of a String , The String is Freed With The Last Reference
+ * @param			:	Handle of The String , ( STRINGARENA_NO_STRING ) is Ignored
+ * @retval			:	void
+ * ======================================================================================*/
+void StringArena_Release(uint16_t Handle)
+{
+	uint8_t *Header = NULL;
+
+	if ((Handle < STRINGARENA_MAX_STRINGS) && (StringArena_Table[Handle].References > 0u))
+	{
+		StringArena_Table[Handle].References--;
+
+		if (0u == StringArena_Table[Handle].References)
+		{
+			/* The Entry May be Reused Before Compaction , Unlink The Bytes From it */
+			Header = &StringArena_Bytes[StringArena_Table[Handle].Offset - STRINGARENA_HEADER_SIZE];
+
+			Header[STRINGARENA_HEADER_OWNER_L] = (uint8_t)STRINGARENA_NO_STRING;
+			Header[STRINGARENA_HEADER_OWNER_H] = (uint8_t)(STRINGARENA_NO_STRING >> 8);
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Get
+ * @brief			:	Get The Bytes of a String
+ * @param			:	Handle of The String
+ * @param			:	Returns Pointer to The String Bytes in The Arena
+ * @param			:	Returns Length of The String
+ * @retval			:	Error State ( NOK If The Handle is Not Held )
+ * ======================================================================================*/
+Error_State_t StringArena_Get(uint16_t Handle, const uint8_t **String, uint8_t *Length)
+{
+	Error_State_t Error_State = OK;
+
+	if ((NULL == String) || (NULL == Length))
+	{
+		Error_State = Null_Pointer;
+	}
+	else if ((Handle >= STRINGARENA_MAX_STRINGS) || (0u == StringArena_Table[Handle].References))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		*String = &StringArena_Bytes[StringArena_Table[Handle].Offset];
+		*Length = StringArena_Table[Handle].Length;
+	}
+	return Error_State;
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Hash
+ * @brief			:	8 Bits Hash of a String
+ * @param			:	String Bytes
+ * @param			:	Length of The String
+ * @retval			:	Hash
+ * ======================================================================================*/
+static uint8_t StringArena_Hash(const uint8_t *String, uint8_t Length)
+{
+	uint8_t Hash = Length, Counter = 0;
+
+	for (Counter = 0; Counter < Length; Counter++)
+	{
+		Hash = (uint8_t)((Hash << 3) | (Hash >> 5)) ^ String[Counter];
+	}
+
+	return Hash;
+}
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Find
+ * @brief			:	Search The Held Strings For an Equal One
+ * @param			:	String Bytes
+ * @param			:	Length of The String
+ * @param			:	Hash of The String
+ * @retval			:	Handle of The Equal String or ( STRINGARENA_NO_STRING )
+ * ======================================================================================*/
+static uint16_t StringArena_Find(const uint8_t *String, uint8_t Length, uint8_t Hash)
+{
+	uint16_t Found = STRINGARENA_NO_STRING, Counter = 0;
+
+	const uint8_t *Held = NULL;
+
+	uint8_t Index = 0;
+
+	for (Counter = 0; (Counter < STRINGARENA_MAX_STRINGS) && (STRINGARENA_NO_STRING == Found); Counter++)
+	{
+		/* Bytes Are Compared Only If Length & Hash Match */
+		if ((StringArena_Table[Counter].References > 0u) && (StringArena_Table[Counter].Length == Length) &&
+			(StringArena_Table[Counter].Hash == Hash))
+		{
+			Held = &StringArena_Bytes[StringArena_Table[Counter].Offset];
+
+			for (Index = 0; (Index < Length) && (Held[Index] == String[Index]); Index++)
+			{
+			}
+
+			if (Index == Length)
+			{
+				Found = Counter;
+			}
+		}
+	}
+
+	return Found;
+}
+
+/*=======================================================================================
+ * @fn		 		:	StringArena_Compact
+ * @brief			:	Move The Held Strings to The Arena Start Keeping Their Order & Handles
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void StringArena_Compact(void)
+{
+	uint16_t Read = 0, Write = 0, Owner = 0, Size = 0, Counter = 0;
+
+	while (Read < StringArena_Used)
+	{
+		Size = STRINGARENA_HEADER_SIZE + StringArena_Bytes[Read + STRINGARENA_HEADER_LENGTH];
+
+		Owner = (uint16_t)StringArena_Bytes[Read + STRINGARENA_HEADER_OWNER_L] |
+				((uint16_t)StringArena_Bytes[Read + STRINGARENA_HEADER_OWNER_H] << 8);
+
+		if (STRINGARENA_NO_STRING != Owner)
+		{
+			/* Write Never Passes Read , Copying Forward is Safe */
+			for (Counter = 0; Counter < Size; Counter++)
+			{
+				StringArena_Bytes[Write + Counter] = StringArena_Bytes[Read + Counter];
+			}
+
+			StringArena_Table[Owner].Offset = Write + STRINGARENA_HEADER_SIZE;
+
+			Write += Size;
+		}
+
+		Read += Size;
+	}
+
+	StringArena_Used = Write;
+}
@@ -0,0 +1,198 @@
+/*
+ ******************************************************************************
+ * @file           : TimeBase.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Monotonic 64 Bit Time Base , Delays & Timeouts
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../../Drivers/Inc/SYSTICK_Interface.h"
+
+#include "../Inc/TimeBase.h"
+#include "../Inc/TimeBase_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+static volatile uint64_t TimeBase_Ticks = 0;
+
+/* Cycles Since TimeBase_Init Up to The Last Tick & The Cycle Counter Value at That Tick */
+static volatile uint64_t TimeBase_Cycles = 0;
+static volatile uint32_t TimeBase_LastCycle = 0;
+
+static void (*volatile TimeBase_CallBack)(void) = NULL;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Init
+ * @brief			:	Start The DWT Cycle Counter & The SysTick Millisecond Tick
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void TimeBase_Init(void)
+{
+	uint32_t PriMask = 0;
+
+	DEMCR |= (1 << DEMCR_TRCENA);
+	DWT->CTRL |= (1 << DWT_CTRL_CYCCNTENA);
+
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	TimeBase_Ticks = 0;
+	TimeBase_Cycles = 0;
+	TimeBase_LastCycle = DWT->CYCCNT;
+
+	EXIT_CRITICAL_SECTION(PriMask);
+
+	SYSTICK_voidSetINT(TIMEBASE_TICK_MS, SYSTICK_CLOCK_AHB_DIVIDEDBY8, &TimeBase_Tick);
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_SetTickCallBack
+ * @brief			:	Set The Function Called From The SysTick Interrupt After Each Tick
+ * @param			:	Call Back , NULL Removes it
+ * @retval			:	void
+ * ======================================================================================*/
+void TimeBase_SetTickCallBack(void (*CallBack)(void))
+{
+	TimeBase_CallBack = CallBack;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Millis
+ * @brief			:	SysTick Ticks Since TimeBase_Init in ms
+ * @param			:	void
+ * @retval			:	Millisecond Count , Never Wraps
+ * ======================================================================================*/
+uint64_t TimeBase_Millis(void)
+{
+	uint64_t Millis = 0;
+
+	uint32_t PriMask = 0;
+
+	/* 64 Bit Reads Take Two Loads , The Tick Must Not Come Between Them */
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	Millis = TimeBase_Ticks * TIMEBASE_TICK_MS;
+
+	EXIT_CRITICAL_SECTION(PriMask);
+
+	return Millis;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Micros
+ * @brief			:	Time Since TimeBase_Init in us
+ * @param			:	void
+ * @retval			:	Microsecond Count , Never Wraps & Never Goes Back
+ * ======================================================================================*/
+uint64_t TimeBase_Micros(void)
+{
+	uint64_t Cycles = 0;
+
+	uint32_t PriMask = 0;
+
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	/* Cycles Past The Last Tick Are Added Whatever The Tick Delay , The Counter Wraps Once in 268 s at 16 MHz */
+	Cycles = TimeBase_Cycles + (uint32_t)(DWT->CYCCNT - TimeBase_LastCycle);
+
+	EXIT_CRITICAL_SECTION(PriMask);
+
+	return Cycles / TIMEBASE_HCLK_MHZ;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Deadline
+ * @brief			:	Time Base Value a Timeout Expires at
+ * @param			:	Timeout in us
+ * @retval			:	Deadline in us , Checked By TimeBase_Expired
+ * ======================================================================================*/
+uint64_t TimeBase_Deadline(uint32_t Timeout_us)
+{
+	return TimeBase_Micros() + Timeout_us;
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Expired
+ * @brief			:	Check a Deadline Set By TimeBase_Deadline
+ * @param			:	Deadline in us
+ * @retval			:	1 If The Deadline Has Passed , 0 If Not
+ * ======================================================================================*/
+uint8_t TimeBase_Expired(uint64_t Deadline)
+{
+	return (TimeBase_Micros() >= Deadline);
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_DelayUs
+ * @brief			:	Busy Wait on The Time Base
+ * @param			:	Time in us
+ * @retval			:	void
+ * ======================================================================================*/
+void TimeBase_DelayUs(uint32_t Time_us)
+{
+	uint64_t Deadline = TimeBase_Deadline(Time_us);
+
+	while (!TimeBase_Expired(Deadline));
+}
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_DelayMs
+ * @brief			:	Busy Wait on The Time Base
+ * @param			:	Time in ms
+ * @retval			:	void
+ * ======================================================================================*/
+void TimeBase_DelayMs(uint32_t Time_ms)
+{
+	uint64_t Deadline = TimeBase_Micros() + ((uint64_t)Time_ms * 1000u);
+
+	while (!TimeBase_Expired(Deadline));
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	TimeBase_Tick
+ * @brief			:	SysTick Call Back , Advances The Millisecond Count , Extends The Cycle Count &
+ * 						Calls The Registered Tick Call Back
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void TimeBase_Tick(void)
+{
+	uint32_t PriMask = 0, Now = 0;
+
+	/* Higher Priority Interrupts Reading The Time Must See Both Counts Updated */
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	Now = DWT->CYCCNT;
+
+	TimeBase_Ticks++;
+
+	TimeBase_Cycles += (uint32_t)(Now - TimeBase_LastCycle);
+	TimeBase_LastCycle = Now;
+
+	EXIT_CRITICAL_SECTION(PriMask);
+
+	if (NULL != TimeBase_CallBack)
+	{
+		TimeBase_CallBack();
+	}
+}
@@ -0,0 +1,484 @@
+/*
+ ******************************************************************************
+ * @file           : Timers.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Millisecond Timing Wheel Timers & Stopwatch
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+
+#include "../../Library/ErrTypes.h"
+#include "../../Library/STM32F446xx.h"
+
+#include "../Inc/Deferred.h"
+#include "../Inc/TimeBase.h"
+#include "../Inc/Timers.h"
+#include "../Inc/Timers_Private.h"
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+static Timers_Timer_t Timers_Table[TIMERS_MAX];
+
+/* First Timer of Each Slot List & of The Expired List */
+static uint16_t Timers_Heads[TIMERS_LISTS];
+
+/* Last Processed Tick , Slots Up to it Are Empty */
+static volatile uint32_t Timers_Now = 0;
+
+/* Set While The Expiry Work is Posted & Not Finished */
+static volatile uint8_t Timers_Posted = 0;
+
+/* Stopwatch Time Before The Last Start & Millisecond Count at The Last Start */
+static uint32_t Timers_StopwatchElapsed = 0;
+static uint32_t Timers_StopwatchBase = 0;
+static uint8_t Timers_StopwatchRunning = 0;
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Init
+ * @brief			:	Stop All Timers & Hook The Wheel to The Time Base Tick
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void Timers_Init(void)
+{
+	uint32_t PriMask = 0;
+
+	uint16_t Counter = 0;
+
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	for (Counter = 0; Counter < TIMERS_LISTS; Counter++)
+	{
+		Timers_Heads[Counter] = TIMERS_LIST_END;
+	}
+
+	for (Counter = 0; Counter < TIMERS_MAX; Counter++)
+	{
+		Timers_Table[Counter].List = TIMERS_NOT_RUNNING;
+	}
+
+	EXIT_CRITICAL_SECTION(PriMask);
+
+	TimeBase_SetTickCallBack(&Timers_Tick);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Millis
+ * @brief			:	Milliseconds Since Timers_Init , Wraps After 49 Days
+ * @param			:	void
+ * @retval			:	Millisecond Count
+ * ======================================================================================*/
+uint32_t Timers_Millis(void)
+{
+	return Timers_Now;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Start
+ * @brief			:	Start a One Shot Timer or Restart a Running One
+ * @param			:	Timer Id ( 0 - TIMERS_MAX - 1 )
+ * @param			:	Duration in ms ( 0 - TIMERS_MAX_DURATION )
+ * @param			:	Call Back , Called From PendSV With The Timer Id Once The Duration Passes
+ * @retval			:	Error State ( NOK If The Id or The Duration is Out of Range )
+ * ======================================================================================*/
+Error_State_t Timers_Start(uint16_t TimerId, uint32_t Duration, void (*CallBack)(uint16_t TimerId))
+{
+	return Timers_Arm(TimerId, Duration, 0, CallBack);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_StartPeriodic
+ * @brief			:	Start a Periodic Timer or Restart a Running One
+ * @param			:	Timer Id ( 0 - TIMERS_MAX - 1 )
+ * @param			:	Period in ms ( 1 - TIMERS_MAX_DURATION ) , The First Call Back Comes After One Period
+ * @param			:	Call Back , Called From PendSV With The Timer Id Every Period
+ * @retval			:	Error State ( NOK If The Id or The Period is Out of Range )
+ * ======================================================================================*/
+Error_State_t Timers_StartPeriodic(uint16_t TimerId, uint32_t Period, void (*CallBack)(uint16_t TimerId))
+{
+	Error_State_t Error_State = NOK;
+
+	if (Period > 0u)
+	{
+		Error_State = Timers_Arm(TimerId, Period, Period, CallBack);
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Stop
+ * @brief			:	Stop a Running Timer Without Calling its Call Back
+ * @param			:	Timer Id
+ * @retval			:	Error State ( NOK If The Timer is Not Running )
+ * ======================================================================================*/
+Error_State_t Timers_Stop(uint16_t TimerId)
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t PriMask = 0;
+
+	ENTER_CRITICAL_SECTION(PriMask);
+
+	if ((TimerId >= TIMERS_MAX) || (TIMERS_NOT_RUNNING == Timers_Table[TimerId].List))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		Timers_Unlink(TimerId);
+	}
+
+	EXIT_CRITICAL_SECTION(PriMask);
+
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Remaining
+ * @brief			:	Time Left Before a Running Timer Expires
+ * @param			:	Timer Id
+ * @param			:	Returns Time Left in ms
+ * @retval			:	Error State ( NOK If The Timer is Not Running )
+ * ======================================================================================*/
+Error_State_t Timers_Remaining(uint16_t TimerId, uint32_t *Remaining)
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t PriMask = 0;
+
+	int32_t Left = 0;
+
+	if (NULL == Remaining)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if ((TimerId >= TIMERS_MAX) || (TIMERS_NOT_RUNNING == Timers_Table[TimerId].List))
+	{
+		*Remaining = 0;
+		Error_State = NOK;
+	}
+	else
+	{
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		Left = (int32_t)(Timers_Table[TimerId].Deadline - Timers_Now);
+
+		EXIT_CRITICAL_SECTION(PriMask);
+
+		/* Expired But Not Called Back Yet Counts as 0 */
+		*Remaining = (Left > 0) ? (uint32_t)Left : 0u;
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_StopwatchStart
+ * @brief			:	Start The Stopwatch or Resume it From The Time it Was Stopped at
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void Timers_StopwatchStart(void)
+{
+	if (!Timers_StopwatchRunning)
+	{
+		Timers_StopwatchBase = Timers_Now;
+		Timers_StopwatchRunning = 1;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_StopwatchStop
+ * @brief			:	Stop The Stopwatch Keeping its Time
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void Timers_StopwatchStop(void)
+{
+	if (Timers_StopwatchRunning)
+	{
+		Timers_StopwatchElapsed += Timers_Now - Timers_StopwatchBase;
+		Timers_StopwatchRunning = 0;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_StopwatchReset
+ * @brief			:	Clear The Stopwatch Time , a Running Stopwatch Keeps Running From 0
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+void Timers_StopwatchReset(void)
+{
+	Timers_StopwatchElapsed = 0;
+	Timers_StopwatchBase = Timers_Now;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_StopwatchRead
+ * @brief			:	Stopwatch Time
+ * @param			:	Returns 1 If The Stopwatch is Running , 0 If Not , May be NULL
+ * @retval			:	Time in ms
+ * ======================================================================================*/
+uint32_t Timers_StopwatchRead(uint8_t *Running)
+{
+	uint32_t Elapsed = Timers_StopwatchElapsed;
+
+	/* Only The Time Since The Last Start is Counted Live */
+	if (Timers_StopwatchRunning)
+	{
+		Elapsed += Timers_Now - Timers_StopwatchBase;
+	}
+
+	if (NULL != Running)
+	{
+		*Running = Timers_StopwatchRunning;
+	}
+	return Elapsed;
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Arm
+ * @brief			:	Start a Timer With a Deadline Period After Now
+ * @param			:	Timer Id
+ * @param			:	Duration in ms
+ * @param			:	Period in ms , 0 For a One Shot Timer
+ * @param			:	Call Back
+ * @retval			:	Error State ( NOK If The Id or The Duration is Out of Range )
+ * ======================================================================================*/
+static Error_State_t Timers_Arm(uint16_t TimerId, uint32_t Duration, uint32_t Period, void (*CallBack)(uint16_t TimerId))
+{
+	Error_State_t Error_State = OK;
+
+	uint32_t PriMask = 0;
+
+	if (NULL == CallBack)
+	{
+		Error_State = Null_Pointer;
+	}
+	else if ((TimerId >= TIMERS_MAX) || (Duration > TIMERS_MAX_DURATION))
+	{
+		Error_State = NOK;
+	}
+	else
+	{
+		/* The Tick & The Expiry Work Also Move Timers */
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		if (TIMERS_NOT_RUNNING != Timers_Table[TimerId].List)
+		{
+			Timers_Unlink(TimerId);
+		}
+
+		Timers_Table[TimerId].CallBack = CallBack;
+		Timers_Table[TimerId].Period = Period;
+		Timers_Table[TimerId].Deadline = Timers_Now + Duration;
+
+		Timers_Place(TimerId, Timers_Now + 1u);
+
+		EXIT_CRITICAL_SECTION(PriMask);
+	}
+	return Error_State;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Place
+ * @brief			:	Put a Timer in The Slot of its Deadline , The Nearer The Deadline The Lower The Level ,
+ * 						a Passed Deadline Goes to The Expired List
+ * @param			:	Timer Id
+ * @param			:	The Next Tick to be Processed
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timers_Place(uint16_t TimerId, uint32_t NextTick)
+{
+	uint32_t Deadline = Timers_Table[TimerId].Deadline;
+
+	/* Distance From The Next Tick , a Passed Deadline is Negative */
+	uint32_t Distance = Deadline - NextTick;
+
+	uint8_t Level = 0;
+
+	if ((int32_t)Distance < 0)
+	{
+		Timers_Link(TimerId, TIMERS_EXPIRED_LIST);
+
+		/* A Full Work Queue is Retried by The Next Tick */
+		if (!Timers_Posted && (OK == Deferred_Post(&Timers_Due, 0)))
+		{
+			Timers_Posted = 1;
+		}
+	}
+	else
+	{
+		/* Lowest Level Whose Slots Reach The Deadline Before Wrapping */
+		while ((Level < (TIMERS_WHEEL_LEVELS - 1u)) && (Distance >= (1uL << ((Level + 1u) * TIMERS_WHEEL_BITS))))
+		{
+			Level++;
+		}
+
+		Timers_Link(TimerId, TIMERS_SLOT(Level, Deadline));
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Link
+ * @brief			:	Add a Timer to The Front of a List
+ * @param			:	Timer Id
+ * @param			:	List Index
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timers_Link(uint16_t TimerId, uint16_t List)
+{
+	Timers_Timer_t *Timer = &Timers_Table[TimerId];
+
+	Timer->List = List;
+	Timer->Previous = TIMERS_LIST_END;
+	Timer->Next = Timers_Heads[List];
+
+	if (TIMERS_LIST_END != Timer->Next)
+	{
+		Timers_Table[Timer->Next].Previous = TimerId;
+	}
+	Timers_Heads[List] = TimerId;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Unlink
+ * @brief			:	Remove a Timer From its List
+ * @param			:	Timer Id
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timers_Unlink(uint16_t TimerId)
+{
+	Timers_Timer_t *Timer = &Timers_Table[TimerId];
+
+	if (TIMERS_LIST_END != Timer->Previous)
+	{
+		Timers_Table[Timer->Previous].Next = Timer->Next;
+	}
+	else
+	{
+		Timers_Heads[Timer->List] = Timer->Next;
+	}
+
+	if (TIMERS_LIST_END != Timer->Next)
+	{
+		Timers_Table[Timer->Next].Previous = Timer->Previous;
+	}
+	Timer->List = TIMERS_NOT_RUNNING;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Tick
+ * @brief			:	Time Base Tick Call Back , Advances The Millisecond Count , Moves The Timers of a Higher Level Slot Down
+ * 						Once Every 256 Ticks of The Level Below & Posts The Expiry Work If The Current Slot Has Timers
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timers_Tick(void)
+{
+	uint32_t Now = Timers_Now + TIMERS_TICK_MS;
+
+	uint16_t TimerId = 0, List = 0;
+
+	uint8_t Level = 0;
+
+	/* Each Level Slot Reached Spreads its Timers Over The Levels Below , a Slot Wrapping to 0 Reaches The Level Above Too */
+	for (Level = 1; (Level < TIMERS_WHEEL_LEVELS) && (0u == ((Now >> ((Level - 1u) * TIMERS_WHEEL_BITS)) & TIMERS_WHEEL_MASK)); Level++)
+	{
+		List = TIMERS_SLOT(Level, Now);
+
+		while (TIMERS_LIST_END != Timers_Heads[List])
+		{
+			TimerId = Timers_Heads[List];
+
+			Timers_Unlink(TimerId);
+			Timers_Place(TimerId, Now);
+		}
+	}
+
+	/* Only Timers Due Now Are in The Current Slot */
+	List = TIMERS_SLOT(0, Now);
+
+	while (TIMERS_LIST_END != Timers_Heads[List])
+	{
+		TimerId = Timers_Heads[List];
+
+		Timers_Unlink(TimerId);
+		Timers_Link(TimerId, TIMERS_EXPIRED_LIST);
+	}
+
+	Timers_Now = Now;
+
+	if (!Timers_Posted && (TIMERS_LIST_END != Timers_Heads[TIMERS_EXPIRED_LIST]) && (OK == Deferred_Post(&Timers_Due, 0)))
+	{
+		Timers_Posted = 1;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Timers_Due
+ * @brief			:	Deferred Work , Calls Back Every Expired Timer & Starts a Periodic One Again
+ * @param			:	Not Used
+ * @retval			:	void
+ * ======================================================================================*/
+static void Timers_Due(uint32_t Arg)
+{
+	void (*CallBack)(uint16_t TimerId) = NULL;
+
+	uint32_t PriMask = 0;
+
+	uint16_t TimerId = 0;
+
+	(void)Arg;
+
+	do
+	{
+		CallBack = NULL;
+
+		/* One Timer is Taken at a Time , Call Backs Run Unlocked & May Start or Stop Timers */
+		ENTER_CRITICAL_SECTION(PriMask);
+
+		TimerId = Timers_Heads[TIMERS_EXPIRED_LIST];
+
+		if (TIMERS_LIST_END != TimerId)
+		{
+			CallBack = Timers_Table[TimerId].CallBack;
+
+			Timers_Unlink(TimerId);
+
+			/* Counted From The Last Deadline , a Period Already Passed Expires Again at Once */
+			if (Timers_Table[TimerId].Period > 0u)
+			{
+				Timers_Table[TimerId].Deadline += Timers_Table[TimerId].Period;
+				Timers_Place(TimerId, Timers_Now + 1u);
+			}
+		}
+		else
+		{
+			Timers_Posted = 0;
+		}
+
+		EXIT_CRITICAL_SECTION(PriMask);
+
+		if (NULL != CallBack)
+		{
+			CallBack(TimerId);
+		}
+	} while (NULL != CallBack);
+}
@@ -0,0 +1,253 @@
+/*
+ ******************************************************************************
+ * @file           : AlarmQueue_Bench.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Benchmark of The Alarm Queue Heap With Thousands of Alarms Against a Linear Scan of The Deadlines
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "../Library/ErrTypes.h"
+
+#include "../Service/Inc/AlarmQueue.h"
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Alarms Queued Together */
+#define BENCH_ALARMS 5000u
+
+/* Random Deadline Moves , Removes & Nearest Deadline Lookups Timed */
+#define BENCH_OPERATIONS 1000000u
+
+/* Deadlines Are Spread Over One Year From The Start Time */
+#define BENCH_START_TIME 1700000000u
+#define BENCH_DEADLINE_SPAN (366u * 86400u)
+
+/* Reference Mark of an Alarm Not Queued */
+#define BENCH_NOT_QUEUED 0xFFFFFFFFu
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+ALARMQUEUE_DEFINE(Bench_Queue, BENCH_ALARMS);
+
+/* Reference Deadline of Each Alarm , Searched Linearly */
+static uint32_t Bench_Deadlines[BENCH_ALARMS];
+
+static uint32_t Bench_Failures = 0;
+
+/* Lookup Results Are Stored Here So The Timed Loops Are Not Optimized Away */
+static volatile uint32_t Bench_Sink = 0;
+
+/* Random Generator State ( xorshift32 ) */
+static uint32_t Bench_Seed = 0x6D2B79F5u;
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Bench_Random
+ * @brief			:	Next Pseudo Random Number
+ * @param			:	void
+ * @retval			:	Random 32 Bits
+ * ======================================================================================*/
+static uint32_t Bench_Random(void)
+{
+	Bench_Seed ^= Bench_Seed << 13;
+	Bench_Seed ^= Bench_Seed >> 17;
+	Bench_Seed ^= Bench_Seed << 5;
+
+	return Bench_Seed;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_Nanoseconds
+ * @brief			:	Monotonic Time in ns
+ * @param			:	void
+ * @retval			:	Time in ns
+ * ======================================================================================*/
+static uint64_t Bench_Nanoseconds(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return ((uint64_t)Now.tv_sec * 1000000000u) + (uint64_t)Now.tv_nsec;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_RandomDeadline
+ * @brief			:	Random Deadline Within The Span
+ * @param			:	void
+ * @retval			:	Epoch Seconds
+ * ======================================================================================*/
+static uint32_t Bench_RandomDeadline(void)
+{
+	return BENCH_START_TIME + (Bench_Random() % BENCH_DEADLINE_SPAN);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_ScanNearest
+ * @brief			:	Nearest Reference Deadline , Every Alarm is Visited
+ * @param			:	Returns The Nearest Deadline
+ * @retval			:	Alarm Id , BENCH_ALARMS If No Alarm is Queued
+ * ======================================================================================*/
+static uint16_t Bench_ScanNearest(uint32_t *Deadline)
+{
+	uint16_t AlarmId = 0, Nearest = BENCH_ALARMS;
+
+	*Deadline = BENCH_NOT_QUEUED;
+
+	for (AlarmId = 0; AlarmId < BENCH_ALARMS; AlarmId++)
+	{
+		if (Bench_Deadlines[AlarmId] < *Deadline)
+		{
+			*Deadline = Bench_Deadlines[AlarmId];
+			Nearest = AlarmId;
+		}
+	}
+	return Nearest;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_Check
+ * @brief			:	Compare The Queue Head With The Reference Nearest Deadline
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void Bench_Check(void)
+{
+	uint32_t Deadline = 0, Expected = 0;
+
+	uint16_t AlarmId = 0;
+
+	Bench_ScanNearest(&Expected);
+
+	if (OK != AlarmQueue_Peek(&Bench_Queue, &AlarmId, &Deadline))
+	{
+		Deadline = BENCH_NOT_QUEUED;
+	}
+
+	/* Ids May Differ For Equal Deadlines , The Deadline Must Not */
+	if ((Deadline != Expected) || ((BENCH_NOT_QUEUED != Deadline) && (Bench_Deadlines[AlarmId] != Deadline)))
+	{
+		Bench_Failures++;
+	}
+}
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+int main(void)
+{
+	uint64_t Start = 0, AddTime = 0, MoveTime = 0, PeekTime = 0, ScanTime = 0, PopTime = 0;
+
+	uint32_t Counter = 0, Deadline = 0, Previous = 0;
+
+	uint16_t AlarmId = 0;
+
+	AlarmQueue_Clear(&Bench_Queue);
+
+	for (AlarmId = 0; AlarmId < BENCH_ALARMS; AlarmId++)
+	{
+		Bench_Deadlines[AlarmId] = Bench_RandomDeadline();
+	}
+
+	Start = Bench_Nanoseconds();
+
+	for (AlarmId = 0; AlarmId < BENCH_ALARMS; AlarmId++)
+	{
+		AlarmQueue_Add(&Bench_Queue, AlarmId, Bench_Deadlines[AlarmId]);
+	}
+
+	AddTime = Bench_Nanoseconds() - Start;
+
+	Bench_Check();
+
+	/* Edited & Deleted Alarms : a Queued Id is Moved , Every Eighth Operation Removes One Instead */
+	Start = Bench_Nanoseconds();
+
+	for (Counter = 0; Counter < BENCH_OPERATIONS; Counter++)
+	{
+		AlarmId = (uint16_t)(Bench_Random() % BENCH_ALARMS);
+
+		if (0u == (Counter & 7u))
+		{
+			AlarmQueue_Remove(&Bench_Queue, AlarmId);
+			Bench_Deadlines[AlarmId] = BENCH_NOT_QUEUED;
+		}
+		else
+		{
+			Bench_Deadlines[AlarmId] = Bench_RandomDeadline();
+			AlarmQueue_Add(&Bench_Queue, AlarmId, Bench_Deadlines[AlarmId]);
+		}
+	}
+
+	MoveTime = Bench_Nanoseconds() - Start;
+
+	Bench_Check();
+
+	/* Nearest Deadline Lookups , The Only Work Done Between Alarms */
+	Start = Bench_Nanoseconds();
+
+	for (Counter = 0; Counter < BENCH_OPERATIONS; Counter++)
+	{
+		AlarmQueue_Peek(&Bench_Queue, &AlarmId, &Deadline);
+		Bench_Sink = Deadline;
+	}
+
+	PeekTime = Bench_Nanoseconds() - Start;
+
+	Start = Bench_Nanoseconds();
+
+	for (Counter = 0; Counter < (BENCH_OPERATIONS / 100u); Counter++)
+	{
+		Bench_ScanNearest(&Deadline);
+		Bench_Sink = Deadline;
+	}
+
+	ScanTime = Bench_Nanoseconds() - Start;
+
+	/* Every Alarm Fires in Deadline Order */
+	Counter = AlarmQueue_Count(&Bench_Queue);
+
+	Start = Bench_Nanoseconds();
+
+	while (OK == AlarmQueue_Pop(&Bench_Queue, &AlarmId, &Deadline))
+	{
+		if ((Deadline < Previous) || (Bench_Deadlines[AlarmId] != Deadline))
+		{
+			Bench_Failures++;
+		}
+
+		Bench_Deadlines[AlarmId] = BENCH_NOT_QUEUED;
+		Previous = Deadline;
+	}
+
+	PopTime = Bench_Nanoseconds() - Start;
+
+	Bench_Check();
+
+	printf("AlarmQueue : %u Alarms , %u Operations , %lu Failures\n", BENCH_ALARMS, BENCH_OPERATIONS,
+		   (unsigned long)Bench_Failures);
+	printf("  Add          : %8.1f ns / Alarm\n", (double)AddTime / BENCH_ALARMS);
+	printf("  Move/Remove  : %8.1f ns / Operation\n", (double)MoveTime / BENCH_OPERATIONS);
+	printf("  Pop          : %8.1f ns / Alarm\n", (double)PopTime / ((0u == Counter) ? 1u : Counter));
+	printf("  Nearest Heap : %8.1f ns / Lookup\n", (double)PeekTime / BENCH_OPERATIONS);
+	printf("  Nearest Scan : %8.1f ns / Lookup\n", (double)ScanTime / (BENCH_OPERATIONS / 100u));
+
+	return (0u == Bench_Failures) ? 0 : 1;
+}
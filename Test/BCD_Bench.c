@@ -0,0 +1,320 @@
+/*
+ ******************************************************************************
+ * @file           : BCD_Bench.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Benchmark of The DS1307 Table BCD Codec Against The Previous Divide & Multiply Loops
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "../Library/ErrTypes.h"
+
+#include "../Drivers/Inc/I2C_Interface.h"
+
+#include "../HAL/Inc/DS1307_Interface.h"
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Random Date & Time Values Converted in Each Round */
+#define BENCH_SAMPLES 4096u
+
+/* Rounds Over All Samples That Are Timed */
+#define BENCH_ROUNDS 500u
+
+/* Register Addresses , Same as DS1307_Private.h */
+#define BENCH_SEC_ADD 0u
+#define BENCH_MIN_ADD 1u
+#define BENCH_HR_ADD 2u
+#define BENCH_DAY_ADD 3u
+#define BENCH_DATE_ADD 4u
+#define BENCH_MONTH_ADD 5u
+#define BENCH_YEAR_ADD 6u
+
+/* Previous Decoding of One Register */
+#define BENCH_BCD_TO_DEC(BCD) ((((BCD) >> 4) * 10) + ((BCD)&0x0F))
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+static DS1307_Config_t Bench_Times[BENCH_SAMPLES];
+
+/* Registers & Times Produced by Each Codec */
+static uint8_t Bench_TableRegisters[BENCH_SAMPLES][DS1307_WRITE_ARR_SIZE];
+static uint8_t Bench_LoopRegisters[BENCH_SAMPLES][DS1307_WRITE_ARR_SIZE];
+
+static DS1307_Config_t Bench_TableTimes[BENCH_SAMPLES];
+static DS1307_Config_t Bench_LoopTimes[BENCH_SAMPLES];
+
+static uint32_t Bench_Failures = 0;
+
+/* Random Generator State ( xorshift32 ) */
+static uint32_t Bench_Seed = 0x1B873593u;
+
+/* ========================================================================= *
+ *                       HOST STUBS OF THE I2C DRIVER                        *
+ * ========================================================================= */
+
+Error_State_t I2C_Wait_Transfer(I2C_I2C_NUMBER_t I2C_Num, uint16_t Timeout_ms)
+{
+	return OK;
+}
+
+Error_State_t I2C_Get_Transfer_Status(I2C_I2C_NUMBER_t I2C_Num)
+{
+	return OK;
+}
+
+Error_State_t I2C_Master_Transmit_IT(const I2C_Configs_t *I2C_Configs, uint8_t SlaveADD, const uint8_t *DataToSend,
+									 uint8_t data_Size, void (*I2C_CallBackFunc)(void))
+{
+	return NOK;
+}
+
+Error_State_t I2C_Master_Transfer_IT(const I2C_Configs_t *I2C_Configs, uint8_t SlaveADD, const uint8_t *TxData, uint8_t TxSize,
+									 uint8_t *RxData, uint8_t RxSize, void (*I2C_CallBackFunc)(void))
+{
+	return NOK;
+}
+
+Error_State_t I2C_Master_Transfer_DMA(const I2C_Configs_t *I2C_Configs, uint8_t SlaveADD, const uint8_t *TxData, uint8_t TxSize,
+									  uint8_t *RxData, uint8_t RxSize, void (*I2C_CallBackFunc)(void))
+{
+	return NOK;
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Bench_Random
+ * @brief			:	Next Pseudo Random Number
+ * @param			:	void
+ * @retval			:	Random 32 Bits
+ * ======================================================================================*/
+static uint32_t Bench_Random(void)
+{
+	Bench_Seed ^= Bench_Seed << 13;
+	Bench_Seed ^= Bench_Seed >> 17;
+	Bench_Seed ^= Bench_Seed << 5;
+
+	return Bench_Seed;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_Nanoseconds
+ * @brief			:	Monotonic Time in ns
+ * @param			:	void
+ * @retval			:	Time in ns
+ * ======================================================================================*/
+static uint64_t Bench_Nanoseconds(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return ((uint64_t)Now.tv_sec * 1000000000u) + (uint64_t)Now.tv_nsec;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_LoopEncode
+ * @brief			:	Previous Encoder , Two % 10 & / 10 Steps Per Register ( 24 Hours Mode Only )
+ * @param			:	Date & Time to Encode
+ * @param			:	Array of ( DS1307_WRITE_ARR_SIZE ) Bytes to Fill
+ * @retval			:	void
+ * ======================================================================================*/
+__attribute__((noinline)) static void Bench_LoopEncode(const DS1307_Config_t *Config, uint8_t *ConfigArr)
+{
+	uint8_t Values[DS1307_RECEIVE_ARR_SIZE];
+
+	uint8_t Variable = 0, Digit = 0, Counter = 0, Register = 0;
+
+	Values[BENCH_SEC_ADD] = Config->Seconds;
+	Values[BENCH_MIN_ADD] = Config->Minutes;
+	Values[BENCH_HR_ADD] = Config->Hours;
+	Values[BENCH_DAY_ADD] = Config->Day;
+	Values[BENCH_DATE_ADD] = Config->Date;
+	Values[BENCH_MONTH_ADD] = Config->Month;
+	Values[BENCH_YEAR_ADD] = Config->Year;
+
+	ConfigArr[DS1307_FIRST_LOC] = 0x00;
+
+	for (Register = BENCH_SEC_ADD; Register <= BENCH_YEAR_ADD; Register++)
+	{
+		Variable = Values[Register];
+
+		ConfigArr[Register + 1] = 0;
+
+		for (Counter = 0; Counter < 2; Counter++)
+		{
+			Digit = Variable % 10;
+			Variable = Variable / 10;
+
+			ConfigArr[Register + 1] |= Digit << (Counter * 4);
+		}
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_LoopDecode
+ * @brief			:	Previous Decoder , Shift , Mask & Multiply Per Register ( 24 Hours Mode Only )
+ * @param			:	( DS1307_RECEIVE_ARR_SIZE ) Registers
+ * @param			:	Structure to Fill
+ * @retval			:	void
+ * ======================================================================================*/
+__attribute__((noinline)) static void Bench_LoopDecode(const uint8_t *ReadingsArray, DS1307_Config_t *DateTime)
+{
+	DateTime->Seconds = BENCH_BCD_TO_DEC(ReadingsArray[BENCH_SEC_ADD] & 0x7F);
+	DateTime->Minutes = BENCH_BCD_TO_DEC(ReadingsArray[BENCH_MIN_ADD]);
+	DateTime->Hours = BENCH_BCD_TO_DEC(ReadingsArray[BENCH_HR_ADD]);
+	DateTime->Mode = DS1307_24H_MODE;
+	DateTime->Day = ReadingsArray[BENCH_DAY_ADD];
+	DateTime->Date = BENCH_BCD_TO_DEC(ReadingsArray[BENCH_DATE_ADD]);
+	DateTime->Month = BENCH_BCD_TO_DEC(ReadingsArray[BENCH_MONTH_ADD]);
+	DateTime->Year = BENCH_BCD_TO_DEC(ReadingsArray[BENCH_YEAR_ADD]);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_SameTime
+ * @brief			:	Compare Every Field of Two Date & Time Structures
+ * @param			:	First Structure
+ * @param			:	Second Structure
+ * @retval			:	1 If Equal , 0 Otherwise
+ * ======================================================================================*/
+static int Bench_SameTime(const DS1307_Config_t *First, const DS1307_Config_t *Second)
+{
+	return (First->Seconds == Second->Seconds) && (First->Minutes == Second->Minutes) && (First->Hours == Second->Hours) &&
+		   (First->Day == Second->Day) && (First->Date == Second->Date) && (First->Month == Second->Month) &&
+		   (First->Year == Second->Year) && (First->Mode == Second->Mode);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_Check12H
+ * @brief			:	Round Trip Every Hour Through The 12 Hours Register Format , Which The Loops Lack
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void Bench_Check12H(void)
+{
+	DS1307_Config_t Time = Bench_Times[0], Decoded;
+
+	uint8_t Registers[DS1307_WRITE_ARR_SIZE];
+
+	Time.Mode = DS1307_12H_MODE;
+
+	for (Time.Hours = 0; Time.Hours < 24u; Time.Hours++)
+	{
+		DS1307_DateTimetoBCD(&Time, Registers);
+		DS1307_BCDToDateTime(&Registers[1], &Decoded);
+
+		if (!Bench_SameTime(&Time, &Decoded))
+		{
+			Bench_Failures++;
+		}
+	}
+}
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+int main(void)
+{
+	uint64_t Start = 0, TableEncodeTime = 0, LoopEncodeTime = 0, TableDecodeTime = 0, LoopDecodeTime = 0;
+
+	uint32_t Round = 0, Sample = 0;
+
+	for (Sample = 0; Sample < BENCH_SAMPLES; Sample++)
+	{
+		Bench_Times[Sample].Seconds = (uint8_t)(Bench_Random() % 60u);
+		Bench_Times[Sample].Minutes = (uint8_t)(Bench_Random() % 60u);
+		Bench_Times[Sample].Hours = (uint8_t)(Bench_Random() % 24u);
+		Bench_Times[Sample].Day = (DS1307_DAYS_t)(DS1307_SUNDAY + (Bench_Random() % 7u));
+		Bench_Times[Sample].Date = (uint8_t)(1u + (Bench_Random() % 31u));
+		Bench_Times[Sample].Month = (uint8_t)(1u + (Bench_Random() % 12u));
+		Bench_Times[Sample].Year = (uint8_t)(Bench_Random() % 100u);
+		Bench_Times[Sample].Mode = DS1307_24H_MODE;
+	}
+
+	Start = Bench_Nanoseconds();
+
+	for (Round = 0; Round < BENCH_ROUNDS; Round++)
+	{
+		for (Sample = 0; Sample < BENCH_SAMPLES; Sample++)
+		{
+			DS1307_DateTimetoBCD(&Bench_Times[Sample], Bench_TableRegisters[Sample]);
+		}
+	}
+
+	TableEncodeTime = Bench_Nanoseconds() - Start;
+
+	Start = Bench_Nanoseconds();
+
+	for (Round = 0; Round < BENCH_ROUNDS; Round++)
+	{
+		for (Sample = 0; Sample < BENCH_SAMPLES; Sample++)
+		{
+			Bench_LoopEncode(&Bench_Times[Sample], Bench_LoopRegisters[Sample]);
+		}
+	}
+
+	LoopEncodeTime = Bench_Nanoseconds() - Start;
+
+	/* Registers Are Read From Address 0x00 , After The Word Address of The Write Array */
+	Start = Bench_Nanoseconds();
+
+	for (Round = 0; Round < BENCH_ROUNDS; Round++)
+	{
+		for (Sample = 0; Sample < BENCH_SAMPLES; Sample++)
+		{
+			DS1307_BCDToDateTime(&Bench_LoopRegisters[Sample][1], &Bench_TableTimes[Sample]);
+		}
+	}
+
+	TableDecodeTime = Bench_Nanoseconds() - Start;
+
+	Start = Bench_Nanoseconds();
+
+	for (Round = 0; Round < BENCH_ROUNDS; Round++)
+	{
+		for (Sample = 0; Sample < BENCH_SAMPLES; Sample++)
+		{
+			Bench_LoopDecode(&Bench_LoopRegisters[Sample][1], &Bench_LoopTimes[Sample]);
+		}
+	}
+
+	LoopDecodeTime = Bench_Nanoseconds() - Start;
+
+	/* Both Codecs Must Give The Same Registers & Get Back The Encoded Time */
+	for (Sample = 0; Sample < BENCH_SAMPLES; Sample++)
+	{
+		if ((0 != memcmp(Bench_TableRegisters[Sample], Bench_LoopRegisters[Sample], DS1307_WRITE_ARR_SIZE)) ||
+			!Bench_SameTime(&Bench_TableTimes[Sample], &Bench_Times[Sample]) ||
+			!Bench_SameTime(&Bench_LoopTimes[Sample], &Bench_Times[Sample]))
+		{
+			Bench_Failures++;
+		}
+	}
+
+	Bench_Check12H();
+
+	printf("BCD : %u Date & Times x %u Rounds , %lu Failures\n", BENCH_SAMPLES, BENCH_ROUNDS, (unsigned long)Bench_Failures);
+	printf("  Table Encode : %8.1f ns / Date & Time\n", (double)TableEncodeTime / (BENCH_SAMPLES * BENCH_ROUNDS));
+	printf("  Loop Encode  : %8.1f ns / Date & Time\n", (double)LoopEncodeTime / (BENCH_SAMPLES * BENCH_ROUNDS));
+	printf("  Table Decode : %8.1f ns / Date & Time\n", (double)TableDecodeTime / (BENCH_SAMPLES * BENCH_ROUNDS));
+	printf("  Loop Decode  : %8.1f ns / Date & Time\n", (double)LoopDecodeTime / (BENCH_SAMPLES * BENCH_ROUNDS));
+
+	return (0u == Bench_Failures) ? 0 : 1;
+}
@@ -0,0 +1,258 @@
+/*
+ ******************************************************************************
+ * @file           : Calendar_Test.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Test of The Calendar Module Against The C Library ( timegm , gmtime_r ) Over 2000 - 2099
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "../Library/ErrTypes.h"
+
+#include "../Drivers/Inc/I2C_Interface.h"
+
+#include "../HAL/Inc/DS1307_Interface.h"
+
+#include "../Service/Inc/Calendar.h"
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* First & Last Second of The Years The RTC Holds ( 2000 - 2099 ) */
+#define TEST_FIRST_EPOCH 946684800u
+#define TEST_LAST_EPOCH 4102444799u
+
+/* Random Seconds Checked After Every Day of The Range */
+#define TEST_RANDOM_SECONDS 1000000u
+
+/* Random Pairs For Add & Diff */
+#define TEST_RANDOM_PAIRS 200000u
+
+/* Largest Step For Add & Diff , Kept Inside int32_t */
+#define TEST_MAX_STEP 0x7FFFFFFFu
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+static uint32_t Test_Checks = 0;
+static uint32_t Test_Failures = 0;
+
+/* Random Generator State ( xorshift32 ) , Fixed Seed So Failures Repeat */
+static uint32_t Test_Seed = 0x2545F491u;
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Test_Random
+ * @brief			:	Next Pseudo Random Number
+ * @param			:	void
+ * @retval			:	Random 32 Bits
+ * ======================================================================================*/
+static uint32_t Test_Random(void)
+{
+	Test_Seed ^= Test_Seed << 13;
+	Test_Seed ^= Test_Seed >> 17;
+	Test_Seed ^= Test_Seed << 5;
+
+	return Test_Seed;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Test_RandomEpoch
+ * @brief			:	Random Second Between TEST_FIRST_EPOCH & TEST_LAST_EPOCH
+ * @param			:	void
+ * @retval			:	Epoch Seconds
+ * ======================================================================================*/
+static uint32_t Test_RandomEpoch(void)
+{
+	return TEST_FIRST_EPOCH + (Test_Random() % (TEST_LAST_EPOCH - TEST_FIRST_EPOCH + 1u));
+}
+
+/*=======================================================================================
+ * @fn		 		:	Test_Expect
+ * @brief			:	Count a Check & Print it If it Failed
+ * @param			:	Check Result
+ * @param			:	Check Name
+ * @param			:	Epoch Second The Check Was Made at
+ * @retval			:	void
+ * ======================================================================================*/
+static void Test_Expect(int Passed, const char *Name, uint32_t Epoch)
+{
+	Test_Checks++;
+
+	if (!Passed)
+	{
+		/* Only The First Failures Are Printed */
+		if (Test_Failures < 20u)
+		{
+			printf("FAILED %s at %lu\n", Name, (unsigned long)Epoch);
+		}
+		Test_Failures++;
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Test_ToConfig
+ * @brief			:	Convert a C Library Broken Down Time to The RTC Structure
+ * @param			:	Broken Down Time ( 2000 - 2099 )
+ * @param			:	Structure to Fill
+ * @retval			:	void
+ * ======================================================================================*/
+static void Test_ToConfig(const struct tm *Tm, DS1307_Config_t *Time)
+{
+	Time->Seconds = (uint8_t)Tm->tm_sec;
+	Time->Minutes = (uint8_t)Tm->tm_min;
+	Time->Hours = (uint8_t)Tm->tm_hour;
+	Time->Day = (DS1307_DAYS_t)(Tm->tm_wday + DS1307_SUNDAY);
+	Time->Date = (uint8_t)Tm->tm_mday;
+	Time->Month = (uint8_t)(Tm->tm_mon + 1);
+	Time->Year = (uint8_t)(Tm->tm_year - 100);
+	Time->Mode = DS1307_24H_MODE;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Test_Second
+ * @brief			:	Check Every Conversion of One Epoch Second Against gmtime_r & timegm
+ * @param			:	Epoch Seconds
+ * @retval			:	void
+ * ======================================================================================*/
+static void Test_Second(uint32_t Epoch)
+{
+	time_t Seconds = (time_t)Epoch;
+
+	struct tm Tm;
+
+	DS1307_Config_t Expected, Converted;
+
+	gmtime_r(&Seconds, &Tm);
+	Test_ToConfig(&Tm, &Expected);
+
+	Calendar_FromEpoch(Epoch, &Converted);
+
+	Test_Expect((Converted.Seconds == Expected.Seconds) && (Converted.Minutes == Expected.Minutes) &&
+					(Converted.Hours == Expected.Hours) && (Converted.Date == Expected.Date) &&
+					(Converted.Month == Expected.Month) && (Converted.Year == Expected.Year),
+				"Calendar_FromEpoch", Epoch);
+
+	Test_Expect(Converted.Day == Expected.Day, "Calendar_FromEpoch Day", Epoch);
+
+	Test_Expect(Calendar_ToEpoch(&Expected) == (uint32_t)timegm(&Tm), "Calendar_ToEpoch", Epoch);
+
+	Test_Expect(Calendar_DayOfWeek(Expected.Date, Expected.Month, Expected.Year) == Expected.Day, "Calendar_DayOfWeek", Epoch);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Test_Pair
+ * @brief			:	Check Add , Diff & Compare on Two Epoch Seconds
+ * @param			:	Earlier Epoch Seconds
+ * @param			:	Later Epoch Seconds , At Most TEST_MAX_STEP After The Earlier One
+ * @retval			:	void
+ * ======================================================================================*/
+static void Test_Pair(uint32_t Earlier, uint32_t Later)
+{
+	DS1307_Config_t First, Second, Moved;
+
+	int32_t Step = (int32_t)(Later - Earlier);
+
+	Calendar_FromEpoch(Earlier, &First);
+	Calendar_FromEpoch(Later, &Second);
+
+	Test_Expect(Calendar_Diff(&Second, &First) == Step, "Calendar_Diff", Earlier);
+	Test_Expect(Calendar_Diff(&First, &Second) == -Step, "Calendar_Diff Negative", Earlier);
+
+	Test_Expect(Calendar_Compare(&First, &Second) == ((0 == Step) ? 0 : -1), "Calendar_Compare", Earlier);
+	Test_Expect(Calendar_Compare(&Second, &First) == ((0 == Step) ? 0 : 1), "Calendar_Compare Reverse", Earlier);
+
+	Moved = First;
+	Calendar_AddSeconds(&Moved, Step);
+	Test_Expect(Calendar_ToEpoch(&Moved) == Later, "Calendar_AddSeconds", Earlier);
+
+	Moved = Second;
+	Calendar_AddSeconds(&Moved, -Step);
+	Test_Expect(Calendar_ToEpoch(&Moved) == Earlier, "Calendar_AddSeconds Negative", Earlier);
+}
+
+/*=======================================================================================
+ * @fn		 		:	Test_MonthLengths
+ * @brief			:	Check The Days of Every Month Against The Next Month First Day From timegm
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void Test_MonthLengths(void)
+{
+	struct tm First = {0}, Next = {0};
+
+	uint8_t Year = 0, Month = 0;
+
+	for (Year = 0; Year < 100u; Year++)
+	{
+		for (Month = 1; Month <= 12u; Month++)
+		{
+			First.tm_year = 100 + Year;
+			First.tm_mon = Month - 1;
+			First.tm_mday = 1;
+
+			Next = First;
+			Next.tm_mon++;
+
+			Test_Expect(Calendar_DaysInMonth(Month, Year) == (uint8_t)((timegm(&Next) - timegm(&First)) / 86400),
+						"Calendar_DaysInMonth", (uint32_t)timegm(&First));
+		}
+	}
+
+	Test_Expect(0u == Calendar_DaysInMonth(0, 0), "Calendar_DaysInMonth Invalid", 0);
+	Test_Expect(0u == Calendar_DaysInMonth(13, 0), "Calendar_DaysInMonth Invalid", 0);
+}
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+int main(void)
+{
+	uint32_t Epoch = 0, Counter = 0, Earlier = 0;
+
+	/* Every Day of The Range at a Random Time , Also Its First & Last Second */
+	for (Epoch = TEST_FIRST_EPOCH; Epoch < TEST_LAST_EPOCH; Epoch += CALENDAR_SECONDS_PER_DAY)
+	{
+		Test_Second(Epoch);
+		Test_Second(Epoch + (Test_Random() % CALENDAR_SECONDS_PER_DAY));
+		Test_Second(Epoch + CALENDAR_SECONDS_PER_DAY - 1u);
+	}
+
+	for (Counter = 0; Counter < TEST_RANDOM_SECONDS; Counter++)
+	{
+		Test_Second(Test_RandomEpoch());
+	}
+
+	for (Counter = 0; Counter < TEST_RANDOM_PAIRS; Counter++)
+	{
+		Earlier = Test_RandomEpoch();
+
+		/* Short Steps Are The Common Case , Long Ones Cross Years */
+		Epoch = Earlier + (Test_Random() % ((Counter & 1u) ? CALENDAR_SECONDS_PER_DAY : TEST_MAX_STEP));
+
+		if ((Epoch >= Earlier) && (Epoch <= TEST_LAST_EPOCH))
+		{
+			Test_Pair(Earlier, Epoch);
+		}
+	}
+
+	Test_MonthLengths();
+
+	printf("Calendar : %lu Checks , %lu Failures\n", (unsigned long)Test_Checks, (unsigned long)Test_Failures);
+
+	return (0u == Test_Failures) ? 0 : 1;
+}
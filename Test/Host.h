@@ -0,0 +1,23 @@
+/*
+ ******************************************************************************
+ * @file           : Host.h
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Forced Include of The Host Builds , Lets The Service Modules Run on a PC
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+#ifndef TEST_HOST_H_
+#define TEST_HOST_H_
+
+#include <stdint.h>
+
+#include "../Library/STM32F446xx.h"
+
+/* No Interrupts on The Host , Masking Them is a No Op */
+#undef ENTER_CRITICAL_SECTION
+#undef EXIT_CRITICAL_SECTION
+
+#define ENTER_CRITICAL_SECTION(PRIMASK_COPY) ((PRIMASK_COPY) = 0u)
+#define EXIT_CRITICAL_SECTION(PRIMASK_COPY) ((void)(PRIMASK_COPY))
+
+#endif /* TEST_HOST_H_ */
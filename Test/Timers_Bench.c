@@ -0,0 +1,263 @@
+/*
+ ******************************************************************************
+ * @file           : Timers_Bench.c
+ * @Author         : MOHAMMEDs & HEMA
+ * @brief          : Host Benchmark of The Timing Wheel With 10000 Concurrent Timers Against a Linear Scan of The Same Timers
+ * @Date           : Aug 30, 2023
+ ******************************************************************************
+ */
+
+/* ========================================================================= *
+ *                            INCLUDES SECTION                               *
+ * ========================================================================= */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "../Library/ErrTypes.h"
+
+#include "../Service/Inc/Deferred.h"
+#include "../Service/Inc/TimeBase.h"
+#include "../Service/Inc/Timers.h"
+
+/* ========================================================================= *
+ *                              MACROS SECTION                               *
+ * ========================================================================= */
+
+/* Timers Running Together , The Makefile Builds The Wheel With This Many Countdown Ids */
+#define BENCH_TIMERS 10000u
+
+/* Simulated Run Time in Ticks ( 1 ms Each ) */
+#define BENCH_TICKS 120000u
+
+/* Longest One Shot Duration & Period in ms , Durations Reach The Upper Wheel Levels */
+#define BENCH_MAX_DURATION 600000u
+#define BENCH_MAX_PERIOD 5000u
+
+/* Restarts Timed After The First Start */
+#define BENCH_RESTARTS 1000000u
+
+/* ========================================================================= *
+ *                        GLOBAL VARIABLES SECTION                           *
+ * ========================================================================= */
+
+/* Tick Call Back Hooked by Timers_Init & The Work Posted to PendSV , Run by The Main Loop Here */
+static void (*Bench_Tick)(void) = NULL;
+static void (*Bench_Work)(uint32_t Arg) = NULL;
+static uint32_t Bench_WorkArg = 0;
+
+/* Expected Deadline & Period of Each Timer */
+static uint32_t Bench_Deadline[BENCH_TIMERS];
+static uint32_t Bench_Period[BENCH_TIMERS];
+
+/* Millisecond Counters of The Linear Scan Reference */
+static uint32_t Bench_Counters[BENCH_TIMERS];
+
+static uint32_t Bench_Expiries = 0;
+static uint32_t Bench_Late = 0;
+
+/* Random Generator State ( xorshift32 ) */
+static uint32_t Bench_Seed = 0x9E3779B9u;
+
+/* ========================================================================= *
+ *              HOST STUBS OF THE TIME BASE & DEFERRED WORK                  *
+ * ========================================================================= */
+
+void TimeBase_SetTickCallBack(void (*CallBack)(void))
+{
+	Bench_Tick = CallBack;
+}
+
+Error_State_t Deferred_Post(void (*Work)(uint32_t Arg), uint32_t Arg)
+{
+	Bench_Work = Work;
+	Bench_WorkArg = Arg;
+
+	return OK;
+}
+
+/* ========================================================================= *
+ *                    PRIVATE FUNCTIONS IMPLEMENTATION                       *
+ * ========================================================================= */
+
+/*=======================================================================================
+ * @fn		 		:	Bench_Random
+ * @brief			:	Next Pseudo Random Number
+ * @param			:	void
+ * @retval			:	Random 32 Bits
+ * ======================================================================================*/
+static uint32_t Bench_Random(void)
+{
+	Bench_Seed ^= Bench_Seed << 13;
+	Bench_Seed ^= Bench_Seed >> 17;
+	Bench_Seed ^= Bench_Seed << 5;
+
+	return Bench_Seed;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_Nanoseconds
+ * @brief			:	Monotonic Time in ns
+ * @param			:	void
+ * @retval			:	Time in ns
+ * ======================================================================================*/
+static uint64_t Bench_Nanoseconds(void)
+{
+	struct timespec Now;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return ((uint64_t)Now.tv_sec * 1000000000u) + (uint64_t)Now.tv_nsec;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_Expired
+ * @brief			:	Timer Call Back , Checks The Timer Expired at its Deadline
+ * @param			:	Timer Id
+ * @retval			:	void
+ * ======================================================================================*/
+static void Bench_Expired(uint16_t TimerId)
+{
+	if (Timers_Millis() != Bench_Deadline[TimerId])
+	{
+		Bench_Late++;
+	}
+
+	Bench_Deadline[TimerId] += Bench_Period[TimerId];
+	Bench_Expiries++;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_Start
+ * @brief			:	Start a Timer , Every Fourth One is Periodic
+ * @param			:	Timer Id
+ * @retval			:	void
+ * ======================================================================================*/
+static void Bench_Start(uint16_t TimerId)
+{
+	uint32_t Duration = 0;
+
+	if (0u == (TimerId % 4u))
+	{
+		Duration = 1u + (Bench_Random() % BENCH_MAX_PERIOD);
+		Bench_Period[TimerId] = Duration;
+		Timers_StartPeriodic(TimerId, Duration, &Bench_Expired);
+	}
+	else
+	{
+		Duration = 1u + (Bench_Random() % BENCH_MAX_DURATION);
+		Bench_Period[TimerId] = 0;
+		Timers_Start(TimerId, Duration, &Bench_Expired);
+	}
+
+	Bench_Deadline[TimerId] = Timers_Millis() + Duration;
+	Bench_Counters[TimerId] = Duration;
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_RunTick
+ * @brief			:	One SysTick Tick Then The PendSV Work It Posted
+ * @param			:	void
+ * @retval			:	void
+ * ======================================================================================*/
+static void Bench_RunTick(void)
+{
+	void (*Work)(uint32_t Arg) = NULL;
+
+	Bench_Tick();
+
+	if (NULL != Bench_Work)
+	{
+		Work = Bench_Work;
+		Bench_Work = NULL;
+		Work(Bench_WorkArg);
+	}
+}
+
+/*=======================================================================================
+ * @fn		 		:	Bench_ScanTick
+ * @brief			:	One Tick of The Reference , Every Counter is Visited Each Tick
+ * @param			:	void
+ * @retval			:	Number of Counters Reaching 0
+ * ======================================================================================*/
+static uint32_t Bench_ScanTick(void)
+{
+	uint32_t Counter = 0, Expired = 0;
+
+	for (Counter = 0; Counter < BENCH_TIMERS; Counter++)
+	{
+		if (Bench_Counters[Counter] > 0u)
+		{
+			if (0u == --Bench_Counters[Counter])
+			{
+				Bench_Counters[Counter] = Bench_Period[Counter];
+				Expired++;
+			}
+		}
+	}
+	return Expired;
+}
+
+/* ========================================================================= *
+ *                    FUNCTIONS IMPLEMENTATION SECTION                       *
+ * ========================================================================= */
+
+int main(void)
+{
+	uint64_t Start = 0, StartTime = 0, RestartTime = 0, WheelTime = 0, ScanTime = 0;
+
+	uint32_t Counter = 0, ScanExpiries = 0;
+
+	uint16_t TimerId = 0;
+
+	Timers_Init();
+
+	Start = Bench_Nanoseconds();
+
+	for (TimerId = 0; TimerId < BENCH_TIMERS; TimerId++)
+	{
+		Bench_Start(TimerId);
+	}
+
+	StartTime = Bench_Nanoseconds() - Start;
+
+	/* Restart Random Timers , Each Restart is a Stop & a Start */
+	Start = Bench_Nanoseconds();
+
+	for (Counter = 0; Counter < BENCH_RESTARTS; Counter++)
+	{
+		Bench_Start((uint16_t)(Bench_Random() % BENCH_TIMERS));
+	}
+
+	RestartTime = Bench_Nanoseconds() - Start;
+
+	Start = Bench_Nanoseconds();
+
+	for (Counter = 0; Counter < BENCH_TICKS; Counter++)
+	{
+		Bench_RunTick();
+	}
+
+	WheelTime = Bench_Nanoseconds() - Start;
+
+	Start = Bench_Nanoseconds();
+
+	for (Counter = 0; Counter < BENCH_TICKS; Counter++)
+	{
+		ScanExpiries += Bench_ScanTick();
+	}
+
+	ScanTime = Bench_Nanoseconds() - Start;
+
+	printf("Timers : %u Timers , %u Ticks , %lu Expiries ( Scan %lu ) , %lu Late\n", BENCH_TIMERS, BENCH_TICKS,
+		   (unsigned long)Bench_Expiries, (unsigned long)ScanExpiries, (unsigned long)Bench_Late);
+	printf("  Start        : %8.1f ns / Timer\n", (double)StartTime / BENCH_TIMERS);
+	printf("  Restart      : %8.1f ns / Timer\n", (double)RestartTime / BENCH_RESTARTS);
+	printf("  Wheel Tick   : %8.1f ns / Tick , %8.1f ns / Expiry\n", (double)WheelTime / BENCH_TICKS,
+		   (double)WheelTime / ((0u == Bench_Expiries) ? 1u : Bench_Expiries));
+	printf("  Scan Tick    : %8.1f ns / Tick\n", (double)ScanTime / BENCH_TICKS);
+
+	/* Both Must Expire The Same Timers , Each at its Deadline */
+	return ((0u == Bench_Late) && (Bench_Expiries == ScanExpiries)) ? 0 : 1;
+}